@@ -0,0 +1,165 @@
+//
+// Asynchronous accept benchmark: connections per second through the asynchronous accept paths.
+//
+// Usage: accept_async_benchmark [connections-per-round] [rounds]
+//
+// A client thread opens connections one after another while the server side accepts them asynchronously; the
+// table shows accepted connections per second over all rounds:
+// - "std::async": the previous acceptAsync(), which started a new std::async() thread for every call
+// - "acceptAsync": acceptAsync() with a callback that re-arms itself, all served by the one accept thread
+// - "AcceptLoop": an AcceptLoop that drains the listener per readiness event and runs the handler inline
+//
+
+#include <jsocketpp/AcceptLoop.hpp>
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+// Counts accepted connections and lets the measuring thread wait for all of them
+class Tally
+{
+  public:
+    void add()
+    {
+        {
+            const std::lock_guard lock(_mutex);
+            ++_count;
+        }
+        _changed.notify_all();
+    }
+
+    void waitFor(const std::size_t count)
+    {
+        std::unique_lock lock(_mutex);
+        _changed.wait(lock, [&] { return _count >= count; });
+    }
+
+  private:
+    std::mutex _mutex{};
+    std::condition_variable _changed{};
+    std::size_t _count = 0;
+};
+
+// Connects `connections` clients and waits until `accepted` has seen them all; returns the elapsed time
+Clock::duration connectAll(const ServerSocket& server, const std::size_t connections, Tally& accepted)
+{
+    std::vector<Socket> clients;
+    clients.reserve(connections);
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < connections; ++i)
+        clients.emplace_back("127.0.0.1", server.getLocalPort());
+    accepted.waitFor(connections);
+    return Clock::now() - start;
+}
+
+ServerSocket makeServer(const std::size_t connections)
+{
+    ServerSocket server(0, "127.0.0.1", false);
+    server.bind();
+    server.listen(static_cast<int>(connections));
+    return server;
+}
+
+Clock::duration runStdAsync(const std::size_t connections)
+{
+    ServerSocket server = makeServer(connections);
+    Tally tally;
+    std::vector<Socket> accepted;
+    accepted.reserve(connections);
+    std::thread acceptor(
+        [&]
+        {
+            for (std::size_t i = 0; i < connections; ++i)
+            {
+                accepted.push_back(std::async(std::launch::async, [&] { return server.accept(); }).get());
+                tally.add();
+            }
+        });
+    const auto elapsed = connectAll(server, connections, tally);
+    acceptor.join();
+    return elapsed;
+}
+
+Clock::duration runAcceptAsync(const std::size_t connections)
+{
+    ServerSocket server = makeServer(connections);
+    Tally tally;
+    std::vector<Socket> accepted;
+    accepted.reserve(connections);
+    std::function<void(std::optional<Socket>, std::exception_ptr)> onAccept =
+        [&](std::optional<Socket> client, const std::exception_ptr& error)
+    {
+        if (error || !client)
+            return;
+        accepted.push_back(std::move(*client));
+        if (accepted.size() < connections)
+            server.acceptAsync(onAccept);
+        tally.add();
+    };
+    server.acceptAsync(onAccept);
+    const auto elapsed = connectAll(server, connections, tally);
+    server.close(); // joins the accept thread before `accepted` goes away
+    return elapsed;
+}
+
+Clock::duration runAcceptLoop(const std::size_t connections)
+{
+    ServerSocket server = makeServer(connections);
+    Tally tally;
+    std::vector<Socket> accepted;
+    accepted.reserve(connections);
+    AcceptLoopOptions options;
+    options.workerThreads = 0;
+    AcceptLoop loop(
+        server,
+        [&](Socket client)
+        {
+            accepted.push_back(std::move(client));
+            tally.add();
+        },
+        options);
+    const auto elapsed = connectAll(server, connections, tally);
+    loop.stop();
+    return elapsed;
+}
+
+double measure(Clock::duration (*run)(std::size_t), const std::size_t connections, const std::size_t rounds)
+{
+    Clock::duration total{};
+    for (std::size_t round = 0; round < rounds; ++round)
+        total += run(connections);
+    return static_cast<double>(connections * rounds) / std::chrono::duration<double>(total).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SocketInitializer init;
+    const std::size_t connections = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 500;
+    const std::size_t rounds = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 5;
+
+    std::printf("%-12s %14s\n", "mode", "accepts/s");
+    std::printf("%-12s %14.0f\n", "std::async", measure(runStdAsync, connections, rounds));
+    std::printf("%-12s %14.0f\n", "acceptAsync", measure(runAcceptAsync, connections, rounds));
+    std::printf("%-12s %14.0f\n", "AcceptLoop", measure(runAcceptLoop, connections, rounds));
+    return 0;
+}
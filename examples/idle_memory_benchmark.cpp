@@ -0,0 +1,125 @@
+//
+// Idle-connection memory benchmark: heap held by Socket read buffers with the shared BufferPool.
+//
+// Usage: idle_memory_benchmark [connections...]   (default: 10000 100000)
+//
+// For each count, opens that many loopback connections (two Sockets each) and measures the heap in three states:
+// every accepted socket holding part of an unread message, every socket drained (idle), and idle after
+// BufferPool::trim(). Before the pool, each Socket kept a DefaultBufferSize vector for its whole lifetime, i.e.
+// the "partial message" figure even when idle. Counts larger than RLIMIT_NOFILE allows are reduced.
+//
+
+#include <jsocketpp/BufferPool.hpp>
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace jsocketpp;
+
+namespace
+{
+
+// Bytes currently allocated on the heap, or 0 if this platform gives no cheap way to ask
+std::size_t heapInUse()
+{
+#if defined(__GLIBC__)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+std::size_t maxConnections()
+{
+#ifndef _WIN32
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+        getrlimit(RLIMIT_NOFILE, &limit);
+        if (limit.rlim_cur != RLIM_INFINITY)
+            return (static_cast<std::size_t>(limit.rlim_cur) - 64) / 2; // two descriptors per connection
+    }
+#endif
+    return static_cast<std::size_t>(-1);
+}
+
+void report(const char* state, const std::size_t heap, const std::size_t baseline, const std::size_t connections)
+{
+    const double perConnection =
+        heap >= baseline ? static_cast<double>(heap - baseline) / static_cast<double>(connections) : 0.0;
+    std::printf("  %-22s %10.1f B/conn   pool: %8zu KiB borrowed, %6zu KiB cached\n", state, perConnection,
+                BufferPool::global().outstandingBytes() / 1024, BufferPool::global().cachedBytes() / 1024);
+}
+
+void measure(std::size_t connections)
+{
+    if (const std::size_t limit = maxConnections(); connections > limit)
+    {
+        std::printf("(RLIMIT_NOFILE allows only %zu connections)\n", limit);
+        connections = limit;
+    }
+    std::printf("%zu connections\n", connections);
+
+    ServerSocket server(0, "127.0.0.1", false);
+    server.bind();
+    server.listen(1024);
+
+    std::vector<Socket> clients;
+    std::vector<Socket> peers;
+    clients.reserve(connections);
+    peers.reserve(connections);
+    const std::size_t baseline = heapInUse();
+
+    for (std::size_t i = 0; i < connections; ++i)
+    {
+        clients.emplace_back("127.0.0.1", server.getLocalPort());
+        peers.push_back(server.accept());
+        (void) clients.back().write("header\npartial");
+        (void) peers.back().readUntil('\n'); // leaves "partial" in the peer's read buffer
+    }
+    report("partial message", heapInUse(), baseline, connections);
+
+    for (auto& peer : peers)
+    {
+        while (peer.bufferedBytes() > 0)
+            (void) peer.readAtMost(peer.bufferedBytes());
+    }
+    report("idle (drained)", heapInUse(), baseline, connections);
+
+    BufferPool::global().trim();
+    report("idle after trim()", heapInUse(), baseline, connections);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SocketInitializer init;
+    if (heapInUse() == 0)
+        std::printf("heap statistics unavailable on this platform; only pool figures are meaningful\n");
+
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; ++i)
+            measure(static_cast<std::size_t>(std::atoi(argv[i])));
+    }
+    else
+    {
+        measure(10'000);
+        measure(100'000);
+    }
+    return 0;
+}
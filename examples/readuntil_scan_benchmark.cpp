@@ -0,0 +1,97 @@
+//
+// Delimiter-scan benchmark: GB/s of the readUntil() line scan, previous byte loop vs the vectorized search.
+//
+// Usage: readuntil_scan_benchmark [MiB-per-size]
+//
+// Lines of 64 B to 64 KiB, delimiter at the end, are scanned in memory without any socket in the way. The
+// multi-byte case scans an HTTP-style header block, whose "\r\n" line ends keep producing false starts:
+// - "byte loop": the previous readUntil(char) inner loop, which compared and push_back()'d one byte at a time
+// - "findByte": internal::findByte() followed by one append of the whole line, as readUntil() does now
+// - "sv::find": std::string_view::find() for "\r\n\r\n", the obvious scalar way to look for a multi-byte delimiter
+// - "findPattern": internal::findPattern() for "\r\n\r\n", as readUntil(std::string_view) does now
+//
+
+#include <jsocketpp/internal/ByteScan.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+// Runs `scan` over `line` until `totalBytes` have been scanned; returns GB/s
+template <typename Scan> double measure(const std::string& line, const std::size_t totalBytes, Scan scan)
+{
+    const std::size_t rounds = (std::max) (std::size_t{1}, totalBytes / line.size());
+    std::size_t found = 0;
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < rounds; ++i)
+        found += scan(std::string_view(line));
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (found != rounds * line.size())
+        std::fprintf(stderr, "delimiter not found where expected\n");
+    return static_cast<double>(rounds * line.size()) / seconds / 1e9;
+}
+
+// @p size bytes of @p filler, cut so that @p delimiter ends them and occurs nowhere earlier
+std::string makeLine(const std::size_t size, const std::string_view filler, const std::string_view delimiter)
+{
+    std::string line;
+    while (line.size() < size - delimiter.size())
+        line += filler;
+    line.resize(size - delimiter.size());
+    for (auto it = line.rbegin(); it != line.rend() && (*it == '\r' || *it == '\n'); ++it)
+        *it = '-'; // don't let a cut-off line end join the delimiter
+    line += delimiter;
+    return line;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t mib = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 1024;
+    const std::size_t totalBytes = mib << 20;
+
+    std::string result; // reused, as a caller reading many lines would
+    const auto byteLoop = [&result](const std::string_view data)
+    {
+        result.clear();
+        for (const char ch : data)
+        {
+            result.push_back(ch);
+            if (ch == '\n')
+                break;
+        }
+        return result.size();
+    };
+    const auto findByte = [&result](const std::string_view data)
+    {
+        const char* end = internal::findByte(data.data(), data.size(), '\n');
+        result.assign(data.data(), static_cast<std::size_t>(end - data.data()) + 1);
+        return result.size();
+    };
+    const auto svFind = [](const std::string_view data) { return data.find("\r\n\r\n") + 4; };
+    const auto findPattern = [](const std::string_view data)
+    { return static_cast<std::size_t>(internal::findPattern(data.data(), data.size(), "\r\n\r\n") - data.data()) + 4; };
+
+    std::printf("GB/s, %zu MiB scanned per cell, delimiter at the end of each line\n", mib);
+    std::printf("%-8s %10s %10s %10s %12s\n", "line", "byte loop", "findByte", "sv::find", "findPattern");
+    for (const std::size_t size : {64, 1024, 4096, 65536})
+    {
+        const std::string lf = makeLine(size, "abcdefghijklmnopqrstuvwxyz", "\n");
+        const std::string crlf = makeLine(size, "X-Header: value\r\n", "\r\n\r\n");
+        std::printf("%-8zu %10.1f %10.1f %10.1f %12.1f\n", size, measure(lf, totalBytes, byteLoop),
+                    measure(lf, totalBytes, findByte), measure(crlf, totalBytes, svFind),
+                    measure(crlf, totalBytes, findPattern));
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+//
+// Receive-buffer benchmark: GB/s through Socket's internal read buffer, linear (pooled) vs mirrored ring.
+//
+// Usage: ring_buffer_benchmark [MiB] [buffer-bytes] [frame-bytes]
+//
+// Only the buffer is measured, without a kernel in the way: each step copies up to one 1448-byte segment (a
+// typical TCP payload) into the free region, the way Socket's buffered recv() does, then takes every whole frame
+// as a contiguous view and checks its first and last byte. The linear buffer has to move a partial frame left at
+// its end to the front every so often; the mirrored ring never moves anything.
+//
+// Linux-only.
+//
+
+#include <jsocketpp/internal/ReceiveBuffer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <span>
+#include <string>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+#if defined(__linux__)
+
+namespace
+{
+
+constexpr std::size_t SegmentBytes = 1448;
+
+void measure(const char* label, const bool mirrored, const std::size_t totalBytes, const std::size_t bufferBytes,
+             const std::size_t frameBytes)
+{
+    BufferPool pool;
+    internal::ReceiveBuffer buffer(bufferBytes, pool);
+    buffer.setMirrored(mirrored);
+
+    // Frames of '<' ... '>'; the stream repeats `pattern` so that any offset can be copied from it
+    std::string frame(frameBytes, '.');
+    frame.front() = '<';
+    frame.back() = '>';
+    std::string pattern;
+    while (pattern.size() < frameBytes + SegmentBytes)
+        pattern += frame;
+
+    std::size_t produced = 0;
+    std::size_t framesRead = 0;
+    std::size_t bad = 0;
+    const auto start = Clock::now();
+    while (produced < totalBytes)
+    {
+        const std::span<char> space = buffer.prepare();
+        const std::size_t n = (std::min) (space.size(), SegmentBytes);
+        std::memcpy(space.data(), pattern.data() + produced % frameBytes, n);
+        buffer.commit(n);
+        produced += n;
+
+        while (buffer.size() >= frameBytes)
+        {
+            const char* data = buffer.data();
+            bad += static_cast<std::size_t>(data[0] != '<' || data[frameBytes - 1] != '>');
+            buffer.consume(frameBytes);
+            ++framesRead;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("%-9s %10.2f %12zu%s\n", label, static_cast<double>(produced) / seconds / 1e9, framesRead,
+                bad != 0 ? "   CORRUPT" : "");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t mib = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 4096;
+    const std::size_t bufferBytes = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 16 * 1024;
+    const std::size_t frameBytes = argc > 3 ? static_cast<std::size_t>(std::atoi(argv[3])) : 6000;
+
+    std::printf("%zu MiB through a %zu-byte buffer in %zu-byte frames\n", mib, bufferBytes, frameBytes);
+    std::printf("%-9s %10s %12s\n", "buffer", "GB/s", "frames");
+    measure("linear", false, mib << 20, bufferBytes, frameBytes);
+    measure("mirrored", true, mib << 20, bufferBytes, frameBytes);
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::puts("ring_buffer_benchmark: mirrored receive buffers are Linux-only");
+    return 0;
+}
+
+#endif
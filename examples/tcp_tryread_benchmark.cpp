@@ -0,0 +1,86 @@
+//
+// Would-block cost benchmark: throwing readInto() versus non-throwing tryReadInto() on a non-blocking socket.
+//
+// Usage: tcp_tryread_benchmark [attempts] [percent-would-block]
+//
+// The peer sends one byte before every Nth read attempt, so the given share of attempts (90% by default) finds
+// no data and returns EAGAIN. readInto() turns each of those into a SocketException (message formatting plus
+// unwinding); tryReadInto() returns IoStatus::WouldBlock. The table shows the mean cost per read attempt.
+//
+
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+double measure(const bool throwing, const std::size_t attempts, const std::size_t dataEvery)
+{
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    client.setTcpNoDelay(true);
+    const Socket peer = server.accept(std::nullopt, std::nullopt, std::nullopt, -1, -1, true, false, true);
+
+    char buf[64];
+    std::size_t received = 0;
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < attempts; ++i)
+    {
+        if (i % dataEvery == 0)
+        {
+            (void) client.write("x");
+            while (!peer.waitReady(false, -1))
+            {
+            }
+        }
+
+        if (throwing)
+        {
+            try
+            {
+                received += peer.readInto(buf, sizeof(buf));
+            }
+            catch (const SocketException&)
+            {
+                // would block
+            }
+        }
+        else
+        {
+            received += peer.tryReadInto(buf, sizeof(buf)).bytes;
+        }
+    }
+    const auto elapsed = Clock::now() - start;
+
+    if (received != (attempts + dataEvery - 1) / dataEvery)
+        std::fprintf(stderr, "unexpected byte count %zu\n", received);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(attempts);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SocketInitializer init;
+    const std::size_t attempts = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 1'000'000;
+    const int percent = argc > 2 ? std::atoi(argv[2]) : 90;
+    if (percent < 0 || percent >= 100)
+    {
+        std::fprintf(stderr, "percent-would-block must be in [0, 100)\n");
+        return 1;
+    }
+    const auto dataEvery = static_cast<std::size_t>(100 / (100 - percent));
+
+    std::printf("%-12s %12s\n", "method", "ns/attempt");
+    std::printf("%-12s %12.1f\n", "readInto", measure(true, attempts, dataEvery));
+    std::printf("%-12s %12.1f\n", "tryReadInto", measure(false, attempts, dataEvery));
+    return 0;
+}
@@ -0,0 +1,104 @@
+//
+// TCP bulk-send benchmark: Socket::writeAll() versus Socket::writeZeroCopy() (MSG_ZEROCOPY on Linux).
+//
+// Usage: tcp_zerocopy_benchmark [milliseconds-per-run] [blob-KiB]
+//
+// A reader thread drains a loopback connection while the main thread sends the same blob repeatedly. The zero-copy
+// run keeps two blobs in flight and waits for a blob's completion before reusing it. On loopback the kernel reports
+// copied completions, so the socket falls back to ordinary sends; the last column shows whether MSG_ZEROCOPY was
+// still in use at the end. Run against a remote peer to see the real zero-copy gain.
+//
+
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+void measure(const char* label, const std::chrono::milliseconds runTime, const std::size_t blobSize,
+             const bool zeroCopy)
+{
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    peer.setReceiveBufferSize(4 * 1024 * 1024);
+    client.setSendBufferSize(4 * 1024 * 1024);
+#if defined(__linux__)
+    if (zeroCopy)
+        client.setZeroCopy(true);
+#endif
+
+    std::atomic<bool> done{false};
+    std::thread reader(
+        [&]
+        {
+            try
+            {
+                while (!done.load(std::memory_order_relaxed))
+                    if (peer.readAtMost(1024 * 1024).empty())
+                        break;
+            }
+            catch (const SocketException&)
+            {
+            }
+        });
+
+    std::array<std::string, 2> blobs{std::string(blobSize, 'a'), std::string(blobSize, 'b')};
+    std::array<std::uint32_t, 2> tickets{};
+    std::size_t sent = 0;
+    const auto start = Clock::now();
+    for (std::size_t i = 0; Clock::now() - start < runTime; ++i)
+    {
+        const std::size_t slot = i % blobs.size();
+        if (zeroCopy)
+        {
+            client.waitZeroCopy(tickets[slot]); // the blob in this slot may still be referenced by the kernel
+            tickets[slot] = client.writeZeroCopy(blobs[slot]);
+        }
+        else
+        {
+            (void) client.writeAll(blobs[slot]);
+        }
+        sent += blobSize;
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+#if defined(__linux__)
+    const bool active = client.isZeroCopyActive();
+#else
+    const bool active = false;
+#endif
+    done.store(true, std::memory_order_relaxed);
+    client.close();
+    reader.join();
+
+    std::printf("%-10s %12.1f %10s\n", label, static_cast<double>(sent) / seconds / (1024.0 * 1024.0),
+                zeroCopy ? (active ? "yes" : "fell back") : "-");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SocketInitializer init;
+    const auto runTime = std::chrono::milliseconds(argc > 1 ? std::atoi(argv[1]) : 1000);
+    const std::size_t blobSize = (argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 4096) * 1024;
+
+    std::printf("%-10s %12s %10s\n", "mode", "MiB/s", "zerocopy");
+    measure("writeAll", runTime, blobSize, false);
+    measure("zerocopy", runTime, blobSize, true);
+    return 0;
+}
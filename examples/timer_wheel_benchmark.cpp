@@ -0,0 +1,103 @@
+//
+// Idle-timeout re-arm benchmark: ordered std::multimap (the previous EventLoop timer queue) versus TimerWheel.
+//
+// Usage: timer_wheel_benchmark [connections] [rearms-per-connection]
+//
+// Every connection holds one 30 s idle deadline that is pushed back on each simulated transfer, and the clock
+// is advanced after every pass over the connections, as an event loop would. Almost no timer ever fires; the
+// cost measured is arming, re-arming and expiry bookkeeping. The table shows the mean cost per re-arm.
+//
+
+#include <jsocketpp/TimerWheel.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace jsocketpp;
+using Clock = TimerWheel::Clock;
+
+namespace
+{
+
+constexpr auto IdleTimeout = std::chrono::seconds(30);
+constexpr auto PassDuration = std::chrono::milliseconds(3); // simulated time per pass over all connections
+
+double measureMultimap(const std::size_t connections, const std::size_t rearms)
+{
+    using Queue = std::multimap<Clock::time_point, std::size_t>;
+    Queue queue;
+    std::vector<Queue::iterator> entries(connections);
+    const auto t0 = Clock::now();
+    for (std::size_t i = 0; i < connections; ++i)
+        entries[i] = queue.emplace(t0 + IdleTimeout, i);
+
+    std::size_t expired = 0;
+    auto now = t0;
+    const auto start = Clock::now();
+    for (std::size_t pass = 0; pass < rearms; ++pass)
+    {
+        now += PassDuration;
+        for (std::size_t i = 0; i < connections; ++i)
+        {
+            queue.erase(entries[i]);
+            entries[i] = queue.emplace(now + IdleTimeout, i);
+        }
+        while (!queue.empty() && queue.begin()->first <= now)
+        {
+            queue.erase(queue.begin());
+            ++expired;
+        }
+    }
+    const auto elapsed = Clock::now() - start;
+
+    if (expired != 0)
+        std::fprintf(stderr, "unexpected expiries: %zu\n", expired);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(connections * rearms);
+}
+
+double measureWheel(const std::size_t connections, const std::size_t rearms)
+{
+    const auto t0 = Clock::now();
+    TimerWheel wheel(std::chrono::milliseconds(1), t0);
+    std::size_t expired = 0;
+    std::vector<std::unique_ptr<TimerWheel::Timer>> timers;
+    timers.reserve(connections);
+    for (std::size_t i = 0; i < connections; ++i)
+    {
+        timers.push_back(std::make_unique<TimerWheel::Timer>([&expired] { ++expired; }));
+        wheel.schedule(*timers.back(), t0 + IdleTimeout);
+    }
+
+    auto now = t0;
+    const auto start = Clock::now();
+    for (std::size_t pass = 0; pass < rearms; ++pass)
+    {
+        now += PassDuration;
+        for (const auto& timer : timers)
+            wheel.schedule(*timer, now + IdleTimeout);
+        wheel.advance(now);
+    }
+    const auto elapsed = Clock::now() - start;
+
+    if (expired != 0)
+        std::fprintf(stderr, "unexpected expiries: %zu\n", expired);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(connections * rearms);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t connections = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 100'000;
+    const std::size_t rearms = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 50;
+
+    std::printf("%zu connections, %zu re-arms each\n", connections, rearms);
+    std::printf("%-10s %12s\n", "queue", "ns/re-arm");
+    std::printf("%-10s %12.1f\n", "multimap", measureMultimap(connections, rearms));
+    std::printf("%-10s %12.1f\n", "wheel", measureWheel(connections, rearms));
+    return 0;
+}
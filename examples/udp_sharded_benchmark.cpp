@@ -0,0 +1,103 @@
+//
+// UDP receive-scaling benchmark: ShardedDatagramServer with 1, 2, 4, ... shards (SO_REUSEPORT).
+//
+// Usage: udp_sharded_benchmark [milliseconds-per-run] [max-shards] [payload-bytes] [cpu|hash]
+//
+// For each shard count N, N sender threads (each with its own socket, hence its own source port) blast batches
+// of datagrams at the server over loopback, and the table shows the datagrams per second the shards received in
+// total. Senders and shards compete for the same cores here, so run with max-shards at most half the core count;
+// against remote senders the receive rate should scale close to linearly with the shard count. The last column
+// shows how evenly the datagrams were spread (smallest shard share / fair share) and whether the CPU-steering
+// program was attached; pass "hash" to leave spreading to the kernel's 4-tuple hash instead.
+//
+
+#include <jsocketpp/DatagramSocket.hpp>
+#include <jsocketpp/ShardedDatagramServer.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+void measure(const std::size_t shards, const std::chrono::milliseconds runTime, const std::size_t payload,
+             const bool cpuSteering)
+{
+    ShardedDatagramServerOptions options;
+    options.shards = shards;
+    options.localAddress = "127.0.0.1";
+    options.recvBufferSize = 4 * 1024 * 1024;
+    options.resolveSenders = false;
+    options.cpuSteering = cpuSteering;
+    ShardedDatagramServer server(0, [](const DatagramBatch&) {}, options);
+
+    std::atomic<bool> running{true};
+    std::vector<std::thread> senders;
+    for (std::size_t i = 0; i < shards; ++i)
+    {
+        senders.emplace_back(
+            [&]
+            {
+                DatagramSocket sender(0, "127.0.0.1", std::nullopt, 4 * 1024 * 1024);
+                sender.connect("127.0.0.1", server.getLocalPort(), -1);
+                const std::vector<DatagramPacket> out(32, DatagramPacket(std::string(payload, 'x'), "", 0));
+                while (running.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        (void) sender.writeBatch(out);
+                    }
+                    catch (const SocketException&)
+                    {
+                        // ECONNREFUSED/ENOBUFS under overload; keep going
+                    }
+                }
+            });
+    }
+
+    const std::uint64_t before = server.receivedCount();
+    const auto start = Clock::now();
+    std::this_thread::sleep_for(runTime);
+    const std::uint64_t received = server.receivedCount() - before;
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    running.store(false, std::memory_order_relaxed);
+    for (auto& sender : senders)
+        sender.join();
+
+    std::uint64_t smallest = received;
+    for (std::size_t i = 0; i < server.shardCount(); ++i)
+        smallest = (std::min) (smallest, server.receivedCount(i));
+    const double fairShare = static_cast<double>(server.receivedCount()) / static_cast<double>(shards);
+
+    std::printf("%-6zu %14.0f %9.2f %s\n", shards, static_cast<double>(received) / seconds,
+                fairShare > 0 ? static_cast<double>(smallest) / fairShare : 0.0,
+                server.isCpuSteeringActive() ? "cpu" : "hash");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    SocketInitializer init;
+    const auto runTime = std::chrono::milliseconds(argc > 1 ? std::atoi(argv[1]) : 1000);
+    const std::size_t maxShards = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2]))
+                                           : (std::max) (1u, std::thread::hardware_concurrency() / 2);
+    const std::size_t payload = argc > 3 ? static_cast<std::size_t>(std::atoi(argv[3])) : 64;
+    const bool cpuSteering = argc <= 4 || std::string(argv[4]) != "hash";
+
+    std::printf("%-6s %14s %9s %s\n", "shards", "received pps", "balance", "steering");
+    for (std::size_t shards = 1; shards <= maxShards; shards *= 2)
+        measure(shards, runTime, payload, cpuSteering);
+    return 0;
+}
@@ -0,0 +1,139 @@
+//
+// Borrowed-view benchmark: heap allocations and time per length-prefixed frame read from a loopback connection.
+//
+// Usage: view_read_benchmark [frames] [payload-bytes]
+//
+// A writer thread sends frames of a 4-byte big-endian length followed by the payload. The "readPrefixed" row
+// reads each frame with Socket::readPrefixed<uint32_t>(), which returns an owning std::string; the "viewExact" row
+// looks at the same frames in place with viewExact() and releases them with consume(). Both rows touch every
+// payload byte. Allocations are counted by replacing the global operator new.
+//
+
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+} // namespace
+
+void* operator new(const std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+
+std::size_t checksum(const std::string_view payload)
+{
+    std::size_t sum = 0;
+    for (const char c : payload)
+        sum += static_cast<unsigned char>(c);
+    return sum;
+}
+
+template <typename ReadFrame> void measure(const char* label, const std::size_t frames, const std::string& batch,
+                                           const std::size_t framesPerBatch, ReadFrame readFrame)
+{
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    // The library's default SO_SNDBUF/SO_RCVBUF are small; stalls on window updates would dwarf the reads measured
+    client.setSendBufferSize(1 << 20);
+    peer.setReceiveBufferSize(1 << 20);
+    client.setTcpNoDelay(true);
+
+    std::thread writer(
+        [&client, &batch, frames, framesPerBatch]
+        {
+            try
+            {
+                for (std::size_t sent = 0; sent < frames; sent += framesPerBatch)
+                    client.writeAll(batch);
+            }
+            catch (const SocketException&)
+            {
+            }
+        });
+
+    const std::size_t before = allocations.load();
+    const auto start = Clock::now();
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < frames; ++i)
+        sum += readFrame(peer);
+    const auto elapsed = Clock::now() - start;
+    const std::size_t allocated = allocations.load() - before;
+
+    writer.join();
+
+    std::printf("%-13s %10.1f %12.2f   (checksum %zu)\n", label,
+                std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(frames),
+                static_cast<double>(allocated) / static_cast<double>(frames), sum);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t frames = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 1'000'000;
+    const std::size_t payloadBytes = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 64;
+
+    SocketInitializer init;
+
+    // Whole frames per write; the reader stops after exactly `frames` frames, so round up to a full batch
+    constexpr std::size_t framesPerBatch = 256;
+    const std::uint32_t netLength = net::toNetwork(static_cast<std::uint32_t>(payloadBytes));
+    std::string frame(sizeof(netLength), '\0');
+    std::memcpy(frame.data(), &netLength, sizeof(netLength));
+    for (std::size_t i = 0; i < payloadBytes; ++i)
+        frame.push_back(static_cast<char>('a' + i % 26));
+    std::string batch;
+    for (std::size_t i = 0; i < framesPerBatch; ++i)
+        batch += frame;
+    const std::size_t total = (frames + framesPerBatch - 1) / framesPerBatch * framesPerBatch;
+
+    std::printf("%zu frames of 4 + %zu bytes\n", total, payloadBytes);
+    std::printf("%-13s %10s %12s\n", "reader", "ns/frame", "allocs/frame");
+    measure("readPrefixed", total, batch, framesPerBatch,
+            [](Socket& socket) { return checksum(socket.readPrefixed<std::uint32_t>()); });
+    measure("viewExact", total, batch, framesPerBatch,
+            [](const Socket& socket)
+            {
+                std::uint32_t length = 0;
+                std::memcpy(&length, socket.viewExact(sizeof(length)).data(), sizeof(length));
+                const std::size_t frameSize = sizeof(length) + net::fromNetwork(length);
+                const std::size_t sum = checksum(socket.viewExact(frameSize).substr(sizeof(length)));
+                socket.consume(frameSize);
+                return sum;
+            });
+    return 0;
+}
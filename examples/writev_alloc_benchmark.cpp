@@ -0,0 +1,166 @@
+//
+// Vectored-write benchmark: heap allocations and time per 64-fragment message sent with Socket::writevAll().
+//
+// Usage: writev_alloc_benchmark [messages] [fragments] [fragment-bytes]
+//
+// A reader thread drains a loopback connection while the main thread sends the same message, split into many
+// small fragments, over and over. The "copying" row repeats the previous writevAll() algorithm on the same socket
+// (copy the span into a vector, build a std::vector<iovec> per writev() call, erase sent fragments from the front);
+// the "writevAll" row is the library call, which converts on the stack and advances in place. Allocations are
+// counted by replacing the global operator new.
+//
+
+#include <jsocketpp/ServerSocket.hpp>
+#include <jsocketpp/Socket.hpp>
+#include <jsocketpp/SocketInitializer.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+using namespace jsocketpp;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+} // namespace
+
+void* operator new(const std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+
+#ifndef _WIN32
+// writevAll() as it was: per-call vector copy of the span, vector<iovec> per writev(), erase from the front
+std::size_t copyingWritevAll(const Socket& socket, const std::span<const std::string_view> buffers)
+{
+    std::vector remaining(buffers.begin(), buffers.end());
+    std::size_t total = 0;
+    while (!remaining.empty())
+    {
+        std::vector<iovec> iovecs;
+        iovecs.reserve(remaining.size());
+        for (const auto& buf : remaining)
+            iovecs.push_back({const_cast<char*>(buf.data()), buf.size()});
+
+        const ssize_t sent = ::writev(socket.getSocketFd(), iovecs.data(), static_cast<int>(iovecs.size()));
+        if (sent < 0)
+            throw SocketException(GetSocketError());
+        total += static_cast<std::size_t>(sent);
+
+        std::size_t left = static_cast<std::size_t>(sent);
+        std::size_t advanced = 0;
+        while (advanced < remaining.size() && left >= remaining[advanced].size())
+            left -= remaining[advanced++].size();
+        remaining.erase(remaining.begin(), remaining.begin() + static_cast<std::ptrdiff_t>(advanced));
+        if (!remaining.empty() && left > 0)
+            remaining[0] = remaining[0].substr(left);
+    }
+    return total;
+}
+#endif
+
+template <typename Send>
+void measure(const char* label, const std::size_t messages, const std::vector<std::string_view>& fragments,
+             Send send)
+{
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    client.setTcpNoDelay(true); // many small writes; don't let Nagle's algorithm wait for delayed ACKs
+
+    std::thread reader(
+        [&peer]
+        {
+            std::array<char, 256 * 1024> sink{};
+            try
+            {
+                while (peer.readInto(sink.data(), sink.size()) > 0)
+                {
+                }
+            }
+            catch (const SocketException&)
+            {
+            }
+        });
+
+    const std::size_t before = allocations.load();
+    const auto start = Clock::now();
+    std::string error;
+    try
+    {
+        for (std::size_t i = 0; i < messages; ++i)
+            send(client, std::span<const std::string_view>(fragments));
+    }
+    catch (const SocketException& e)
+    {
+        error = e.what(); // e.g. EINVAL from writev() with more than IOV_MAX entries
+    }
+    const auto elapsed = Clock::now() - start;
+    const std::size_t allocated = allocations.load() - before;
+
+    client.shutdown(ShutdownMode::Write);
+    reader.join();
+
+    if (!error.empty())
+    {
+        std::printf("%-10s failed: %s\n", label, error.c_str());
+        return;
+    }
+    std::printf("%-10s %12.1f %14.2f\n", label,
+                std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(messages),
+                static_cast<double>(allocated) / static_cast<double>(messages));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t messages = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 200'000;
+    const std::size_t count = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : 64;
+    const std::size_t fragmentBytes = argc > 3 ? static_cast<std::size_t>(std::atoi(argv[3])) : 32;
+
+    SocketInitializer init;
+    const std::string payload(count * fragmentBytes, 'x');
+    std::vector<std::string_view> fragments;
+    for (std::size_t i = 0; i < count; ++i)
+        fragments.emplace_back(payload.data() + i * fragmentBytes, fragmentBytes);
+
+    std::printf("%zu messages of %zu x %zu-byte fragments\n", messages, count, fragmentBytes);
+    std::printf("%-10s %12s %14s\n", "writer", "ns/message", "allocs/message");
+#ifndef _WIN32
+    measure("copying", messages, fragments, copyingWritevAll);
+#endif
+    measure("writevAll", messages, fragments,
+            [](const Socket& socket, const std::span<const std::string_view> buffers)
+            { return socket.writevAll(buffers); });
+    return 0;
+}
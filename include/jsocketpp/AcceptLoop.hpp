@@ -0,0 +1,199 @@
+/**
+ * @file AcceptLoop.hpp
+ * @brief Event-driven accept loop that hands connections to a bounded worker pool.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "Selector.hpp"
+#include "ServerSocket.hpp"
+#include "Socket.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace jsocketpp
+{
+
+/**
+ * @struct AcceptLoopOptions
+ * @brief Tuning knobs for `AcceptLoop`: pool sizing, back-pressure and accepted-socket configuration.
+ * @ingroup reactor
+ *
+ * The socket configuration fields have the same meaning and defaults as the parameters of
+ * `ServerSocket::accept()`.
+ */
+struct AcceptLoopOptions
+{
+    /// Number of worker threads running the handler. `0` runs the handler on the accept thread itself,
+    /// which suits handlers that only register the socket with another `Selector`.
+    std::size_t workerThreads = std::thread::hardware_concurrency();
+
+    /// Maximum number of accepted connections waiting for a worker. When reached, the loop stops accepting
+    /// and further clients wait in the kernel's listen backlog.
+    std::size_t maxQueuedConnections = 1024;
+
+    std::optional<std::size_t> recvBufferSize = std::nullopt;     ///< `SO_RCVBUF` of accepted sockets.
+    std::optional<std::size_t> sendBufferSize = std::nullopt;     ///< `SO_SNDBUF` of accepted sockets.
+    std::optional<std::size_t> internalBufferSize = std::nullopt; ///< Internal read buffer of accepted sockets.
+    int soRecvTimeoutMillis = -1;                                 ///< `SO_RCVTIMEO`; `-1` disables.
+    int soSendTimeoutMillis = -1;                                 ///< `SO_SNDTIMEO`; `-1` disables.
+    bool tcpNoDelay = true;                                       ///< `TCP_NODELAY` on accepted sockets.
+    bool keepAlive = false;                                       ///< `SO_KEEPALIVE` on accepted sockets.
+    bool nonBlocking = false;                                     ///< Accepted sockets start non-blocking.
+};
+
+/**
+ * @class AcceptLoop
+ * @ingroup reactor
+ * @brief Accepts connections on a `ServerSocket` from one event-driven thread and dispatches them to a pool.
+ *
+ * `AcceptLoop` replaces patterns such as calling `ServerSocket::acceptAsync()` in a loop, which accepts one
+ * connection per call and runs every callback on its single accept thread. It puts the listener in
+ * non-blocking mode, waits for it with a `Selector`, and on each readiness notification drains **all** pending
+ * connections (using `accept4()` with `SOCK_CLOEXEC`/`SOCK_NONBLOCK` on Linux). Accepted sockets are queued to
+ * a fixed-size worker pool, or run inline on the accept thread when `workerThreads` is `0`.
+ *
+ * ### Back-pressure
+ * At most `maxQueuedConnections` sockets wait for a worker. When the queue is full the loop stops calling
+ * `accept()` until a worker frees a slot, leaving new clients in the kernel backlog instead of consuming
+ * descriptors and memory without bound.
+ *
+ * ### Errors
+ * Transient accept failures (`ECONNABORTED`, `EINTR`, `EPROTO`) are skipped. Other failures and exceptions
+ * thrown by the handler are passed to the optional error handler. On descriptor or memory exhaustion
+ * (`EMFILE`, `ENFILE`, `ENOBUFS`, `ENOMEM`) the loop backs off for 10 ms so that a persistent condition does
+ * not spin a core.
+ *
+ * ### Shutdown
+ * `stop()` (also called by the destructor) stops accepting, wakes the loop, lets running handlers finish,
+ * joins all threads, and closes connections that were accepted but not yet handed to a worker. The
+ * `ServerSocket` is left open, back in blocking mode if it was blocking before, and must outlive the
+ * `AcceptLoop`.
+ *
+ * ### Example
+ * @code{.cpp}
+ * ServerSocket server(8080);
+ * AcceptLoop loop(server, [](Socket client) {
+ *     client.writeAll(client.readLine());
+ * });
+ * // ...
+ * loop.stop();
+ * @endcode
+ *
+ * @warning Do not call `accept()` or related methods on the same `ServerSocket` while an `AcceptLoop` runs.
+ *
+ * @see AcceptLoopOptions
+ * @see Selector
+ * @see ServerSocket::acceptNonBlocking()
+ */
+class AcceptLoop
+{
+  public:
+    /// @brief Invoked once per accepted connection; receives ownership of the socket.
+    using Handler = std::function<void(Socket)>;
+
+    /// @brief Invoked with accept failures and exceptions escaping the handler.
+    using ErrorHandler = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @brief Starts accepting on `server` immediately.
+     *
+     * @param[in,out] server Bound and listening server socket. It is non-blocking until `stop()`.
+     * @param[in] handler Connection handler, called from a worker thread (or the accept thread, see options).
+     * @param[in] options Pool sizing, queue bound and accepted-socket configuration.
+     * @param[in] onError Optional error sink; if empty, errors are dropped.
+     *
+     * @throws SocketException If `server` is not listening, `handler` is empty, or the selector or threads
+     *         cannot be created.
+     */
+    AcceptLoop(ServerSocket& server, Handler handler, AcceptLoopOptions options = {}, ErrorHandler onError = {});
+
+    /**
+     * @brief Stops the loop and joins all threads. See `stop()`.
+     */
+    ~AcceptLoop() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; the loop owns threads.
+     */
+    AcceptLoop(const AcceptLoop&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; the loop owns threads.
+     */
+    AcceptLoop& operator=(const AcceptLoop&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; running threads refer to this object.
+     */
+    AcceptLoop(AcceptLoop&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; running threads refer to this object.
+     */
+    AcceptLoop& operator=(AcceptLoop&&) = delete;
+
+    /**
+     * @brief Cancels accepting and shuts the pool down cleanly.
+     *
+     * Blocks until running handlers return. Queued connections that no worker has picked up are closed
+     * without invoking the handler. A listener that was blocking before the loop started is made blocking
+     * again. Idempotent.
+     *
+     * When called from inside a handler, the calling worker is not joined (it cannot join itself); it exits
+     * once the handler returns, and the destructor must then run on another thread.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief `true` until `stop()` is called.
+     */
+    [[nodiscard]] bool isRunning() const noexcept { return !_stopping.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Total number of connections accepted since construction.
+     */
+    [[nodiscard]] std::uint64_t acceptedCount() const noexcept { return _accepted.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of accepted connections currently waiting for a worker.
+     */
+    [[nodiscard]] std::size_t queuedCount() const;
+
+  private:
+    void run();
+    void drain();
+    void workerMain();
+    void dispatch(Socket client) noexcept;
+    void reportError(std::exception_ptr error) noexcept;
+
+    ServerSocket& _server;                     ///< Listener; not owned.
+    Handler _handler;                          ///< Connection handler.
+    ErrorHandler _onError;                     ///< Optional error sink.
+    AcceptLoopOptions _options;                ///< Configuration fixed at construction.
+    Selector _selector{8};                     ///< Waits for listener readiness and `stop()` wakeups.
+    mutable std::mutex _mutex{};               ///< Guards `_queue`.
+    std::condition_variable _notEmpty{};       ///< Signalled when a connection is queued or on stop.
+    std::condition_variable _notFull{};        ///< Signalled when a worker dequeues or on stop.
+    std::deque<Socket> _queue{};               ///< Accepted connections awaiting a worker.
+    std::atomic<bool> _stopping{false};        ///< Set once by `stop()`.
+    std::atomic<std::uint64_t> _accepted{0};   ///< Connections accepted so far.
+    std::vector<std::thread> _workers{};       ///< Handler threads.
+    std::thread _acceptThread{};               ///< Runs `run()`.
+    bool _restoreBlocking = false;             ///< Whether `stop()` puts the listener back into blocking mode.
+};
+
+} // namespace jsocketpp
@@ -0,0 +1,150 @@
+/**
+ * @file BufferPool.hpp
+ * @brief Size-classed pool of receive buffers shared by many sockets.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace jsocketpp
+{
+
+/**
+ * @class BufferPool
+ * @ingroup core
+ * @brief Hands out receive buffers to sockets only while they hold unread data.
+ *
+ * A `Socket` needs its internal read buffer only between receiving bytes and handing them to the caller; an idle
+ * connection, or one whose reads are always drained completely, needs none. Sockets therefore borrow a block
+ * from a pool when a buffered read begins and give it back as soon as the buffer is empty, so memory scales with
+ * the number of connections that have data in flight rather than with the number of open connections.
+ *
+ * ### Size classes
+ * Requests are rounded up to a power of two between `MinBlockSize` and `MaxBlockSize`, and each class keeps a
+ * free list of returned blocks. Larger requests bypass the pool. At most `maxCachedBytes` are kept on the free
+ * lists; blocks returned beyond that are freed.
+ *
+ * ### Thread Safety
+ * All member functions are thread-safe. Each size class has its own lock, held only for a free-list push or pop.
+ * `global()` additionally keeps one block of each class per thread in front of the locked free lists, so a thread
+ * that keeps filling and draining a buffer of the same size takes no lock at all. Those blocks count towards
+ * `cachedBytes()` and go back to the shared free lists when their thread exits.
+ *
+ * @see global(), Socket::setReceiveBufferPool()
+ */
+class BufferPool
+{
+  public:
+    static constexpr std::size_t MinBlockSize = 1024;        ///< Smallest block handed out.
+    static constexpr std::size_t MaxBlockSize = 1024 * 1024; ///< Largest pooled block; larger requests bypass it.
+
+    /**
+     * @brief Creates an empty pool.
+     * @param[in] maxCachedBytes Upper bound on the memory kept on free lists.
+     */
+    explicit BufferPool(std::size_t maxCachedBytes = 16 * 1024 * 1024) noexcept;
+
+    /**
+     * @brief Frees the cached blocks.
+     *
+     * Every borrowed block must have been released by now, i.e. the pool must outlive the sockets using it. Debug
+     * builds check this with `assert()`.
+     */
+    ~BufferPool() noexcept;
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool(BufferPool&&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+
+    /**
+     * @brief The process-wide pool used by sockets unless told otherwise.
+     *
+     * Never destroyed, so sockets with static storage duration may return blocks to it during shutdown, and
+     * threads may keep per-thread blocks of it until they exit.
+     */
+    [[nodiscard]] static BufferPool& global() noexcept;
+
+    /**
+     * @brief Borrows a block of at least @p size bytes.
+     * @param[in] size Requested size; must be greater than zero.
+     * @return Block of `blockSize(size)` bytes, uninitialized.
+     * @throws std::bad_alloc If the free list is empty and allocation fails.
+     */
+    [[nodiscard]] char* acquire(std::size_t size);
+
+    /**
+     * @brief Returns a block obtained from `acquire()`.
+     * @param[in] block The block.
+     * @param[in] size  The size passed to `acquire()`.
+     */
+    void release(char* block, std::size_t size) noexcept;
+
+    /**
+     * @brief Size of the block `acquire(size)` hands out.
+     */
+    [[nodiscard]] static std::size_t blockSize(std::size_t size) noexcept;
+
+    /**
+     * @brief Bytes currently borrowed from this pool.
+     */
+    [[nodiscard]] std::size_t outstandingBytes() const noexcept
+    {
+        return _outstanding.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Bytes kept on the free lists for reuse.
+     */
+    [[nodiscard]] std::size_t cachedBytes() const noexcept { return _cached.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Frees every cached block, except those other threads keep for `global()`.
+     */
+    void trim() noexcept;
+
+  private:
+    static constexpr std::size_t Classes = 11; ///< Powers of two from `MinBlockSize` to `MaxBlockSize`.
+
+    /// @brief A cached block; the link is stored in the block itself.
+    struct FreeBlock
+    {
+        FreeBlock* next; ///< Next cached block of the same class.
+    };
+
+    /// @brief Free list of one block size.
+    struct SizeClass
+    {
+        std::mutex mutex{};        ///< Guards `head`.
+        FreeBlock* head = nullptr; ///< Most recently returned block.
+    };
+
+    /// @brief Blocks of `global()` kept by one thread, one per size class; defined in BufferPool.cpp.
+    struct ThreadCache;
+
+    std::array<SizeClass, Classes> _classes{}; ///< Free lists, smallest blocks first.
+    std::size_t _maxCachedBytes;               ///< Bound on `_cached`.
+    std::atomic<std::size_t> _cached{0};       ///< Bytes on the free lists and in thread caches.
+    std::atomic<std::size_t> _outstanding{0};  ///< Bytes handed out and not yet returned.
+    bool _threadCached = false;                ///< Whether the thread caches are used; only for `global()`.
+
+    /**
+     * @brief The calling thread's cache of `global()` blocks.
+     * @return The cache, or `nullptr` once the thread has started destroying its thread-local objects.
+     */
+    [[nodiscard]] static ThreadCache* threadCache() noexcept;
+
+    /// @brief Pushes @p block onto the free list of class @p index; the block is already counted in `_cached`.
+    void push(std::size_t index, void* block) noexcept;
+};
+
+} // namespace jsocketpp
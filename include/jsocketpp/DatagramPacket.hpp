@@ -7,7 +7,9 @@
 
 #include "common.hpp"
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace jsocketpp
@@ -38,6 +40,19 @@ namespace jsocketpp
  * - For receiving: use an empty `DatagramPacket` with a pre-sized buffer; after `read`, the address/port
  *   will be filled in.
  *
+ * ### Memory
+ * `buffer` and `address` allocate from a `std::pmr::memory_resource` given at construction (the default resource
+ * otherwise), so a packet can live entirely in a per-request arena. The class is allocator-aware: elements of a
+ * `std::pmr::vector<DatagramPacket>` use the vector's resource.
+ * @code
+ * std::array<std::byte, 64 * 1024> storage;
+ * std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size());
+ * std::pmr::vector<DatagramPacket> batch(&arena);
+ * batch.resize(16); // 16 packets whose buffers are allocated from storage
+ * for (auto& packet : batch)
+ *     packet.resize(1024);
+ * @endcode
+ *
  * @see jsocketpp::DatagramSocket
  *
  * @author MangaD
@@ -47,20 +62,23 @@ namespace jsocketpp
 class DatagramPacket
 {
   public:
+    /// @brief Allocator of `buffer` and `address`; makes the packet allocator-aware for `std::pmr` containers.
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
     /**
      * @brief Data buffer for the packet payload.
      *
      * - On sending: Contains the data to transmit.
      * - On receiving: Filled with received data (size indicates bytes received).
      */
-    std::vector<char> buffer;
+    std::pmr::vector<char> buffer;
 
     /**
      * @brief Remote address (IPv4/IPv6) for the destination/source.
      * - On send: set to the destination address.
      * - On receive: will be filled with sender's address.
      */
-    std::string address{};
+    std::pmr::string address;
 
     /**
      * @brief Remote UDP port for the destination/source.
@@ -71,18 +89,29 @@ class DatagramPacket
 
     /**
      * @brief Construct an empty DatagramPacket with a specified buffer size.
-     * @param size Initial size of the internal buffer (default: 0).
+     * @param size  Initial size of the internal buffer (default: 0).
+     * @param alloc Allocator for the buffer and address (default: `std::pmr::get_default_resource()`).
+     */
+    explicit DatagramPacket(const size_t size = 0, const allocator_type& alloc = {})
+        : buffer(size, alloc), address(alloc)
+    {
+    }
+
+    /**
+     * @brief Construct an empty DatagramPacket whose storage comes from @p alloc.
+     * @param alloc Allocator for the buffer and address.
      */
-    explicit DatagramPacket(const size_t size = 0) : buffer(size) {}
+    explicit DatagramPacket(const allocator_type& alloc) : DatagramPacket(0, alloc) {}
 
     /**
      * @brief Construct a DatagramPacket from a string_view and destination info.
      * @param data     Data to be copied into the packet buffer.
      * @param addr     Destination address.
      * @param prt      Destination UDP port.
+     * @param alloc    Allocator for the buffer and address.
      */
-    DatagramPacket(std::string_view data, std::string addr, const Port prt)
-        : buffer(data.begin(), data.end()), address(std::move(addr)), port(prt)
+    DatagramPacket(std::string_view data, std::string_view addr, const Port prt, const allocator_type& alloc = {})
+        : buffer(data.begin(), data.end(), alloc), address(addr, alloc), port(prt)
     {
     }
 
@@ -93,17 +122,36 @@ class DatagramPacket
      * @param len      Number of bytes to copy.
      * @param addr     Destination address.
      * @param prt      Destination UDP port.
+     * @param alloc    Allocator for the buffer and address.
      */
-    DatagramPacket(const char* data, const size_t len, std::string addr, const Port prt)
-        : buffer(data, data + len), address(std::move(addr)), port(prt)
+    DatagramPacket(const char* data, const size_t len, std::string_view addr, const Port prt,
+                   const allocator_type& alloc = {})
+        : buffer(data, data + len, alloc), address(addr, alloc), port(prt)
     {
     }
 
-    // Default copy and move constructors/operators.
+    // Default copy and move constructors/operators. Copies use the default resource, as with any std::pmr type.
     DatagramPacket(const DatagramPacket&) = default;
     DatagramPacket(DatagramPacket&&) noexcept = default;
     DatagramPacket& operator=(const DatagramPacket&) = default;
-    DatagramPacket& operator=(DatagramPacket&&) noexcept = default;
+    DatagramPacket& operator=(DatagramPacket&&) = default; // copies when the two resources differ
+
+    /// @brief Allocator-extended copy constructor.
+    DatagramPacket(const DatagramPacket& other, const allocator_type& alloc)
+        : buffer(other.buffer, alloc), address(other.address, alloc), port(other.port)
+    {
+    }
+
+    /// @brief Allocator-extended move constructor; copies when @p alloc differs from the source's.
+    DatagramPacket(DatagramPacket&& other, const allocator_type& alloc)
+        : buffer(std::move(other.buffer), alloc), address(std::move(other.address), alloc), port(other.port)
+    {
+    }
+
+    /**
+     * @brief Allocator used by `buffer` and `address`.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return buffer.get_allocator(); }
 
     /**
      * @brief Resize the packet's internal buffer.
@@ -12,17 +12,28 @@
 #include "common.hpp"
 #include "DatagramPacket.hpp"
 #include "detail/buffer_traits.hpp"
+#include "Endpoint.hpp"
+#include "IoResult.hpp"
 #include "SocketOptions.hpp"
 
+#include <array>
 #include <atomic>
 #include <bit>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <optional>
 #include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace jsocketpp
 {
 
+class IoService;
+
 /**
  * @brief Receive-time sizing policy for UDP datagrams.
  * @ingroup udp
@@ -667,7 +678,8 @@ class DatagramSocket : public SocketOptions
           _haveRemoteAddr(rhs._haveRemoteAddr.load(std::memory_order_relaxed)), _localAddr(rhs._localAddr),
           _localAddrLen(rhs._localAddrLen), _haveLocalAddr(rhs._haveLocalAddr.load(std::memory_order_relaxed)),
           _internalBuffer(std::move(rhs._internalBuffer)), _port(rhs._port), _isBound(rhs._isBound),
-          _isConnected(rhs._isConnected)
+          _isConnected(rhs._isConnected), _destinationCache(std::move(rhs._destinationCache)),
+          _destinationCacheCapacity(rhs._destinationCacheCapacity), _destinationCacheTtl(rhs._destinationCacheTtl)
     {
         rhs.cleanup();
     }
@@ -738,6 +750,9 @@ class DatagramSocket : public SocketOptions
             _port = rhs._port;
             _isBound = rhs._isBound;
             _isConnected = rhs._isConnected;
+            _destinationCache = std::move(rhs._destinationCache);
+            _destinationCacheCapacity = rhs._destinationCacheCapacity;
+            _destinationCacheTtl = rhs._destinationCacheTtl;
 
             // Reset source
             rhs.cleanup();
@@ -893,7 +908,7 @@ class DatagramSocket : public SocketOptions
      * - Resolves @p host + @p port to a linked list of address candidates (IPv6 and/or IPv4).
      * - Iterates **all** candidates in order until one succeeds.
      * - If @p timeoutMillis ≥ 0, temporarily switches the socket to non-blocking mode and uses
-     *   `select()` to wait for writability, respecting a **single overall** timeout budget across
+     *   `poll()` to wait for writability, respecting a **single overall** timeout budget across
      *   all candidates (not per-candidate).
      * - On success, caches the local endpoint (via `getsockname()`), sets `_isBound = true`
      *   (if it wasn’t already), and marks the socket as connected.
@@ -915,7 +930,7 @@ class DatagramSocket : public SocketOptions
      *         - If called when already connected.
      *         - If name resolution yields no candidates.
      *         - If a candidate fails synchronously (and other candidates also fail), or if
-     *           `select()`/`getsockopt(SO_ERROR)` reports an error. The exception carries
+     *           `poll()`/`getsockopt(SO_ERROR)` reports an error. The exception carries
      *           `GetSocketError()` and `SocketErrorMessage(GetSocketError())`.
      * @throws SocketTimeoutException
      *         - If the connection does not complete within @p timeoutMillis across all
@@ -924,13 +939,10 @@ class DatagramSocket : public SocketOptions
      *
      * @par Notes
      * - The total elapsed time across candidate attempts will not exceed @p timeoutMillis.
-     * - On Windows and POSIX, writability after `select()` is not a guarantee of success; this
+     * - On Windows and POSIX, writability is not a guarantee of success; this
      *   method checks `SO_ERROR` to confirm or retrieve the per-candidate failure code.
-     * - If you routinely connect with timeouts, consider replacing `select()` with a `poll()`-based
-     *   wait to avoid `FD_SETSIZE` constraints.
-     *
-     * @warning When @p timeoutMillis ≥ 0 and `getSocketFd() >= FD_SETSIZE`, `select()` cannot be used
-     *          and this function throws a `SocketException` before attempting the connection.
+     * - The wait uses `ppoll()`/`poll()`/`WSAPoll()` and a `steady_clock` deadline, so it works for
+     *   descriptors of any value and is unaffected by wall-clock adjustments.
      *
      * @note Thread-safety: intended for the socket’s owning thread. Do not call concurrently with
      *       `close()` or other operations that mutate connection state.
@@ -1648,9 +1660,8 @@ class DatagramSocket : public SocketOptions
      *    (zero-length UDP datagrams are valid, but this implementation skips the syscall).
      * 3. Enforces protocol-level maxima for the connected peer’s family via
      *    `enforceSendCapConnected(total)` to preempt guaranteed `EMSGSIZE`.
-     * 4. Sends in a **single** syscall:
-     *    - Fast path: if there is exactly one fragment, it is sent directly.
-     *    - Otherwise, the fragments are coalesced into a temporary contiguous buffer and sent once.
+     * 4. Sends in a **single** `sendmsg()`/`WSASendTo()` call that gathers the fragments in place; the payload
+     *    is never copied into a temporary buffer.
      *
      * This function does **not** pre-wait for writability. On non-blocking sockets, if the send
      * buffer is full, the send may fail (e.g., `EWOULDBLOCK` / `WSAEWOULDBLOCK`) and a
@@ -1673,9 +1684,6 @@ class DatagramSocket : public SocketOptions
      *   - **System (OS error + `SocketErrorMessage(...)`):** send failures such as
      *     `EWOULDBLOCK`, `ENOBUFS`, `ENETUNREACH`, `EHOSTUNREACH`, etc.
      *
-     * @note If you later add a scatter/gather `internal::sendExactv(...)`, this method can switch
-     *       to a vectored send to avoid the temporary copy in the multi-fragment case.
-     *
      * @since 1.0
      *
      * @see writevAll(std::span<const std::string_view>), write(std::string_view),
@@ -1707,9 +1715,8 @@ class DatagramSocket : public SocketOptions
      *    `enforceSendCapConnected(total)` to preempt guaranteed `EMSGSIZE`.
      * 4. Calls `waitReady(Direction::Write, -1)` to wait **without timeout** until the socket is writable
      *    (poll errors are surfaced as `SocketException`).
-     * 5. Sends in a **single** syscall:
-     *    - Fast path: if there is exactly one fragment, it is sent directly.
-     *    - Otherwise, the fragments are coalesced into a temporary contiguous buffer and sent once.
+     * 5. Sends in a **single** `sendmsg()`/`WSASendTo()` call that gathers the fragments in place; the payload
+     *    is never copied into a temporary buffer.
      *
      * **Atomicity:** UDP is message-oriented; on success, the *entire* concatenated payload is sent as a
      * single datagram. On exception, no bytes are considered transmitted.
@@ -1731,8 +1738,6 @@ class DatagramSocket : public SocketOptions
      *
      * @note This method never throws `SocketTimeoutException` because it waits indefinitely. For a bounded
      *       wait, use `writeWithTimeout()`.
-     * @note If you later add a scatter/gather `internal::sendExactv(...)`, this method can switch to a
-     *       vectored send to avoid the temporary copy in the multi-fragment case.
      *
      * @since 1.0
      *
@@ -1942,6 +1947,55 @@ class DatagramSocket : public SocketOptions
      */
     void write(const DatagramPacket& packet);
 
+    /**
+     * @brief Sends several datagrams with as few system calls as possible.
+     * @ingroup udp
+     *
+     * Equivalent to calling `write(const DatagramPacket&)` for each packet in order, but on Linux the packets
+     * are handed to the kernel with `sendmmsg()`, up to 64 per system call. This removes most of the
+     * per-datagram syscall overhead for high packet-rate senders.
+     *
+     * Each packet follows the `write(const DatagramPacket&)` rules: packets with a destination are sent to
+     * `packet.address:packet.port`, packets without one go to the connected peer, and empty packets are
+     * skipped. Destinations are resolved once per run of consecutive packets addressed to the same host and
+     * port, so a batch aimed at a single peer costs one resolution.
+     *
+     * @param[in] packets Datagrams to send, in order.
+     * @return Number of packets sent (empty packets included), which is `packets.size()` unless an exception
+     *         interrupts the batch.
+     *
+     * @throws SocketException Under the same conditions as `write(const DatagramPacket&)`. Packets before the
+     *         failing one have already been sent.
+     *
+     * @note On platforms without `sendmmsg()` this is a loop over `write(const DatagramPacket&)`.
+     *
+     * @see readBatch(), write(const DatagramPacket&)
+     */
+    std::size_t writeBatch(std::span<const DatagramPacket> packets);
+
+    /**
+     * @brief Sends `data` to the connected peer as consecutive datagrams of `segmentSize` bytes.
+     * @ingroup udp
+     *
+     * The buffer is cut into datagrams of exactly `segmentSize` bytes; the last one carries the remainder and may
+     * be shorter. On Linux (kernel 4.18+) the cut is done by the kernel through UDP generic segmentation offload
+     * (`UDP_SEGMENT`): each `sendmsg()` passes up to 64 segments, so the protocol stack is traversed once per
+     * super-packet instead of once per datagram, and NICs with UDP segmentation offload split it in hardware.
+     *
+     * If the kernel or the egress device rejects GSO, or on other platforms, the remaining segments are sent one
+     * `send()` at a time. The receiver sees the same datagrams either way.
+     *
+     * @param[in] data Payload to split and send.
+     * @param[in] segmentSize Size of every datagram except possibly the last. Must be non-zero and fit the peer's
+     *                        UDP limit; keep it within the path MTU, as GSO never fragments.
+     *
+     * @throws SocketException If the socket is not open or not connected, `segmentSize` is invalid, or a send
+     *         fails. Segments before the failing send have been transmitted.
+     *
+     * @see readSegments(), writeBatch()
+     */
+    void writeSegmented(std::string_view data, std::size_t segmentSize) const;
+
     /**
      * @brief Send one unconnected UDP datagram to (host, port) from text bytes (no pre-wait).
      * @ingroup udp
@@ -2088,6 +2142,95 @@ class DatagramSocket : public SocketOptions
      */
     void writeTo(std::string_view host, Port port, std::span<const std::byte> data);
 
+    /**
+     * @brief Sends one datagram to a pre-resolved endpoint.
+     * @ingroup udp
+     *
+     * Skips name resolution and the destination cache entirely: the datagram goes to the kernel with the
+     * stored address. Use this for fixed destinations on hot paths (telemetry, metrics, game state).
+     *
+     * @param[in] destination Resolved destination, e.g. from `Endpoint::resolve()`.
+     * @param[in] message Payload; empty messages are skipped.
+     *
+     * @throws SocketException If the socket is not open, @p destination is empty, the payload exceeds the UDP
+     *         limit of the endpoint's address family, or the send fails.
+     *
+     * @see Endpoint, writeTo(std::string_view, Port, std::string_view)
+     */
+    void writeTo(const Endpoint& destination, std::string_view message);
+
+    /**
+     * @brief Sends one datagram of raw bytes to a pre-resolved endpoint.
+     * @ingroup udp
+     * @see writeTo(const Endpoint&, std::string_view)
+     */
+    void writeTo(const Endpoint& destination, std::span<const std::byte> data);
+
+    /**
+     * @brief Sends one datagram, the concatenation of @p buffers, to (host, port) without connecting.
+     * @ingroup udp
+     *
+     * The unconnected counterpart of `writev()`: fragments are passed to the kernel as a scatter-gather list, so
+     * a header and a payload held in separate buffers go out as one datagram without being copied together.
+     * Resolution, the destination cache and size limits behave as in `writeTo(std::string_view, Port,
+     * std::string_view)`. An all-empty fragment list sends nothing.
+     *
+     * @param[in] host    Destination hostname or numeric address.
+     * @param[in] port    Destination UDP port.
+     * @param[in] buffers Fragments forming the payload, in order; individual elements may be empty.
+     *
+     * @throws SocketException If the socket is not open, no address family can carry the payload, or the send
+     *         fails.
+     *
+     * @code
+     * const std::array<std::string_view, 2> parts{header, body};
+     * sock.writevTo("198.51.100.7", 9000, parts);
+     * @endcode
+     *
+     * @see writev(std::span<const std::string_view>), writevTo(const Endpoint&, std::span<const std::string_view>)
+     */
+    void writevTo(std::string_view host, Port port, std::span<const std::string_view> buffers);
+
+    /**
+     * @brief Sends one datagram, the concatenation of @p buffers, to a pre-resolved endpoint.
+     * @ingroup udp
+     *
+     * @throws SocketException If the socket is not open, @p destination is empty, the payload exceeds the UDP
+     *         limit of the endpoint's address family, or the send fails.
+     *
+     * @see writevTo(std::string_view, Port, std::span<const std::string_view>), writeTo(const Endpoint&,
+     *      std::string_view)
+     */
+    void writevTo(const Endpoint& destination, std::span<const std::string_view> buffers);
+
+    /**
+     * @brief Delivers datagrams and their source addresses through @p io until error or cancellation.
+     * @ingroup udp
+     *
+     * Shorthand for `io.asyncReceiveFrom(*this, handler)`; see `IoService::asyncReceiveFrom()` for truncation
+     * and callback rules. The socket must outlive the operation.
+     *
+     * @return Operation identifier for `IoService::cancel()`.
+     * @throws SocketException If the socket is closed, already has a receive operation, or the request cannot
+     *         be queued.
+     */
+    std::uint64_t
+    asyncReceiveFrom(IoService& io,
+                     std::function<void(std::span<const char>, const DatagramReadResult&, std::exception_ptr)> handler)
+        const;
+
+    /**
+     * @brief Sends each buffer as one datagram, in order, through @p io on a connected socket.
+     * @ingroup udp
+     *
+     * Shorthand for `io.asyncSendChain(*this, buffers, handler)`.
+     *
+     * @return Operation identifier for `IoService::cancel()`.
+     * @throws SocketException If the socket is closed or the request cannot be queued.
+     */
+    std::uint64_t asyncSendChain(IoService& io, std::vector<std::string> buffers,
+                                 std::function<void(std::size_t, std::exception_ptr)> handler = {}) const;
+
     /**
      * @brief Send one unconnected UDP datagram to (host, port) containing the raw bytes of @p value.
      * @ingroup udp
@@ -2254,6 +2397,124 @@ class DatagramSocket : public SocketOptions
      */
     DatagramReadResult read(DatagramPacket& packet, const DatagramReadOptions& opts) const;
 
+    /**
+     * @brief Receives up to `packets.size()` datagrams in one call.
+     * @ingroup udp
+     *
+     * On Linux the datagrams are received with `recvmmsg()` (up to 64 per system call). The call blocks, subject
+     * to the socket's timeout and blocking mode, until at least one datagram is available, then returns every
+     * datagram already queued, up to the number of packets given. It never waits for the batch to fill.
+     *
+     * For each received datagram `i`, `packets[i].buffer` holds the payload and, if `results` is large enough,
+     * `results[i]` reports `bytes`, `datagramSize`, `truncated` and the raw source address (`src`, `srcLen`).
+     * @p opts is applied per packet as in `read(DatagramPacket&, const DatagramReadOptions&)`:
+     * - `allowGrow`: an empty packet buffer is sized to `DefaultDatagramReceiveSize` first; without it, an
+     *   empty buffer is an error.
+     * - `allowShrink`: buffers are shrunk to the received size (never on truncation).
+     * - `resolveNumeric`: `packets[i].address` and `packets[i].port` are set to the sender.
+     * - `updateLastRemote`: the "last remote" becomes the sender of the last datagram of the batch.
+     * - `recvFlags`: passed through to the kernel.
+     * - `errorOnTruncate`: the whole batch is received, every packet and result filled, and then a
+     *   `SocketException` is thrown if any datagram was truncated.
+     *
+     * Batches cannot probe the size of each queued datagram, so `DatagramReceiveMode::PreflightSize` is not
+     * applied and `allowGrow` never enlarges a non-empty buffer. Give each packet the capacity of the largest
+     * expected datagram instead.
+     *
+     * @param[in,out] packets Receive buffers; entries past the returned count are left untouched.
+     * @param[in]     opts    Read policy, as above.
+     * @param[out]    results Optional per-datagram telemetry; may be shorter than @p packets or empty.
+     * @return Number of datagrams received (at least 1).
+     *
+     * @throws SocketTimeoutException If no datagram arrives before the receive timeout, or the socket is
+     *         non-blocking and nothing is queued.
+     * @throws SocketException On receive errors, an empty buffer without `allowGrow`, or truncation with
+     *         `errorOnTruncate`.
+     *
+     * @par Example
+     * @code{.cpp}
+     * std::vector<DatagramPacket> batch(32, DatagramPacket(2048));
+     * DatagramReadOptions ro{};
+     * ro.errorOnTruncate = false;
+     * ro.allowShrink = false; // keep capacities for the next batch
+     * const std::size_t n = sock.readBatch(batch, ro);
+     * for (std::size_t i = 0; i < n; ++i)
+     *     handle(batch[i]);
+     * @endcode
+     *
+     * @note On platforms without `recvmmsg()` this is a loop over `read(DatagramPacket&, ...)` that stops as soon
+     *       as no further datagram is pending.
+     *
+     * @see writeBatch(), read(DatagramPacket&, const DatagramReadOptions&)
+     */
+    std::size_t readBatch(std::span<DatagramPacket> packets, const DatagramReadOptions& opts = {},
+                          std::span<DatagramReadResult> results = {}) const;
+
+    /**
+     * @brief Receives one datagram, or one GRO-coalesced group of datagrams, and splits it into logical datagrams.
+     * @ingroup udp
+     *
+     * With UDP generic receive offload enabled (`setUdpGro(true)`, Linux 5.0+), the kernel may deliver several
+     * datagrams from the same sender in one receive, announcing their common size in a `UDP_GRO` control message.
+     * This method performs a single `recvmsg()` and fills @p segments with one view into @p buffer per datagram:
+     * all have the announced size except possibly the last. Without coalescing, @p segments holds a single view.
+     *
+     * The returned result describes the whole receive: `bytes` and `datagramSize` are totals over all segments,
+     * and `src`/`srcLen` the sender they share. `recvFlags`, `updateLastRemote` and `errorOnTruncate` (checked after
+     * the receive) apply as for `readInto()`; size preflight is never performed.
+     *
+     * @param[out] buffer Receive buffer. Coalesced groups can reach 64 KiB; a smaller buffer truncates them.
+     * @param[out] segments Cleared, then filled with views into @p buffer. Reuse the vector across calls to
+     *                      avoid allocation.
+     * @param[in] opts Read options, as above.
+     * @return Totals and sender of the receive.
+     *
+     * @throws SocketTimeoutException If no datagram arrives before the receive timeout, or the socket is
+     *         non-blocking and nothing is queued.
+     * @throws SocketException On receive errors, an empty buffer, or truncation with `errorOnTruncate`.
+     *
+     * @par Example
+     * @code{.cpp}
+     * sock.setUdpGro(true);
+     * std::vector<char> buf(65536);
+     * std::vector<std::span<const char>> datagrams;
+     * sock.readSegments(buf, datagrams);
+     * for (const auto d : datagrams)
+     *     handle(d);
+     * @endcode
+     *
+     * @note On platforms without GRO this is a single `readInto()` that yields one segment.
+     *
+     * @see writeSegmented(), setUdpGro()
+     */
+    DatagramReadResult readSegments(std::span<char> buffer, std::vector<std::span<const char>>& segments,
+                                    const DatagramReadOptions& opts = {}) const;
+
+#if defined(__linux__)
+    /**
+     * @brief Enables or disables UDP generic receive offload (`UDP_GRO`) on this socket.
+     * @ingroup udp
+     *
+     * When enabled, the kernel may merge consecutive same-size datagrams from one sender into a single receive,
+     * which `readSegments()` splits back into datagrams. Other read methods would return such a group as one
+     * large payload, so use `readSegments()` exclusively while GRO is on.
+     *
+     * @throws SocketException If the kernel does not support `UDP_GRO` (Linux < 5.0) or the call fails.
+     *
+     * @note Linux only; this method is not compiled on other platforms.
+     * @see getUdpGro(), readSegments()
+     */
+    void setUdpGro(bool enable);
+
+    /**
+     * @brief Returns whether `UDP_GRO` is enabled on this socket.
+     * @ingroup udp
+     * @throws SocketException If the option cannot be queried.
+     * @see setUdpGro()
+     */
+    [[nodiscard]] bool getUdpGro() const;
+#endif
+
     /**
      * @brief Read one UDP datagram into a caller-provided buffer with explicit truncation policy.
      * @ingroup udp
@@ -2370,6 +2631,48 @@ class DatagramSocket : public SocketOptions
      */
     [[nodiscard]] DatagramReadResult readInto(std::span<char> out, const DatagramReadOptions& opts = {}) const;
 
+    /**
+     * @brief Non-throwing single-datagram read for readiness loops, reported as an `IoResult`.
+     * @ingroup udp
+     *
+     * One plain `recv()`: no size preflight, no sender bookkeeping, no allocation and no exceptions. Use it on
+     * non-blocking sockets where most attempts would block; use the `DatagramReadResult` overload when you need
+     * truncation reporting or the sender address.
+     *
+     * @param[out] buffer Destination for the payload.
+     * @param[in] len Capacity of @p buffer in bytes.
+     * @return `Ok` with the payload size (0 for an empty datagram, or if @p buffer is null or @p len is 0),
+     *         `WouldBlock` if no datagram is queued, or `Error` with the native code. Never `Closed`.
+     *
+     * @note A datagram larger than @p len is truncated to @p len bytes and the rest discarded on POSIX; Windows
+     *       reports it as `Error` with `WSAEMSGSIZE`.
+     *
+     * @see readInto(void*, std::size_t, const DatagramReadOptions&), IoResult
+     */
+    [[nodiscard]] IoResult tryReadInto(void* buffer, std::size_t len) const noexcept;
+
+    /**
+     * @brief Non-throwing single-datagram read that also reports truncation and the sender.
+     * @ingroup udp
+     *
+     * One `recvmsg()` (`recvfrom()` on Windows), retried on `EINTR`; no size preflight, no allocation and no
+     * exceptions. The throwing reads (`read()`, `readInto()`, ...) are built on it.
+     *
+     * @param[out] buffer Destination for the payload.
+     * @param[in] len Capacity of @p buffer in bytes.
+     * @param[out] info Reset, then on success filled in: `bytes` copied, `truncated` if the datagram was larger
+     *             than @p len (`MSG_TRUNC`, or `WSAEMSGSIZE` on Windows), `datagramSize` (the full size on Linux,
+     *             otherwise `bytes` unless truncated, 0 if unknown), and the sender in `src`/`srcLen`.
+     * @param[in] recvFlags Extra flags for the receive call (e.g. `MSG_PEEK`).
+     * @return `Ok` with the bytes copied (0 for an empty datagram, or if @p buffer is null or @p len is 0),
+     *         `WouldBlock` if no datagram is queued or `SO_RCVTIMEO` expired, or `Error` with the native code.
+     *         A truncated datagram is `Ok`. Never `Closed`.
+     *
+     * @see tryReadInto(void*, std::size_t), DatagramReadResult, IoResult
+     */
+    [[nodiscard]] IoResult tryReadInto(void* buffer, std::size_t len, DatagramReadResult& info,
+                                       int recvFlags = 0) const noexcept;
+
     /**
      * @brief Read one UDP datagram into a dynamically resizable, contiguous byte container (zero-copy into caller
      * storage).
@@ -3863,6 +4166,30 @@ class DatagramSocket : public SocketOptions
      */
     void setInternalBufferSize(std::size_t newLen);
 
+    /**
+     * @brief Configures the cache of resolved destinations used by `writeTo(host, port, ...)`.
+     * @ingroup udp
+     *
+     * Unconnected sends to a host name resolve it with `getaddrinfo()`, which typically costs far more than the
+     * send itself. The socket therefore remembers, per `(host, port)`, the address that last worked, for up to
+     * @p ttl. When more than @p capacity destinations are in use, the entry closest to expiry is replaced.
+     * Numeric IP literals never reach the resolver nor the cache; they are parsed in place.
+     *
+     * Defaults: 16 entries, 30 seconds.
+     *
+     * @param[in] capacity Maximum number of cached destinations; `0` disables caching.
+     * @param[in] ttl How long a resolution stays valid. Entries are not refreshed by use.
+     *
+     * @see clearDestinationCache(), writeTo(const Endpoint&, std::string_view)
+     */
+    void setDestinationCache(std::size_t capacity, std::chrono::milliseconds ttl);
+
+    /**
+     * @brief Forgets all cached destination resolutions.
+     * @ingroup udp
+     */
+    void clearDestinationCache() noexcept { _destinationCache.clear(); }
+
     /**
      * @brief Closes the datagram socket and releases its underlying system resources.
      * @ingroup udp
@@ -4429,7 +4756,7 @@ class DatagramSocket : public SocketOptions
             if (::getpeername(getSocketFd(), reinterpret_cast<sockaddr*>(&peer), &len) == SOCKET_ERROR)
             {
                 const int err = GetSocketError();
-                throw SocketException(err, SocketErrorMessage(err));
+                throw SocketException(err);
             }
             family = reinterpret_cast<const sockaddr*>(&peer)->sa_family;
         }
@@ -4502,6 +4829,45 @@ class DatagramSocket : public SocketOptions
      */
     void sendUnconnectedTo(std::string_view host, Port port, const void* data, std::size_t len);
 
+    /**
+     * @brief Scatter-gather form of `sendUnconnectedTo()`: sends the concatenation of @p buffers as one datagram.
+     * @ingroup udp
+     */
+    void sendUnconnectedTo(std::string_view host, Port port, std::span<const std::string_view> buffers);
+
+    /**
+     * @brief Sends one datagram to a resolved address and records it as the last remote.
+     * @ingroup udp
+     *
+     * Marks the socket bound after its first send (the kernel assigns an ephemeral port) and, on unconnected
+     * sockets, updates the endpoint reported by `getRemoteIp()`/`getRemotePort()`. Does not check size limits.
+     *
+     * @throws SocketException If the send fails.
+     */
+    void sendToEndpoint(const Endpoint& destination, const void* data, std::size_t len);
+
+    /**
+     * @brief Scatter-gather form of `sendToEndpoint()`.
+     * @ingroup udp
+     */
+    void sendToEndpoint(const Endpoint& destination, std::span<const std::string_view> buffers);
+
+    /**
+     * @brief Records a successful resolution in the destination cache, honouring its capacity.
+     * @ingroup udp
+     */
+    void cacheDestination(std::string_view host, Port port, const Endpoint& endpoint,
+                          std::chrono::steady_clock::time_point now);
+
+    /// @brief Resolution remembered by the destination cache.
+    struct CachedDestination
+    {
+        std::string host{};                             ///< Host name as passed by the caller.
+        Port port = 0;                                  ///< Destination port.
+        Endpoint endpoint{};                            ///< Address that was last sent to successfully.
+        std::chrono::steady_clock::time_point expiry{}; ///< End of validity.
+    };
+
     /**
      * @brief View a textual buffer as raw bytes without copying.
      * @ingroup udp
@@ -4621,7 +4987,7 @@ class DatagramSocket : public SocketOptions
      *  2) encodes the prefix via `encodeLengthPrefixBE<T>(payload.size())`;
      *  3) computes `total = sizeof(T) + payload.size()` and enforces the connected peer’s
      *     protocol maxima via `enforceSendCapConnected(total)` (prevents guaranteed `EMSGSIZE`);
-     *  4) coalesces `[prefix|payload]` into one contiguous buffer and performs **one** send.
+     *  4) gathers `[prefix|payload]` with scatter-gather I/O and performs **one** send.
      *
      * This function does **not** poll for writability. On non-blocking sockets, if the send
      * buffer is temporarily full, the underlying send may fail (e.g., `EWOULDBLOCK` /
@@ -4679,14 +5045,11 @@ class DatagramSocket : public SocketOptions
 
         enforceSendCapConnected(total);
 
-        // Coalesce [prefix | payload] into one datagram and send once.
-        std::vector<std::byte> datagram(total);
-        std::memcpy(datagram.data(), prefix.data(), sizeof(T));
-        if (n != 0)
-        {
-            std::memcpy(datagram.data() + sizeof(T), payload.data(), n);
-        }
-        internal::sendExact(getSocketFd(), datagram.data(), datagram.size());
+        // Gather [prefix | payload] into one datagram without copying the payload.
+        const std::array<std::string_view, 2> parts{
+            std::string_view(reinterpret_cast<const char*>(prefix.data()), sizeof(T)),
+            std::string_view(reinterpret_cast<const char*>(payload.data()), n)};
+        internal::sendExactv(getSocketFd(), parts);
     }
 
     /**
@@ -4707,7 +5070,7 @@ class DatagramSocket : public SocketOptions
      * Processing steps:
      *  1) Verify socket is **open**.
      *  2) Encode prefix via `encodeLengthPrefixBE<T>(payload.size())` (validates that size fits in `T`).
-     *  3) Coalesce `[prefix|payload]` once and dispatch through `sendUnconnectedTo(host, port, ...)`.
+     *  3) Gather `[prefix|payload]` (no copy) and dispatch through `sendUnconnectedTo(host, port, ...)`.
      *
      * Zero-length payloads are valid: a datagram containing only the prefix is sent.
      *
@@ -4756,16 +5119,12 @@ class DatagramSocket : public SocketOptions
 
         const std::size_t n = payload.size();
         const auto prefix = encodeLengthPrefixBE<T>(n);
-        const std::size_t total = sizeof(T) + n;
 
-        // Build once; family skipping & send are handled inside sendUnconnectedTo().
-        std::vector<std::byte> datagram(total);
-        std::memcpy(datagram.data(), prefix.data(), sizeof(T));
-        if (n != 0)
-        {
-            std::memcpy(datagram.data() + sizeof(T), payload.data(), n);
-        }
-        sendUnconnectedTo(host, port, datagram.data(), datagram.size());
+        // Family skipping & send are handled inside sendUnconnectedTo(); the payload is gathered, not copied.
+        const std::array<std::string_view, 2> parts{
+            std::string_view(reinterpret_cast<const char*>(prefix.data()), sizeof(T)),
+            std::string_view(reinterpret_cast<const char*>(payload.data()), n)};
+        sendUnconnectedTo(host, port, parts);
     }
 
     /**
@@ -4863,6 +5222,9 @@ class DatagramSocket : public SocketOptions
     Port _port;                        ///< Port number the socket is bound to (if applicable).
     bool _isBound = false;             ///< True if the socket is bound to an address
     bool _isConnected = false;         ///< True if the socket is connected to a remote host.
+    std::vector<CachedDestination> _destinationCache{};    ///< Resolved `writeTo()` destinations.
+    std::size_t _destinationCacheCapacity = 16;            ///< Maximum entries in `_destinationCache`.
+    std::chrono::milliseconds _destinationCacheTtl{30000}; ///< Lifetime of a cached resolution.
 };
 
 } // namespace jsocketpp
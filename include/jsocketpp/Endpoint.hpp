@@ -0,0 +1,140 @@
+/**
+ * @file Endpoint.hpp
+ * @brief Pre-resolved socket address for repeated sends without name resolution.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace jsocketpp
+{
+
+/**
+ * @class Endpoint
+ * @ingroup core
+ * @brief A resolved IP address and port, ready to be passed to the kernel as-is.
+ *
+ * Sending to `"host", port` resolves the name on every call. An `Endpoint` performs that work once, so that
+ * hot send paths such as `DatagramSocket::writeTo(const Endpoint&, std::string_view)` go straight to `sendto()`.
+ *
+ * ### Creating Endpoints
+ * - `Endpoint::parse()`: numeric IPv4/IPv6 literals only; never touches DNS, never blocks.
+ * - `Endpoint::resolve()`: numeric literals are parsed directly; anything else goes through `getaddrinfo()`.
+ * - The `(const sockaddr*, socklen_t)` constructor wraps an address obtained elsewhere (e.g. `recvfrom()`).
+ *
+ * ### Example
+ * @code{.cpp}
+ * const Endpoint collector = Endpoint::resolve("metrics.internal", 8125);
+ * DatagramSocket sock;
+ * for (const auto& line : lines)
+ *     sock.writeTo(collector, line);
+ * @endcode
+ *
+ * @note An `Endpoint` is a snapshot: it does not follow later DNS changes. Resolve again to refresh it.
+ *
+ * @see DatagramSocket::writeTo(const Endpoint&, std::string_view)
+ */
+class Endpoint
+{
+  public:
+    /**
+     * @brief Creates an empty endpoint (`isValid() == false`).
+     */
+    Endpoint() noexcept = default;
+
+    /**
+     * @brief Copies a raw socket address.
+     * @param[in] addr IPv4 or IPv6 address.
+     * @param[in] len Length of @p addr in bytes.
+     * @throws SocketException If @p addr is null or @p len does not fit in `sockaddr_storage`.
+     */
+    Endpoint(const sockaddr* addr, socklen_t len);
+
+    /**
+     * @brief Parses a numeric IPv4 or IPv6 literal without name resolution.
+     *
+     * Accepts dotted-quad IPv4 (`"192.0.2.1"`) and IPv6 text (`"2001:db8::1"`, `"fe80::1%eth0"`).
+     *
+     * @return The endpoint, or `std::nullopt` if @p host is not a numeric address.
+     */
+    [[nodiscard]] static std::optional<Endpoint> parse(std::string_view host, Port port) noexcept;
+
+    /**
+     * @brief Resolves a host name or numeric address to its first UDP-capable address.
+     *
+     * Numeric literals take the `parse()` fast path; other names are resolved with `getaddrinfo()`, which
+     * may block.
+     *
+     * @param[in] host Host name or numeric address.
+     * @param[in] port Destination port.
+     * @param[in] family `AF_UNSPEC` (default), `AF_INET` or `AF_INET6` to restrict the result.
+     * @throws SocketException If resolution fails.
+     */
+    [[nodiscard]] static Endpoint resolve(std::string_view host, Port port, int family = AF_UNSPEC);
+
+    /**
+     * @brief `true` if the endpoint holds an address.
+     */
+    [[nodiscard]] bool isValid() const noexcept { return _len > 0; }
+
+    /**
+     * @brief Address family (`AF_INET`, `AF_INET6`), or `AF_UNSPEC` when empty.
+     */
+    [[nodiscard]] int getFamily() const noexcept { return _len > 0 ? _addr.ss_family : AF_UNSPEC; }
+
+    /**
+     * @brief Raw address for system calls.
+     */
+    [[nodiscard]] const sockaddr* data() const noexcept { return reinterpret_cast<const sockaddr*>(&_addr); }
+
+    /**
+     * @brief Length of the raw address in bytes.
+     */
+    [[nodiscard]] socklen_t size() const noexcept { return _len; }
+
+    /**
+     * @brief Raw address as `sockaddr_storage`.
+     */
+    [[nodiscard]] const sockaddr_storage& storage() const noexcept { return _addr; }
+
+    /**
+     * @brief Numeric IP address of the endpoint.
+     * @param[in] convertIPv4Mapped Report IPv4-mapped IPv6 addresses in IPv4 form.
+     * @throws SocketException If the endpoint is empty.
+     */
+    [[nodiscard]] std::string getIp(bool convertIPv4Mapped = true) const;
+
+    /**
+     * @brief Port of the endpoint, in host byte order.
+     * @throws SocketException If the endpoint is empty.
+     */
+    [[nodiscard]] Port getPort() const;
+
+    /**
+     * @brief `"ip:port"` (IPv4) or `"[ip]:port"` (IPv6).
+     * @throws SocketException If the endpoint is empty.
+     */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @brief Byte-wise comparison of family, address and port.
+     */
+    friend bool operator==(const Endpoint& lhs, const Endpoint& rhs) noexcept
+    {
+        return lhs._len == rhs._len && std::memcmp(&lhs._addr, &rhs._addr, lhs._len) == 0;
+    }
+
+  private:
+    sockaddr_storage _addr{}; ///< Address bytes; only the first `_len` are meaningful.
+    socklen_t _len = 0;       ///< Length of the address; 0 when empty.
+};
+
+} // namespace jsocketpp
@@ -0,0 +1,346 @@
+/**
+ * @file EventLoop.hpp
+ * @brief Single-threaded coroutine scheduler and awaitable socket operations.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "DatagramSocket.hpp"
+#include "Selector.hpp"
+#include "ServerSocket.hpp"
+#include "Socket.hpp"
+#include "SocketTimeoutException.hpp"
+#include "Task.hpp"
+#include "TimerWheel.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace jsocketpp
+{
+
+/**
+ * @class EventLoop
+ * @ingroup reactor
+ * @brief Runs coroutine sessions on one thread, resuming each when its socket becomes ready.
+ *
+ * `EventLoop` lets straight-line session code replace thread-per-connection designs: each session is a
+ * `Task<void>` that suspends in `co_await` instead of blocking, so thousands of sessions share one thread
+ * and each costs a coroutine frame (typically a few hundred bytes) rather than a thread stack.
+ *
+ * Sessions are started with `spawn()` and driven by `run()` or `runOnce()`. The awaitable operations
+ * (`asyncReadInto()`, `asyncReadUntil()`, `asyncWriteAll()`, `asyncAccept()`, ...) first try the non-blocking
+ * system call and only suspend when it would block, waiting on a `Selector` for readiness.
+ *
+ * ### Example
+ * @code{.cpp}
+ * Task<void> echo(EventLoop& loop, Socket client) {
+ *     while (true)
+ *         co_await asyncWriteAll(loop, client, co_await asyncReadUntil(loop, client, "\n"));
+ * }
+ *
+ * Task<void> serve(EventLoop& loop, ServerSocket& server) {
+ *     while (true)
+ *         loop.spawn(echo(loop, co_await asyncAccept(loop, server)));
+ * }
+ *
+ * EventLoop loop;
+ * ServerSocket server(8080);
+ * loop.spawn(serve(loop, server));
+ * loop.run();
+ * @endcode
+ *
+ * ### Errors
+ * An exception escaping a spawned task is passed to the error handler given at construction. Without a
+ * handler it is rethrown from `runOnce()`/`run()` after the task has been destroyed.
+ *
+ * ### Timers
+ * Operation timeouts and `sleepFor()` are kept in a `TimerWheel`, so arming, re-arming and cancelling them is
+ * O(1) however many coroutines are waiting. The same wheel is available through `timers()` for per-connection
+ * deadlines (idle, read or write) whose callbacks run on the loop thread.
+ *
+ * @note Not thread-safe, except for `stop()`. Sockets are switched to non-blocking mode by the awaitable
+ *       operations. At most one coroutine may wait for reading and one for writing on a given socket.
+ *
+ * @see Task
+ * @see Selector
+ */
+class EventLoop
+{
+  public:
+    /// @brief Receives exceptions escaping spawned tasks.
+    using ErrorHandler = std::function<void(std::exception_ptr)>;
+
+    /// @brief Clock used for timeouts and `sleepFor()`.
+    using Clock = TimerWheel::Clock;
+
+    class ReadinessAwaiter;
+
+    /**
+     * @brief Creates an idle loop.
+     * @param[in] onError Optional sink for exceptions escaping spawned tasks.
+     * @throws SocketException If the underlying `Selector` cannot be created.
+     */
+    explicit EventLoop(ErrorHandler onError = {});
+
+    /**
+     * @brief Destroys all unfinished tasks without resuming them.
+     */
+    ~EventLoop() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; suspended coroutines refer to this object.
+     */
+    EventLoop(const EventLoop&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; suspended coroutines refer to this object.
+     */
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; suspended coroutines refer to this object.
+     */
+    EventLoop(EventLoop&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; suspended coroutines refer to this object.
+     */
+    EventLoop& operator=(EventLoop&&) = delete;
+
+    /**
+     * @brief Takes ownership of a task and schedules it to start on the next `runOnce()`.
+     */
+    void spawn(Task<void> task);
+
+    /**
+     * @brief Runs until every spawned task has finished or `stop()` is called.
+     * @throws Any exception escaping a task when no error handler is installed.
+     */
+    void run();
+
+    /**
+     * @brief Resumes ready coroutines, then waits for socket readiness or a timer and resumes those.
+     *
+     * @param[in] timeoutMillis Maximum wait in milliseconds; `-1` waits until something is ready.
+     * @return Number of coroutine resumptions and `timers()` callbacks run.
+     * @throws SocketException If waiting fails.
+     */
+    std::size_t runOnce(int timeoutMillis = -1);
+
+    /**
+     * @brief Makes `run()` return after the current iteration. Safe to call from any thread.
+     *
+     * A call made while `run()` is not running makes the next `run()` return before resuming anything.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Number of spawned tasks that have not finished.
+     */
+    [[nodiscard]] std::size_t taskCount() const noexcept { return _tasks.size(); }
+
+    /**
+     * @brief The loop's timer wheel, for deadlines that are not tied to a single `co_await`.
+     *
+     * Timers armed here fire from `runOnce()`, on the loop thread, and keep `runOnce()` from sleeping past their
+     * deadline. A typical use is a connection idle timeout that is pushed back after every transfer and shuts the
+     * socket down when it expires, which wakes any coroutine waiting on it:
+     *
+     * @code{.cpp}
+     * Task<void> session(EventLoop& loop, Socket client) {
+     *     TimerWheel::Timer idle([&] { client.shutdown(ShutdownMode::Both); });
+     *     char buf[4096];
+     *     while (true) {
+     *         loop.timers().scheduleAfter(idle, std::chrono::seconds(30));
+     *         const std::size_t n = co_await asyncReadInto(loop, client, buf, sizeof(buf));
+     *         if (n == 0)
+     *             co_return; // peer closed, or idle for 30 s
+     *         co_await asyncWriteAll(loop, client, std::string_view(buf, n));
+     *     }
+     * }
+     * @endcode
+     *
+     * Timers must be cancelled or destroyed before the loop is destroyed.
+     */
+    [[nodiscard]] TimerWheel& timers() noexcept { return _timers; }
+
+    /**
+     * @brief Suspends until `socket` is readable (or has an error or hang-up).
+     * @param[in] timeoutMillis Maximum wait; `-1` waits indefinitely.
+     * @throws SocketTimeoutException From `co_await` if the timeout expires first.
+     */
+    [[nodiscard]] ReadinessAwaiter readable(const SocketOptions& socket, int timeoutMillis = -1);
+
+    /**
+     * @brief Suspends until `socket` is writable (or has an error or hang-up).
+     * @param[in] timeoutMillis Maximum wait; `-1` waits indefinitely.
+     * @throws SocketTimeoutException From `co_await` if the timeout expires first.
+     */
+    [[nodiscard]] ReadinessAwaiter writable(const SocketOptions& socket, int timeoutMillis = -1);
+
+    /**
+     * @brief Suspends the calling coroutine for `duration` without blocking the loop.
+     */
+    [[nodiscard]] ReadinessAwaiter sleepFor(std::chrono::milliseconds duration);
+
+    /**
+     * @class ReadinessAwaiter
+     * @brief Awaitable returned by `readable()`, `writable()` and `sleepFor()`.
+     *
+     * Lives in the awaiting coroutine's frame. If that frame is destroyed while suspended, the wait is
+     * withdrawn from the loop.
+     */
+    class ReadinessAwaiter
+    {
+      public:
+        ~ReadinessAwaiter();
+        ReadinessAwaiter(const ReadinessAwaiter&) = delete;
+        ReadinessAwaiter& operator=(const ReadinessAwaiter&) = delete;
+        ReadinessAwaiter(ReadinessAwaiter&&) = delete;
+        ReadinessAwaiter& operator=(ReadinessAwaiter&&) = delete;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const;
+
+      private:
+        friend class EventLoop;
+
+        ReadinessAwaiter(EventLoop& loop, SOCKET fd, bool forWrite, int timeoutMillis) noexcept
+            : _loop(&loop), _fd(fd), _forWrite(forWrite), _timeoutMillis(timeoutMillis)
+        {
+        }
+
+        EventLoop* _loop;                  ///< Owning loop.
+        SOCKET _fd;                        ///< Awaited socket; `INVALID_SOCKET` for timers.
+        bool _forWrite;                    ///< Direction of the wait.
+        int _timeoutMillis;                ///< Relative timeout; `-1` for none.
+        bool _waiting = false;             ///< Registered with the loop.
+        bool _timedOut = false;            ///< Resumed by the timer, not by readiness.
+        std::coroutine_handle<> _handle{}; ///< Suspended coroutine.
+        TimerWheel::Timer _timer{};        ///< Timeout, armed on `EventLoop::_timers` while waiting.
+    };
+
+  private:
+    /// @brief Coroutines waiting on one descriptor.
+    struct Waiters
+    {
+        ReadinessAwaiter* reader = nullptr; ///< Waiting for readability.
+        ReadinessAwaiter* writer = nullptr; ///< Waiting for writability.
+    };
+
+    static void onTaskDone(void* context, std::coroutine_handle<> handle) noexcept;
+
+    void addWaiter(ReadinessAwaiter& awaiter);
+    void removeWaiter(ReadinessAwaiter& awaiter) noexcept;
+    void updateInterest(SOCKET fd);
+    void resume(ReadinessAwaiter& awaiter, bool timedOut);
+    void reapFinished();
+    [[nodiscard]] int nextTimeout(int timeoutMillis) const;
+
+    ErrorHandler _onError;                            ///< Optional sink for task exceptions.
+    Selector _selector{};                             ///< Readiness source.
+    std::unordered_set<void*> _tasks{};               ///< Frames of spawned, unfinished tasks.
+    std::vector<std::coroutine_handle<>> _ready{};    ///< Spawned tasks not yet started.
+    std::vector<std::coroutine_handle<>> _finished{}; ///< Completed tasks awaiting destruction.
+    std::unordered_map<SOCKET, Waiters> _waiters{};   ///< Per-descriptor waiting coroutines.
+    TimerWheel _timers{};                             ///< Timeouts and user timers.
+    std::exception_ptr _pendingError{};               ///< Task exception to rethrow.
+    std::atomic<bool> _stopped{false};                ///< Set by `stop()`.
+};
+
+/**
+ * @defgroup awaitables Awaitable Socket Operations
+ * @ingroup reactor
+ * @brief Coroutine versions of the blocking socket calls, driven by an `EventLoop`.
+ *
+ * Each operation switches the socket to non-blocking mode, tries the corresponding `Socket`,
+ * `ServerSocket` or `DatagramSocket` call, and suspends on the loop whenever it would block. `timeoutMillis`
+ * bounds the whole operation (not each wait); `-1` disables it, and expiry throws
+ * `SocketTimeoutException`. Arguments passed by reference or view must stay valid until the returned task
+ * completes.
+ */
+
+/**
+ * @brief Reads up to `len` bytes, like `Socket::readInto()`.
+ * @ingroup awaitables
+ * @return Bytes read; `0` at end of stream.
+ */
+Task<std::size_t> asyncReadInto(EventLoop& loop, Socket& socket, void* buffer, std::size_t len,
+                                int timeoutMillis = -1);
+
+/**
+ * @brief Reads exactly `n` bytes, like `Socket::readExact()`.
+ * @ingroup awaitables
+ * @throws SocketException If the connection closes first.
+ */
+Task<std::string> asyncReadExact(EventLoop& loop, Socket& socket, std::size_t n, int timeoutMillis = -1);
+
+/**
+ * @brief Reads up to and including `delimiter`, like `Socket::readUntil(std::string_view, ...)`.
+ * @ingroup awaitables
+ */
+Task<std::string> asyncReadUntil(EventLoop& loop, Socket& socket, std::string_view delimiter,
+                                 std::size_t maxLen = 8192, bool includeDelimiter = true, int timeoutMillis = -1);
+
+/**
+ * @brief Writes all of `message`, like `Socket::writeAll()`.
+ * @ingroup awaitables
+ * @return Bytes written (`message.size()`).
+ */
+Task<std::size_t> asyncWriteAll(EventLoop& loop, Socket& socket, std::string_view message, int timeoutMillis = -1);
+
+/**
+ * @brief Writes all buffers in order with vectored writes, like `Socket::writevAll()`.
+ * @ingroup awaitables
+ * @return Total bytes written.
+ */
+Task<std::size_t> asyncWritevAll(EventLoop& loop, Socket& socket, std::span<const std::string_view> buffers,
+                                 int timeoutMillis = -1);
+
+/**
+ * @brief Accepts one connection, like `ServerSocket::accept()`.
+ * @ingroup awaitables
+ *
+ * The accepted socket uses the server's default buffer sizes and is already non-blocking. Transient accept
+ * failures (a client aborting before being accepted) are retried.
+ */
+Task<Socket> asyncAccept(EventLoop& loop, ServerSocket& server, int timeoutMillis = -1);
+
+/**
+ * @brief Connects a socket created with `autoConnect = false`, like `Socket::connect(int)`.
+ * @ingroup awaitables
+ * @see Socket::beginConnect(), Socket::finishConnect()
+ */
+Task<void> asyncConnect(EventLoop& loop, Socket& socket, int timeoutMillis = -1);
+
+/**
+ * @brief Receives one datagram into `buffer`, like `DatagramSocket::readInto(std::span<char>, ...)`.
+ * @ingroup awaitables
+ */
+Task<DatagramReadResult> asyncRead(EventLoop& loop, DatagramSocket& socket, std::span<char> buffer,
+                                   DatagramReadOptions options = {}, int timeoutMillis = -1);
+
+/**
+ * @brief Sends one datagram, like `DatagramSocket::writeTo(std::string_view, Port, std::string_view)`.
+ * @ingroup awaitables
+ * @note Host name resolution, if `host` is not numeric, still blocks the loop.
+ */
+Task<void> asyncWriteTo(EventLoop& loop, DatagramSocket& socket, std::string_view host, Port port,
+                        std::string_view message, int timeoutMillis = -1);
+
+} // namespace jsocketpp
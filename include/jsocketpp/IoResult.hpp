@@ -0,0 +1,101 @@
+/**
+ * @file IoResult.hpp
+ * @brief Non-throwing outcome of a single socket transfer, used by the `try*` I/O methods.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "SocketException.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jsocketpp
+{
+
+/**
+ * @brief How a single non-throwing socket transfer ended.
+ * @ingroup core
+ */
+enum class IoStatus : std::uint8_t
+{
+    Ok,         ///< Bytes were transferred (or nothing was requested)
+    WouldBlock, ///< The operation would block (`EAGAIN`/`EWOULDBLOCK`, or `SO_RCVTIMEO`/`SO_SNDTIMEO` expired)
+    Closed,     ///< The peer performed an orderly shutdown (stream reads only)
+    Error       ///< Any other failure; see `IoResult::error`
+};
+
+/**
+ * @brief Result of a `try*` I/O call: bytes transferred, would-block, end of stream or an error code.
+ * @ingroup core
+ *
+ * The throwing I/O methods report every failure, including `EAGAIN` on non-blocking sockets, as a
+ * `SocketException`, which formats an error message and unwinds the stack. In readiness-driven loops, where most
+ * attempts would block, that costs more than the system call. The `try*` methods return this plain value instead:
+ * no allocation, no exceptions, and the throwing methods are built on top of them.
+ *
+ * ### Example
+ * @code{.cpp}
+ * char buf[4096];
+ * for (;;)
+ * {
+ *     const IoResult r = socket.tryReadInto(buf, sizeof(buf));
+ *     if (r.wouldBlock())
+ *         break; // wait for readiness
+ *     if (r.closed())
+ *         return;
+ *     consume(buf, r.valueOrThrow());
+ * }
+ * @endcode
+ *
+ * @see Socket::tryReadInto(), Socket::tryWrite(), DatagramSocket::tryReadInto()
+ */
+struct IoResult
+{
+    std::size_t bytes = 0;          ///< Bytes transferred; 0 unless `status == IoStatus::Ok`
+    IoStatus status = IoStatus::Ok; ///< Outcome of the call
+    int error = 0;                  ///< Native error code for `WouldBlock` and `Error`, otherwise 0
+
+    /**
+     * @brief Builds the result for a failed system call, classifying would-block error codes.
+     * @param[in] errorCode Value of `GetSocketError()` after the call.
+     * @return A `WouldBlock` or `Error` result carrying @p errorCode.
+     */
+    [[nodiscard]] static IoResult failure(const int errorCode) noexcept
+    {
+#ifdef _WIN32
+        const bool wouldBlock = internal::isWouldBlock(errorCode) || errorCode == WSAETIMEDOUT;
+#else
+        const bool wouldBlock = internal::isWouldBlock(errorCode);
+#endif
+        return {0, wouldBlock ? IoStatus::WouldBlock : IoStatus::Error, errorCode};
+    }
+
+    /// @brief Builds the end-of-stream result.
+    [[nodiscard]] static IoResult endOfStream() noexcept { return {0, IoStatus::Closed, 0}; }
+
+    [[nodiscard]] bool ok() const noexcept { return status == IoStatus::Ok; }
+    [[nodiscard]] bool wouldBlock() const noexcept { return status == IoStatus::WouldBlock; }
+    [[nodiscard]] bool closed() const noexcept { return status == IoStatus::Closed; }
+    [[nodiscard]] explicit operator bool() const noexcept { return ok(); }
+
+    /**
+     * @brief Returns `bytes`, or throws what the throwing I/O methods would have thrown.
+     *
+     * `Closed` is not an error here and yields 0, matching `Socket::readInto()`.
+     *
+     * @throws SocketException For `WouldBlock` and `Error`, carrying `error` and its system message.
+     */
+    std::size_t valueOrThrow() const
+    {
+        if (status == IoStatus::WouldBlock || status == IoStatus::Error)
+            throw SocketException(error);
+        return bytes;
+    }
+};
+
+} // namespace jsocketpp
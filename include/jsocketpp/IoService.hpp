@@ -0,0 +1,299 @@
+/**
+ * @file IoService.hpp
+ * @brief Completion-based asynchronous I/O engine (io_uring on Linux, `Selector` fallback elsewhere).
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "DatagramSocket.hpp"
+#include "Selector.hpp"
+#include "ServerSocket.hpp"
+#include "Socket.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jsocketpp
+{
+
+/**
+ * @enum IoBackend
+ * @brief Engine actually used by an `IoService` instance.
+ * @ingroup reactor
+ */
+enum class IoBackend : std::uint8_t
+{
+    IoUring, ///< Linux io_uring (library built with `ENABLE_IO_URING=ON`, kernel 6.3 or newer).
+    Reactor  ///< Readiness-based emulation on top of `Selector` (`epoll` on Linux, `poll()`/`WSAPoll()` elsewhere).
+};
+
+/**
+ * @struct IoServiceOptions
+ * @brief Sizing parameters for an `IoService`.
+ * @ingroup reactor
+ */
+struct IoServiceOptions
+{
+    unsigned queueDepth = 256;       ///< Submission queue entries (io_uring), 1-32768; rounded up to a power of two.
+    unsigned bufferCount = 256;      ///< Receive buffers shared by all receive operations; power of two.
+    std::size_t bufferSize = 4096;   ///< Size of each receive buffer in bytes (max payload per callback).
+    unsigned fixedFileSlots = 1024;  ///< Capacity of the registered-file table (`registerFixedFile()`).
+    bool forceReactor = false;       ///< Use the `Reactor` backend even when io_uring is available.
+};
+
+/**
+ * @class IoService
+ * @ingroup reactor
+ * @brief Completion-based asynchronous accept, receive and send for `ServerSocket`, `Socket` and `DatagramSocket`.
+ *
+ * An `IoService` runs asynchronous operations on the thread that calls `runOnce()`. Operations are started
+ * with the `async*()` methods and report through callbacks, in the style of `ServerSocket::acceptAsync()`.
+ * The socket classes expose the same operations as members taking the service (`Socket::asyncReceive()`,
+ * `Socket::asyncSendChain()`, `ServerSocket::asyncAcceptMultishot()`, `DatagramSocket::asyncReceiveFrom()`,
+ * `DatagramSocket::asyncSendChain()`), which forward here.
+ *
+ * ### io_uring backend
+ * When the library is configured with `-DENABLE_IO_URING=ON` and the kernel is 6.3 or newer, operations map
+ * directly to io_uring requests. Each `runOnce()` call submits all queued requests and reaps all completions
+ * with a single `io_uring_enter()`:
+ * - `asyncAcceptMultishot()`: one multishot `IORING_OP_ACCEPT` yields every incoming connection
+ * - `asyncReceive()` / `asyncReceiveFrom()`: multishot `RECV`/`RECVMSG` that draw from a provided-buffer
+ *   ring, so no memory is pinned per idle connection
+ * - `asyncSendChain()`: one `SEND` per buffer, chained with `IOSQE_IO_LINK` so they hit the socket in order
+ *   without waiting for each other; short sends are resumed transparently
+ * - `registerFixedFile()`: puts a descriptor in the ring's registered file table so that requests skip the
+ *   per-operation file reference counting
+ *
+ * ### Reactor fallback
+ * If io_uring is compiled out, unavailable (old kernel, disabled by `kernel.io_uring_disabled`, seccomp), or
+ * `forceReactor` is set, the same API is served by a `Selector` and non-blocking system calls. Callbacks,
+ * ordering and error reporting are identical; `registerFixedFile()` becomes a no-op.
+ *
+ * ### Callback Rules
+ * - Receive callbacks get a `std::span` into a service-owned buffer that is only valid during the call.
+ * - An empty span with a null `std::exception_ptr` signals end of stream; the operation is then finished.
+ * - On error the callback receives the exception and the operation is finished.
+ * - Callbacks may start or cancel operations, including their own.
+ *
+ * ### Example
+ * @code{.cpp}
+ * IoService io;
+ * ServerSocket server(8080);
+ * std::unordered_map<SOCKET, Socket> clients;
+ *
+ * io.asyncAcceptMultishot(server, [&](std::optional<Socket> client, std::exception_ptr) {
+ *     if (!client) return;
+ *     const SOCKET fd = client->getSocketFd();
+ *     Socket& s = clients.emplace(fd, std::move(*client)).first->second;
+ *     io.asyncReceive(s, [&, fd](std::span<const char> data, std::exception_ptr) {
+ *         if (data.empty()) { clients.erase(fd); return; }
+ *         io.asyncSendChain(clients.at(fd), {std::string(data.begin(), data.end())}, nullptr);
+ *     });
+ * });
+ * while (true)
+ *     io.runOnce();
+ * @endcode
+ *
+ * @note Not thread-safe: start operations and call `runOnce()` from one thread. Sockets must outlive the
+ *       operations started on them; cancel operations before closing a socket.
+ *
+ * @see Selector
+ * @see AcceptLoop
+ */
+class IoService
+{
+  public:
+    /// @brief Identifies an in-flight operation for `cancel()`. Never 0.
+    using OperationId = std::uint64_t;
+
+    /// @brief Receives each accepted connection, or an exception when the accept operation fails.
+    using AcceptHandler = std::function<void(std::optional<Socket>, std::exception_ptr)>;
+
+    /// @brief Receives stream data; empty span + null exception = end of stream.
+    using ReceiveHandler = std::function<void(std::span<const char>, std::exception_ptr)>;
+
+    /// @brief Receives one datagram and its metadata (`bytes`, `datagramSize`, `truncated`, `src`, `srcLen`).
+    using DatagramHandler = std::function<void(std::span<const char>, const DatagramReadResult&, std::exception_ptr)>;
+
+    /// @brief Receives the total number of bytes sent, or an exception.
+    using SendHandler = std::function<void(std::size_t, std::exception_ptr)>;
+
+    /**
+     * @brief Creates the engine, preferring io_uring and falling back to the reactor.
+     * @throws SocketException If neither backend can be initialized or the options are invalid.
+     */
+    explicit IoService(IoServiceOptions options = {});
+
+    /**
+     * @brief Cancels outstanding operations without invoking their callbacks and releases kernel resources.
+     */
+    ~IoService() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; the service owns kernel resources.
+     */
+    IoService(const IoService&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; the service owns kernel resources.
+     */
+    IoService& operator=(const IoService&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; kernel requests refer to this object.
+     */
+    IoService(IoService&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; kernel requests refer to this object.
+     */
+    IoService& operator=(IoService&&) = delete;
+
+    /**
+     * @brief Backend selected at construction.
+     */
+    [[nodiscard]] IoBackend backend() const noexcept { return _uring ? IoBackend::IoUring : IoBackend::Reactor; }
+
+    /**
+     * @brief Accepts connections continuously until cancelled or a non-transient error occurs.
+     *
+     * The listener is switched to non-blocking mode. Accepted sockets are configured with the server's default
+     * buffer sizes, `TCP_NODELAY` enabled and `FD_CLOEXEC` set.
+     *
+     * @param[in] server Listening server socket; must outlive the operation.
+     * @param[in] handler Called once per connection, or once with an exception before the operation ends.
+     * @return Operation identifier for `cancel()`.
+     * @throws SocketException If the server is not listening or the request cannot be queued.
+     */
+    OperationId asyncAcceptMultishot(ServerSocket& server, AcceptHandler handler);
+
+    /**
+     * @brief Delivers stream data as it arrives until end of stream, error or cancellation.
+     *
+     * Each callback carries at most `IoServiceOptions::bufferSize` bytes. Bytes already held in the socket's
+     * internal read buffer (see `Socket::bufferedBytes()`) are delivered first.
+     *
+     * @return Operation identifier for `cancel()`.
+     * @throws SocketException If the socket is closed, already has a receive operation, or the request cannot
+     *         be queued.
+     */
+    OperationId asyncReceive(Socket& socket, ReceiveHandler handler);
+
+    /**
+     * @brief Delivers datagrams with their source addresses until error or cancellation.
+     *
+     * Datagrams larger than the space left in a receive buffer are truncated and flagged in
+     * `DatagramReadResult::truncated`.
+     *
+     * @return Operation identifier for `cancel()`.
+     * @throws SocketException If the socket is closed, already has a receive operation, or the request cannot
+     *         be queued.
+     */
+    OperationId asyncReceiveFrom(const DatagramSocket& socket, DatagramHandler handler);
+
+    /**
+     * @brief Sends buffers in order as one linked chain and reports the total once all are written.
+     *
+     * The service owns `buffers` until completion. On a connected `DatagramSocket` each buffer is sent as a
+     * separate datagram. Chains started on the same socket run one after another, in call order.
+     *
+     * @param[in] socket Connected socket (`Socket`, or a connected `DatagramSocket`).
+     * @param[in] buffers Payloads to send, in order.
+     * @param[in] handler Completion callback; may be empty.
+     * @return Operation identifier for `cancel()`.
+     * @throws SocketException If the socket is closed or the request cannot be queued.
+     */
+    OperationId asyncSendChain(const SocketOptions& socket, std::vector<std::string> buffers, SendHandler handler);
+
+    /**
+     * @brief Cancels an operation. Its callback is not invoked again.
+     * @return `true` if the operation was still in flight.
+     */
+    bool cancel(OperationId id);
+
+    /**
+     * @brief Adds a descriptor to the registered file table (io_uring only).
+     *
+     * Subsequent operations on the socket use `IOSQE_FIXED_FILE`, avoiding per-request file lookups.
+     * Unregister the socket before closing it.
+     *
+     * @return `true` if the socket now has a fixed slot; `false` with the reactor backend or when the table
+     *         is full.
+     * @throws SocketException If the kernel rejects the update.
+     */
+    bool registerFixedFile(const SocketOptions& socket);
+
+    /**
+     * @brief Removes a descriptor from the registered file table.
+     * @return `true` if the socket had a fixed slot.
+     */
+    bool unregisterFixedFile(const SocketOptions& socket);
+
+    /**
+     * @brief Submits queued requests, waits for completions and runs their callbacks.
+     *
+     * @param[in] timeoutMillis Maximum wait in milliseconds; `-1` waits until at least one completion,
+     *                          `0` only reaps what is already complete.
+     * @return Number of callbacks invoked.
+     * @throws SocketException If the wait fails.
+     */
+    std::size_t runOnce(int timeoutMillis = -1);
+
+    /**
+     * @brief Number of operations still in flight.
+     */
+    [[nodiscard]] std::size_t pendingOperations() const noexcept { return _operations.size(); }
+
+  private:
+    struct Operation;
+    struct Uring;
+
+    /// @brief Operations attached to one descriptor: at most one reader, and send chains run one at a time.
+    struct FdOperations
+    {
+        OperationId reader = 0;               ///< Accept or receive operation; 0 if none.
+        std::vector<OperationId> writers{};   ///< Send chains in submission order; the front one is active.
+    };
+
+    OperationId addOperation(std::unique_ptr<Operation> op);
+    void finish(OperationId id);
+    std::size_t runDeferred();
+    Socket adoptAccepted(const ServerSocket& server, SOCKET fd) const;
+
+    // io_uring backend
+    void uringArm(Operation& op);
+    void uringArmSend(Operation& op);
+    void uringCancel(const Operation& op);
+    std::size_t uringRun(int timeoutMillis);
+    std::size_t uringComplete(std::uint64_t userData, int res, std::uint32_t flags);
+    void uringShutdown() noexcept;
+
+    // Reactor backend
+    void reactorUpdate(SOCKET fd);
+    std::size_t reactorRun(int timeoutMillis);
+    std::size_t reactorRead(Operation& op);
+    std::size_t reactorWrite(Operation& op);
+
+    IoServiceOptions _options;                                               ///< Construction parameters.
+    std::unique_ptr<Uring> _uring{};                                         ///< io_uring state; null for the reactor.
+    std::unique_ptr<Selector> _selector{};                                   ///< Reactor state; null for io_uring.
+    std::unordered_map<OperationId, std::unique_ptr<Operation>> _operations; ///< In-flight operations.
+    std::unordered_map<SOCKET, FdOperations> _fdOperations{};                ///< Per-descriptor ordering.
+    std::vector<OperationId> _deferred{};                                    ///< Reported by the next `runOnce()`.
+    std::vector<std::unique_ptr<Operation>> _retired;                        ///< Finished; freed after callbacks.
+    std::vector<char> _scratch{};                                            ///< Reactor receive buffer.
+    OperationId _nextId = 1;                                                 ///< Next operation identifier.
+};
+
+} // namespace jsocketpp
@@ -0,0 +1,108 @@
+/**
+ * @file Relay.hpp
+ * @brief Bidirectional, zero-copy byte relay between two connected stream sockets.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+#include <cstdint>
+
+namespace jsocketpp
+{
+
+class Socket;
+class UnixSocket;
+
+/**
+ * @brief Tuning for `relay()`.
+ * @ingroup tcp
+ */
+struct RelayOptions
+{
+    int idleTimeoutMillis = -1; ///< End the relay after this long without traffic; negative waits forever
+    std::size_t pipeSize = 0;   ///< Per-direction kernel pipe capacity on Linux; 0 keeps the default (64 KiB)
+};
+
+/**
+ * @brief Outcome of a `relay()`.
+ * @ingroup tcp
+ */
+struct RelayStats
+{
+    std::uint64_t bytesAToB = 0; ///< Bytes forwarded from the first endpoint to the second
+    std::uint64_t bytesBToA = 0; ///< Bytes forwarded from the second endpoint to the first
+    bool idleTimedOut = false;   ///< `true` if the relay ended because of `RelayOptions::idleTimeoutMillis`
+};
+
+/**
+ * @class RelayEndpoint
+ * @ingroup tcp
+ * @brief One side of a `relay()`: a connected `Socket` or `UnixSocket`.
+ *
+ * Converts implicitly, so `relay(client, upstream)` works for any mix of TCP and Unix domain stream sockets.
+ * The endpoint only borrows the socket, which must outlive the relay.
+ */
+class RelayEndpoint
+{
+  public:
+    /**
+     * @brief Wraps a connected TCP socket. Bytes it has already buffered (e.g. after `readUntil()`) are forwarded
+     *        before anything else.
+     */
+    RelayEndpoint(Socket& socket) noexcept; // NOLINT(google-explicit-constructor)
+
+    /**
+     * @brief Wraps a connected Unix domain stream socket.
+     */
+    RelayEndpoint(UnixSocket& socket) noexcept; // NOLINT(google-explicit-constructor)
+
+  private:
+    friend RelayStats relay(RelayEndpoint a, RelayEndpoint b, const RelayOptions& options);
+
+    SOCKET _fd;      ///< Descriptor relayed from/to
+    Socket* _socket; ///< Set for `Socket` endpoints, whose read-ahead buffer must be flushed first
+};
+
+/**
+ * @brief Copies bytes in both directions between @p a and @p b until both directions are finished.
+ * @ingroup tcp
+ *
+ * Runs on the calling thread and returns once each side has closed its sending direction and everything it sent
+ * has been forwarded, or when no byte moved for `RelayOptions::idleTimeoutMillis`.
+ *
+ * ### Zero copy
+ * On Linux each direction moves data with `splice(2)` through its own pipe: socket → pipe → socket, without the
+ * bytes ever being copied to user space. Other platforms use a 64 KiB user-space buffer per direction.
+ *
+ * ### Half-close
+ * When one side stops sending (EOF), the relay finishes forwarding what is in flight and then shuts down the
+ * write direction of the other side (`shutdown(SHUT_WR)`), so the peer sees EOF too while the opposite direction
+ * keeps flowing.
+ *
+ * Both sockets are switched to non-blocking mode for the duration of the call and restored afterwards. `SIGPIPE`
+ * is suppressed; a peer that resets surfaces as `SocketException`.
+ *
+ * ### Example
+ * @code{.cpp}
+ * ServerSocket listener(8080);
+ * Socket client = listener.accept();
+ * UnixSocket backend("/run/app.sock");
+ * backend.connect();
+ * const RelayStats stats = relay(client, backend, {.idleTimeoutMillis = 60000});
+ * @endcode
+ *
+ * @param[in,out] a First endpoint.
+ * @param[in,out] b Second endpoint.
+ * @param[in] options Idle timeout and pipe size.
+ * @return Bytes forwarded per direction, and whether the idle timeout ended the relay.
+ *
+ * @throws SocketException If polling, reading or writing fails (e.g. `ECONNRESET`, `EPIPE`).
+ */
+RelayStats relay(RelayEndpoint a, RelayEndpoint b, const RelayOptions& options = {});
+
+} // namespace jsocketpp
@@ -0,0 +1,332 @@
+/**
+ * @file Selector.hpp
+ * @brief Readiness multiplexer (Java NIO style) for many sockets on one thread.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "SocketOptions.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+namespace jsocketpp
+{
+
+/**
+ * @enum Interest
+ * @brief Bitmask of readiness conditions a socket can be registered for with a `Selector`.
+ * @ingroup reactor
+ *
+ * Values may be combined with `operator|`. `Accept` is reported for listening sockets when a connection is
+ * pending; it maps to the same kernel readiness as `Read` but is kept separate so that handlers can be
+ * dispatched on the key alone, as with Java's `SelectionKey.OP_ACCEPT`.
+ *
+ * @see Selector::registerSocket()
+ */
+enum class Interest : std::uint8_t
+{
+    None = 0,      ///< No interest; errors and hang-ups are still reported.
+    Read = 1 << 0, ///< Data (or EOF) can be read without blocking.
+    Write = 1 << 1, ///< Data can be written without blocking (or a non-blocking connect completed).
+    Accept = 1 << 2 ///< A listening socket has at least one pending connection.
+};
+
+/// @brief Combines two interest sets. @ingroup reactor
+constexpr Interest operator|(Interest a, Interest b) noexcept
+{
+    return static_cast<Interest>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+}
+
+/// @brief Intersects two interest sets. @ingroup reactor
+constexpr Interest operator&(Interest a, Interest b) noexcept
+{
+    return static_cast<Interest>(static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b));
+}
+
+/// @brief Returns `true` if `set` contains any of the bits in `flags`. @ingroup reactor
+constexpr bool hasInterest(const Interest set, const Interest flags) noexcept
+{
+    return (set & flags) != Interest::None;
+}
+
+/**
+ * @enum TriggerMode
+ * @brief How a `Selector` reports readiness for a registered socket.
+ * @ingroup reactor
+ *
+ * - **Level:** a socket is reported on every `select()` while the condition holds (e.g. unread data remains).
+ * - **Edge:** a socket is reported once per readiness transition; the handler must drain it until the
+ *   operation would block (`EAGAIN`/`EWOULDBLOCK`), and the socket must be non-blocking.
+ *
+ * Edge triggering maps to `EPOLLET` on Linux. Backends without edge notifications (`poll()`/`WSAPoll()`)
+ * treat `Edge` as `Level`, which is always safe for handlers written for edge semantics.
+ */
+enum class TriggerMode : std::uint8_t
+{
+    Level, ///< Report while ready (default; the semantics of `poll()`/`select()`).
+    Edge   ///< Report on transitions to ready (`EPOLLET`).
+};
+
+/**
+ * @struct SelectionKey
+ * @brief One ready socket reported by `Selector::select()`.
+ * @ingroup reactor
+ *
+ * Mirrors Java's `SelectionKey`: it carries the descriptor, the interest set it was registered with, the
+ * subset that is ready, and the opaque attachment supplied at registration time.
+ *
+ * When the kernel reports an error or hang-up, `ready` contains the full registered interest set so that
+ * the next I/O call on the socket observes the condition and throws the corresponding `SocketException`.
+ */
+struct SelectionKey
+{
+    SOCKET fd = INVALID_SOCKET;        ///< Registered descriptor.
+    Interest interest = Interest::None; ///< Interest set at the time of selection.
+    Interest ready = Interest::None;    ///< Ready subset of `interest`.
+    void* attachment = nullptr;         ///< User pointer passed to `registerSocket()`.
+    bool error = false;                 ///< The socket has a pending error (`EPOLLERR`/`POLLERR`/`POLLNVAL`).
+    bool hangup = false;                ///< The peer closed or shut down its side (`EPOLLHUP`/`EPOLLRDHUP`).
+
+    /// @brief `true` if the socket can be read without blocking.
+    [[nodiscard]] bool isReadable() const noexcept { return hasInterest(ready, Interest::Read); }
+    /// @brief `true` if the socket can be written without blocking.
+    [[nodiscard]] bool isWritable() const noexcept { return hasInterest(ready, Interest::Write); }
+    /// @brief `true` if a listening socket has a pending connection.
+    [[nodiscard]] bool isAcceptable() const noexcept { return hasInterest(ready, Interest::Accept); }
+};
+
+/**
+ * @class Selector
+ * @ingroup reactor
+ * @brief Multiplexes readiness of many sockets onto one thread (Java NIO `Selector` equivalent).
+ *
+ * A `Selector` lets a single thread wait for read, write or accept readiness on any number of `Socket`,
+ * `ServerSocket`, `DatagramSocket` or raw descriptors, replacing one blocking thread per connection with a
+ * loop that only touches sockets that are ready.
+ *
+ * ### Backends
+ * - **Linux:** `epoll`, O(1) per ready socket and no descriptor limit; supports edge triggering.
+ * - **Other POSIX:** `poll()` over the registered set.
+ * - **Windows:** `WSAPoll()` over the registered set.
+ *
+ * ### Example
+ * @code{.cpp}
+ * Selector selector;
+ * ServerSocket server(8080);
+ * server.setNonBlocking(true);
+ * selector.registerSocket(server, Interest::Accept);
+ *
+ * std::unordered_map<SOCKET, Socket> clients;
+ * while (running) {
+ *     selector.select(1000);
+ *     for (const SelectionKey& key : selector.selectedKeys()) {
+ *         if (key.isAcceptable()) {
+ *             Socket client = server.accept();
+ *             client.setNonBlocking(true);
+ *             selector.registerSocket(client, Interest::Read);
+ *             clients.emplace(client.getSocketFd(), std::move(client));
+ *         } else if (key.isReadable()) {
+ *             Socket& client = clients.at(key.fd);
+ *             // ... read; on EOF: selector.unregisterSocket(key.fd); clients.erase(key.fd);
+ *         }
+ *     }
+ * }
+ * @endcode
+ *
+ * ### Thread Safety
+ * `select()` must be called from one thread at a time. `registerSocket()`, `modify()`, `unregisterSocket()` and
+ * `wakeup()` may be called from any thread. With the `poll()`/`WSAPoll()` backends, changes made while another
+ * thread is blocked in `select()` take effect on the next call; call `wakeup()` to apply them immediately.
+ *
+ * ### Notes
+ * - The selector does not own registered sockets. Unregister a socket **before** closing it; a closed
+ *   descriptor number may be reused by the OS for an unrelated socket.
+ * - `Socket` keeps bytes received past a `readUntil()` delimiter in user space. Those bytes do not make the
+ *   descriptor readable, so check `Socket::bufferedBytes()` before waiting for more data.
+ *
+ * @see Interest
+ * @see SelectionKey
+ */
+class Selector
+{
+  public:
+    /**
+     * @brief Creates a selector with its own kernel event queue and wakeup channel.
+     *
+     * @param[in] maxEvents Maximum number of ready sockets returned by one `select()` call (default: 1024).
+     *                      Remaining ready sockets are reported by the next call.
+     *
+     * @throws SocketException If `maxEvents` is 0 or the kernel objects cannot be created.
+     */
+    explicit Selector(std::size_t maxEvents = 1024);
+
+    /**
+     * @brief Releases the kernel event queue and wakeup channel. Registered sockets are not closed.
+     */
+    ~Selector() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; a selector owns kernel resources.
+     */
+    Selector(const Selector&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; a selector owns kernel resources.
+     */
+    Selector& operator=(const Selector&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; other threads may hold a reference for `wakeup()`.
+     */
+    Selector(Selector&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; other threads may hold a reference for `wakeup()`.
+     */
+    Selector& operator=(Selector&&) = delete;
+
+    /**
+     * @brief Registers a socket for readiness notifications.
+     *
+     * Registering a descriptor that is already registered replaces its interest set, attachment and trigger
+     * mode.
+     *
+     * @param[in] socket Any `SocketOptions`-derived object (`Socket`, `ServerSocket`, `DatagramSocket`, ...).
+     * @param[in] interest Conditions to report.
+     * @param[in] attachment Opaque pointer returned in every `SelectionKey` for this socket.
+     * @param[in] mode Level- or edge-triggered reporting.
+     *
+     * @throws SocketException If the socket is closed, `mode` is `Edge` and the socket is blocking, or the
+     *         kernel rejects the registration.
+     */
+    void registerSocket(const SocketOptions& socket, Interest interest, void* attachment = nullptr,
+                        TriggerMode mode = TriggerMode::Level);
+
+    /**
+     * @brief Registers a raw descriptor for readiness notifications.
+     *
+     * Overload for descriptors not wrapped in a `SocketOptions`-derived class (e.g. `UnixSocket` or
+     * descriptors owned by other libraries). Edge-triggered registration requires the caller to have set
+     * the descriptor non-blocking.
+     *
+     * @throws SocketException If `fd` is invalid or the kernel rejects the registration.
+     */
+    void registerSocket(SOCKET fd, Interest interest, void* attachment = nullptr,
+                        TriggerMode mode = TriggerMode::Level);
+
+    /**
+     * @brief Replaces the interest set of a registered socket, keeping its attachment and trigger mode.
+     *
+     * Typical use is toggling `Interest::Write` on and off as an application-level send queue fills and drains.
+     *
+     * @throws SocketException If the socket is not registered or the kernel rejects the change.
+     */
+    void modify(const SocketOptions& socket, Interest interest) { modify(socket.getSocketFd(), interest); }
+
+    /**
+     * @brief Replaces the interest set of a registered descriptor.
+     * @copydetails modify(const SocketOptions&, Interest)
+     */
+    void modify(SOCKET fd, Interest interest);
+
+    /**
+     * @brief Removes a socket from the selector.
+     *
+     * @return `true` if the socket was registered, `false` otherwise.
+     * @throws SocketException If the kernel reports an unexpected error while removing the descriptor.
+     */
+    bool unregisterSocket(const SocketOptions& socket) { return unregisterSocket(socket.getSocketFd()); }
+
+    /**
+     * @brief Removes a raw descriptor from the selector.
+     * @copydetails unregisterSocket(const SocketOptions&)
+     */
+    bool unregisterSocket(SOCKET fd);
+
+    /**
+     * @brief Returns whether a descriptor is currently registered.
+     */
+    [[nodiscard]] bool isRegistered(SOCKET fd) const;
+
+    /**
+     * @brief Number of registered descriptors.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Waits until at least one registered socket is ready, the timeout expires, or `wakeup()` is called.
+     *
+     * The ready sockets are available from `selectedKeys()` until the next call. A signal interrupting the wait
+     * (`EINTR`) returns 0 rather than throwing, like a timeout.
+     *
+     * @param[in] timeoutMillis Maximum time to wait in milliseconds; `-1` waits indefinitely and `0` polls.
+     * @return Number of ready keys (0 on timeout, wakeup or interruption).
+     * @throws SocketException If the underlying wait fails.
+     */
+    std::size_t select(int timeoutMillis = -1);
+
+    /**
+     * @brief Non-blocking `select()`: reports sockets that are ready right now.
+     */
+    std::size_t selectNow() { return select(0); }
+
+    /**
+     * @brief Keys reported by the last `select()` call.
+     */
+    [[nodiscard]] const std::vector<SelectionKey>& selectedKeys() const noexcept { return _selected; }
+
+    /**
+     * @brief Makes a blocked (or the next) `select()` call return immediately.
+     *
+     * Safe to call from any thread, including signal-free worker threads that changed the registration set.
+     * Multiple wakeups before the selector runs are coalesced into one.
+     *
+     * @throws SocketException If the wakeup channel cannot be signalled.
+     */
+    void wakeup();
+
+  private:
+    /// @brief Per-descriptor registration state.
+    struct Registration
+    {
+        Interest interest = Interest::None;
+        TriggerMode mode = TriggerMode::Level;
+        void* attachment = nullptr;
+    };
+
+    void drainWakeup() noexcept;
+
+    mutable std::mutex _mutex{};                              ///< Guards `_registrations`.
+    std::unordered_map<SOCKET, Registration> _registrations{}; ///< Registered descriptors.
+    std::vector<SelectionKey> _selected{};                     ///< Result of the last `select()`.
+    std::atomic<bool> _wakePending{false};                     ///< Coalesces `wakeup()` calls.
+    std::size_t _maxEvents;                                    ///< Upper bound on keys per `select()`.
+
+#ifdef __linux__
+    int _epollFd = -1;                 ///< epoll instance.
+    int _wakeFd = -1;                  ///< eventfd used by `wakeup()`.
+    std::vector<epoll_event> _events{}; ///< Reused `epoll_wait()` output buffer.
+#else
+    SOCKET _wakeRecv = INVALID_SOCKET; ///< Read end of the wakeup channel.
+    SOCKET _wakeSend = INVALID_SOCKET; ///< Write end of the wakeup channel.
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> _pollFds{}; ///< Reused `WSAPoll()` input/output buffer.
+#else
+    std::vector<pollfd> _pollFds{}; ///< Reused `poll()` input/output buffer.
+#endif
+#endif
+};
+
+} // namespace jsocketpp
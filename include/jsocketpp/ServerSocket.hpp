@@ -14,6 +14,7 @@
 #include <exception>
 #include <functional>
 #include <future>
+#include <memory>
 #include <optional>
 
 using jsocketpp::DefaultBufferSize;
@@ -21,6 +22,32 @@ using jsocketpp::DefaultBufferSize;
 namespace jsocketpp
 {
 
+class IoService;
+
+namespace internal
+{
+class AsyncAcceptor;
+} // namespace internal
+
+/**
+ * @struct InheritedSocketOptions
+ * @brief Options set once on a listener so that every accepted socket starts with them.
+ * @ingroup tcp
+ *
+ * Fields have the same meaning as the corresponding `ServerSocket::accept()` parameters.
+ *
+ * @see ServerSocket::setInheritedOptions()
+ */
+struct InheritedSocketOptions
+{
+    std::optional<std::size_t> recvBufferSize = std::nullopt; ///< `SO_RCVBUF`; unset leaves the system default.
+    std::optional<std::size_t> sendBufferSize = std::nullopt; ///< `SO_SNDBUF`; unset leaves the system default.
+    int soRecvTimeoutMillis = -1;                             ///< `SO_RCVTIMEO`; `-1` leaves it unset.
+    int soSendTimeoutMillis = -1;                             ///< `SO_SNDTIMEO`; `-1` leaves it unset.
+    bool tcpNoDelay = true;                                   ///< `TCP_NODELAY`.
+    bool keepAlive = false;                                   ///< `SO_KEEPALIVE`.
+};
+
 /**
  * @class ServerSocket
  * @ingroup tcp
@@ -329,8 +356,10 @@ class ServerSocket : public SocketOptions
         : SocketOptions(rhs.getSocketFd()), _srvAddrInfo(std::move(rhs._srvAddrInfo)),
           _selectedAddrInfo(rhs._selectedAddrInfo), _port(rhs._port), _isBound(rhs._isBound),
           _isListening(rhs._isListening), _soTimeoutMillis(rhs._soTimeoutMillis),
-          _defaultReceiveBufferSize(rhs._defaultReceiveBufferSize)
+          _defaultReceiveBufferSize(rhs._defaultReceiveBufferSize), _defaultSendBufferSize(rhs._defaultSendBufferSize),
+          _defaultInternalBufferSize(rhs._defaultInternalBufferSize), _inherited(rhs._inherited)
     {
+        rhs.stopAsyncAccepts(); // pending acceptAsync() calls belong to rhs and fail with an exception
         rhs.setSocketFd(INVALID_SOCKET);
         rhs._selectedAddrInfo = nullptr;
         rhs._isBound = false;
@@ -377,7 +406,8 @@ class ServerSocket : public SocketOptions
             {
             }
 
-            // Transfer ownership
+            // Transfer ownership; pending acceptAsync() calls belong to rhs and fail with an exception
+            rhs.stopAsyncAccepts();
             setSocketFd(rhs.getSocketFd());
             _srvAddrInfo = std::move(rhs._srvAddrInfo);
             _selectedAddrInfo = rhs._selectedAddrInfo;
@@ -386,6 +416,9 @@ class ServerSocket : public SocketOptions
             _isListening = rhs._isListening;
             _soTimeoutMillis = rhs._soTimeoutMillis;
             _defaultReceiveBufferSize = rhs._defaultReceiveBufferSize;
+            _defaultSendBufferSize = rhs._defaultSendBufferSize;
+            _defaultInternalBufferSize = rhs._defaultInternalBufferSize;
+            _inherited = rhs._inherited;
 
             // Reset source;
             rhs.setSocketFd(INVALID_SOCKET);
@@ -558,7 +591,7 @@ class ServerSocket : public SocketOptions
      * - If the timeout is **positive**, it waits for the given number of milliseconds before throwing
      *   a `SocketTimeoutException` if no connection occurs.
      *
-     * Internally, this method uses `select()` via `waitReady()` to wait for readiness, then invokes `accept()`.
+     * Internally, this method uses `poll()` via `waitReady()` to wait for readiness, then invokes `accept()`.
      * The socket’s blocking mode (via `setNonBlocking()`) does **not** affect this method.
      *
      * ---
@@ -647,7 +680,7 @@ class ServerSocket : public SocketOptions
      * - If `timeoutMillis` is **positive**, the method waits up to that many milliseconds before throwing a
      *   `SocketTimeoutException` if no connection is made.
      *
-     * Internally, this method uses `waitReady(timeoutMillis)` (based on `select()`) to wait for readiness and
+     * Internally, this method uses `waitReady(timeoutMillis)` (based on `poll()`) to wait for readiness and
      * then calls `acceptBlocking()` with the resolved parameters.
      *
      * ---
@@ -738,7 +771,7 @@ class ServerSocket : public SocketOptions
      * ### ⏱ Timeout Behavior
      * - If the socket timeout is **negative** (default), the method blocks indefinitely.
      * - If the timeout is **zero**, it polls and returns immediately if no client is waiting.
-     * - If the timeout is **positive**, the method waits up to that many milliseconds using `select()`.
+     * - If the timeout is **positive**, the method waits up to that many milliseconds using `poll()`.
      *   - If no connection arrives within that time, it returns `std::nullopt` (unlike `accept()` which throws).
      *
      * Internally, `waitReady()` is used for readiness detection, followed by `acceptBlocking()` for the actual accept.
@@ -816,6 +849,20 @@ class ServerSocket : public SocketOptions
                                                   bool tcpNoDelay = true, bool keepAlive = false,
                                                   bool nonBlocking = false) const;
 
+    /**
+     * @brief Accepts connections through @p io until cancelled or a non-transient error occurs.
+     *
+     * Shorthand for `io.asyncAcceptMultishot(*this, handler)`. Unlike `acceptAsync()`, no thread is involved:
+     * @p handler runs inside `IoService::runOnce()`. The server must outlive the operation.
+     *
+     * @return Operation identifier for `IoService::cancel()`.
+     * @throws SocketException If the server is not listening or the request cannot be queued.
+     *
+     * @see IoService::asyncAcceptMultishot()
+     */
+    std::uint64_t asyncAcceptMultishot(IoService& io,
+                                       std::function<void(std::optional<Socket>, std::exception_ptr)> handler);
+
     /**
      * @brief Attempt to accept an incoming client connection, waiting up to a specified timeout and returning
      * `std::nullopt` on timeout.
@@ -832,7 +879,7 @@ class ServerSocket : public SocketOptions
      * - **Zero**: Poll immediately; return `std::nullopt` if no client is waiting
      * - **Positive**: Wait up to `timeoutMillis` milliseconds; return `std::nullopt` if no client connects in time
      *
-     * Readiness is detected using `select()` via `waitReady(timeoutMillis)`, followed by a call to
+     * Readiness is detected using `poll()` via `waitReady(timeoutMillis)`, followed by a call to
      * `acceptBlocking(...)` if the socket is ready.
      *
      * ---
@@ -1039,6 +1086,8 @@ class ServerSocket : public SocketOptions
      * - This method does **not** use `select()`, `poll()`, or `epoll()` internally.
      * - It is ideal for event-loop and polling-based architectures where you explicitly check for readiness.
      * - Socket behavior is determined entirely by whether `setNonBlocking(true)` was called on the server socket.
+     * - On Linux, uses `accept4()` with `SOCK_CLOEXEC` (plus `SOCK_NONBLOCK` when `nonBlocking` is `true`), so the
+     *   descriptor is never leaked across `exec()` and non-blocking mode is set without extra system calls.
      *
      * ---
      *
@@ -1097,15 +1146,16 @@ class ServerSocket : public SocketOptions
      * configured `Socket`.
      * @ingroup tcp
      *
-     * This method initiates an asynchronous accept operation on the server socket using
-     * `std::async(std::launch::async, ...)`. It returns a `std::future<Socket>` that will
-     * become ready once a client is accepted or an error/timeout occurs.
+     * This method queues an asynchronous accept operation on the server socket's accept thread. It returns a
+     * `std::future<Socket>` that will become ready once a client is accepted or an error/timeout occurs.
      *
      * ---
      *
      * ### ⚙️ Behavior
      * - The calling thread is **never blocked**
-     * - A background thread calls `accept(...)` with the specified tuning options
+     * - One accept thread per `ServerSocket`, started on first use, serves queued calls in order: it waits for the
+     *   listener to become ready (up to `getSoTimeout()`, counted from when the call reaches the front of the
+     *   queue) and accepts with the specified tuning options
      * - When `.get()` is called on the future:
      *   - If successful, a fully configured `Socket` is returned
      *   - If an error occurred, the exception is rethrown (`SocketException`, `SocketTimeoutException`, etc.)
@@ -1122,10 +1172,18 @@ class ServerSocket : public SocketOptions
      *
      * ---
      *
-     * ### ⚠️ Lifetime Warning
-     * The `ServerSocket` object must remain valid and alive **at least until** the returned `std::future` has resolved
-     * and `.get()` has been called. Using this method in contexts where the `ServerSocket` may be destroyed early
-     * can lead to undefined behavior or dangling references.
+     * ### 🛑 Cancellation
+     * `close()`, destroying the `ServerSocket` or moving from it fails every pending call with a
+     * `SocketException` and joins the accept thread, so the thread never outlives the listener.
+     * While the accept thread exists, the listener is in non-blocking mode, so that a connection that goes away
+     * between readiness and `accept()` cannot block the thread; moving from the socket restores the previous mode.
+     *
+     * ---
+     *
+     * ### 🚀 High Connection Rates
+     * Calls are served one after another by the same thread. Servers that accept connections continuously
+     * should use `AcceptLoop`, which drains all pending connections on each wakeup and hands them to a bounded
+     * worker pool.
      *
      * ---
      *
@@ -1181,7 +1239,8 @@ class ServerSocket : public SocketOptions
      * @pre Server socket must be valid, bound, and listening
      * @post Future resolves to a connected `Socket`, or throws from `.get()`
      *
-     * @see accept(), acceptBlocking(), tryAccept(), acceptNonBlocking(), acceptAsync(callback), std::future, std::async
+     * @see accept(), acceptBlocking(), tryAccept(), acceptNonBlocking(), acceptAsync(callback), std::future
+     * @see AcceptLoop For pooled, event-driven accepting
      */
     [[nodiscard]] std::future<Socket> acceptAsync(std::optional<std::size_t> recvBufferSize = std::nullopt,
                                                   std::optional<std::size_t> sendBufferSize = std::nullopt,
@@ -1194,14 +1253,15 @@ class ServerSocket : public SocketOptions
      * @brief Asynchronously accept a client connection and invoke a callback upon completion or error.
      * @ingroup tcp
      *
-     * This method starts a detached background thread that performs a socket `accept()` and
-     * invokes a user-provided callback upon completion. It is designed for event-driven or
-     * callback-oriented architectures where blocking or polling is not desirable.
+     * This method queues a socket `accept()` on the server socket's accept thread and invokes a user-provided
+     * callback upon completion. It is designed for event-driven or callback-oriented architectures where blocking
+     * or polling is not desirable.
      *
      * ---
      *
      * ### ⚙️ Behavior
-     * - Accepts one client connection in a background thread
+     * - Accepts one client connection on the accept thread shared by all `acceptAsync()` calls on this
+     *   `ServerSocket`, which serves them in order; `getSoTimeout()` counts from when the call reaches the front
      * - Applies the same tuning options available to synchronous `accept()` methods
      * - If a client connects, the callback receives a fully constructed `Socket` and `nullptr` exception
      * - If an error occurs, the callback receives `std::nullopt` and a `std::exception_ptr`
@@ -1225,9 +1285,17 @@ class ServerSocket : public SocketOptions
      *
      * ---
      *
-     * ### ⚠️ Lifetime Warning
-     * The `ServerSocket` must outlive the background thread and callback execution.
-     * Destroying the `ServerSocket` before the callback is invoked results in **undefined behavior**.
+     * ### 🛑 Cancellation
+     * `close()`, destroying the `ServerSocket` or moving from it invokes the callback of every pending call with a
+     * `SocketException` and joins the accept thread. Callbacks run on the accept thread; they may call
+     * `acceptAsync()` again to keep accepting, and may close the `ServerSocket`.
+     *
+     * ---
+     *
+     * ### 🚀 High Connection Rates
+     * Calls are served one after another by the same thread, and the callback delays the next accept. For
+     * continuous accepting, prefer `AcceptLoop`, which drains all pending connections on each wakeup and runs
+     * handlers on a bounded worker pool.
      *
      * ---
      *
@@ -1278,6 +1346,7 @@ class ServerSocket : public SocketOptions
      * @post The callback is invoked exactly once, either with a valid `Socket` or an error
      *
      * @see accept(), tryAccept(), acceptBlocking(), acceptAsync(std::future)
+     * @see AcceptLoop For pooled, event-driven accepting
      * @see std::optional, std::exception_ptr, std::rethrow_exception
      */
     void acceptAsync(std::function<void(std::optional<Socket>, std::exception_ptr)> callback,
@@ -1364,10 +1433,10 @@ class ServerSocket : public SocketOptions
      * but can also be used directly in custom event loops or multiplexed servers.
      *
      * ### Platform Behavior
-     * - **POSIX:** Uses `poll()` to monitor readiness, avoiding the `FD_SETSIZE` constraint imposed by `select()`.
-     * - **Windows:** Uses `select()` to ensure compatibility with all socket types.
-     *   - The socket descriptor must be less than `FD_SETSIZE` (typically 64 on Windows).
-     *   - If the descriptor exceeds `FD_SETSIZE`, a `SocketException` is thrown to prevent undefined behavior.
+     * - **Linux:** Uses `ppoll()` with a nanosecond timeout derived from a `steady_clock` deadline.
+     * - **Other POSIX:** Uses `poll()`.
+     * - **Windows:** Uses `WSAPoll()`.
+     * - None of these has the `FD_SETSIZE` ceiling of `select()`, so descriptors of any value are supported.
      *
      * ### Timeout Semantics
      * - `timeoutMillis < 0`: Blocks indefinitely until a connection attempt is ready.
@@ -1376,7 +1445,7 @@ class ServerSocket : public SocketOptions
      * - If `timeoutMillis` is not provided, the socket's logical timeout (`_soTimeoutMillis`) is used.
      *
      * @note This method does **not** rely on or modify kernel-level timeouts (e.g., `SO_RCVTIMEO`).
-     *       It uses event polling (`poll()` or `select()`) for logical timeout behavior.
+     *       It uses event polling (`poll()`, `ppoll()` or `WSAPoll()`) for logical timeout behavior.
      *
      * ### Thread Safety
      * This method is thread-safe **as long as the server socket is not concurrently closed or reconfigured.**
@@ -1387,7 +1456,6 @@ class ServerSocket : public SocketOptions
      * @throws SocketException if:
      *         - The server socket is not initialized (`INVALID_SOCKET`)
      *         - A system-level polling error occurs
-     *         - The socket descriptor exceeds platform limits (`FD_SETSIZE`) on Windows
      *
      * @see accept()      Accepts a new incoming connection
      * @see tryAccept()   Non-blocking variant of `accept()`
@@ -1404,7 +1472,7 @@ class ServerSocket : public SocketOptions
      *
      * Unlike `Socket::setSoTimeout()`, this method does **not** call `setsockopt()` and does **not**
      * affect the underlying socket descriptor. Instead, it is used internally to control the behavior
-     * of `select()` during accept operations.
+     * of `waitReady()` during accept operations.
      *
      * @note Use:
      * - Negative value: wait indefinitely (blocking behavior)
@@ -1426,7 +1494,7 @@ class ServerSocket : public SocketOptions
      * @brief Get the logical timeout (in milliseconds) for accept operations.
      *
      * This value determines how long methods like `accept()` and `tryAccept()` will wait for an incoming
-     * client connection before timing out. It is used internally by `select()` or similar readiness mechanisms.
+     * client connection before timing out. It is used internally by `poll()` or similar readiness mechanisms.
      *
      * @note This timeout is a logical userland timeout and does **not** affect the socket descriptor
      *       via `setsockopt()` (unlike `Socket::getSoTimeout()`).
@@ -1544,6 +1612,60 @@ class ServerSocket : public SocketOptions
      */
     [[nodiscard]] std::size_t getDefaultInternalBufferSize() const noexcept { return _defaultInternalBufferSize; }
 
+    /**
+     * @brief Sets options once on the listener so that accepted sockets inherit them instead of paying for
+     *        per-connection `setsockopt()` calls.
+     *
+     * By default every accepted socket is tuned individually: `SO_RCVBUF`, `SO_SNDBUF`, `TCP_NODELAY`,
+     * `SO_KEEPALIVE`, the blocking mode and, if requested, both timeouts, which is up to eight system calls per
+     * connection. The kernel copies these options from the listening socket into each socket it accepts, so they
+     * can be set here once instead.
+     *
+     * After this call:
+     * - The buffer sizes given here become the defaults of `accept()` (as with `setDefaultReceiveBufferSize()` and
+     *   `setDefaultSendBufferSize()`).
+     * - Every `accept()` variant only applies the options whose requested value differs from the inherited one.
+     *   A timeout of `-1` keeps the inherited timeout. `tcpNoDelay` and `keepAlive` are compared as passed; their
+     *   `accept()` defaults (`true`, `false`) match those of `InheritedSocketOptions`, so pass the inherited values
+     *   explicitly when changing them here.
+     * - The blocking mode is already applied atomically by `accept4()` on Linux, with or without this call.
+     *
+     * ### Example
+     * @code
+     * ServerSocket server(8080, "", false);
+     * server.setInheritedOptions({.recvBufferSize = 256 * 1024, .sendBufferSize = 256 * 1024});
+     * server.bind();
+     * server.listen();
+     * Socket client = server.accept(); // no setsockopt() calls on Linux
+     * @endcode
+     *
+     * @param[in] options Options to set on the listener.
+     *
+     * @throws SocketException If an option cannot be set on the listener.
+     *
+     * @note Call before `listen()`: the window scale of accepted connections is negotiated from the receive
+     *       buffer size in effect at that point.
+     * @note The listener's `SO_RCVTIMEO` also bounds a blocking `accept()` system call. `accept()` waits for
+     *       readiness first, so this only matters when several threads accept on the same listener.
+     * @note Skipping relies on the kernel copying the options, which Linux guarantees. Elsewhere every option is
+     *       still applied to each accepted socket, as before.
+     *
+     * @see getInheritedOptions()
+     * @see accept()
+     *
+     * @ingroup tcp
+     */
+    void setInheritedOptions(const InheritedSocketOptions& options);
+
+    /**
+     * @brief Options set by `setInheritedOptions()`, if any.
+     * @ingroup tcp
+     */
+    [[nodiscard]] const std::optional<InheritedSocketOptions>& getInheritedOptions() const noexcept
+    {
+        return _inherited;
+    }
+
   protected:
     /**
      * @brief Cleans up internal resources and resets the server socket state.
@@ -1662,6 +1784,11 @@ class ServerSocket : public SocketOptions
     [[nodiscard]] bool isPassiveSocket() const noexcept override { return true; }
 
   private:
+    /**
+     * @brief Lets `IoService` configure sockets accepted by io_uring with this server's buffer defaults.
+     */
+    friend class IoService;
+
     /**
      * @brief Get the effective receive buffer size to use for socket read operations.
      *
@@ -1754,6 +1881,28 @@ class ServerSocket : public SocketOptions
                 getEffectiveInternalBufferSize(internal)};
     }
 
+    /**
+     * @brief Wraps an accepted descriptor in a `Socket`, applying only the options it did not inherit.
+     *
+     * Options equal to the ones set with `setInheritedOptions()` are left as the kernel copied them from the
+     * listener (Linux only). The blocking mode is skipped when `accept4()` already applied it.
+     *
+     * @param[in] nonBlockingApplied `true` if the descriptor was accepted with the requested blocking mode.
+     */
+    /**
+     * @brief Fails pending `acceptAsync()` calls and stops the thread serving them.
+     *
+     * Joins the thread unless called from it (i.e. from an `acceptAsync()` callback), in which case it exits once
+     * the callback returns. Idempotent.
+     */
+    void stopAsyncAccepts() const noexcept;
+
+    [[nodiscard]] Socket wrapAccepted(SOCKET client, const sockaddr_storage& addr, socklen_t len,
+                                      std::size_t recvBufferSize, std::size_t sendBufferSize,
+                                      std::size_t internalBufferSize, int soRecvTimeoutMillis,
+                                      int soSendTimeoutMillis, bool tcpNoDelay, bool keepAlive, bool nonBlocking,
+                                      bool nonBlockingApplied) const;
+
     internal::AddrinfoPtr _srvAddrInfo = nullptr; ///< Address info for binding (from getaddrinfo)
     addrinfo* _selectedAddrInfo = nullptr;        ///< Selected address info for binding
     Port _port;                                   ///< Port number the server will listen on
@@ -1765,6 +1914,10 @@ class ServerSocket : public SocketOptions
     std::size_t _defaultSendBufferSize = DefaultBufferSize; ///< Default send buffer size for accepted client sockets
     std::size_t _defaultInternalBufferSize =
         DefaultBufferSize; ///< Default internal buffer size for accepted client sockets, used by some read() methods
+    std::optional<InheritedSocketOptions> _inherited{}; ///< Options accepted sockets inherit from the listener
+
+    /// @brief Thread serving `acceptAsync()`; started on first use, stopped by `close()`, moves and destruction.
+    mutable std::shared_ptr<internal::AsyncAcceptor> _asyncAcceptor{};
 };
 
 } // namespace jsocketpp
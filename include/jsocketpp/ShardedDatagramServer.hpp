@@ -0,0 +1,242 @@
+/**
+ * @file ShardedDatagramServer.hpp
+ * @brief Per-core UDP receiver: one `SO_REUSEPORT` socket and batch-receiving thread per shard.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "DatagramPacket.hpp"
+#include "DatagramSocket.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace jsocketpp
+{
+
+/**
+ * @struct ShardedDatagramServerOptions
+ * @brief Shard count, batching and CPU placement for `ShardedDatagramServer`.
+ * @ingroup udp
+ */
+struct ShardedDatagramServerOptions
+{
+    /// Number of shards (socket + thread). `0` is replaced by the number of hardware threads.
+    std::size_t shards = std::thread::hardware_concurrency();
+
+    std::string localAddress{};                               ///< Address to bind; empty binds all interfaces.
+    std::size_t batchSize = 32;                               ///< Datagrams received per `readBatch()` call.
+    std::size_t maxDatagramSize = 2048;                       ///< Receive buffer per datagram; longer ones truncate.
+    std::optional<std::size_t> recvBufferSize = std::nullopt; ///< `SO_RCVBUF` of each shard's socket.
+    bool resolveSenders = true;                               ///< Fill `address`/`port` of each received packet.
+
+    /// How often an idle shard checks for `stop()`, in milliseconds (used as the receive timeout).
+    int stopCheckMillis = 100;
+
+    /// Pin shard `i`'s thread to CPU `i` and set its socket's `SO_INCOMING_CPU` to `i` (Linux only; best effort).
+    bool pinThreads = true;
+
+    /// Attach a reuseport CBPF program that delivers each datagram to shard `cpu % shards`, where `cpu` is the
+    /// core that processed it (Linux only, and only with at most one shard per hardware thread). See
+    /// `ShardedDatagramServer::isCpuSteeringActive()`.
+    bool cpuSteering = true;
+};
+
+/**
+ * @struct DatagramBatch
+ * @brief Datagrams received by one `readBatch()` call of a `ShardedDatagramServer` shard.
+ * @ingroup udp
+ *
+ * Valid only during the handler call. Packet buffers keep their full capacity between batches, so the payload
+ * of datagram `i` is the first `results[i].bytes` bytes of `packets[i].buffer`; use `payload(i)`.
+ */
+struct DatagramBatch
+{
+    DatagramSocket& socket;                      ///< Socket the datagrams arrived on; reply through it.
+    std::size_t shard;                           ///< Index of the receiving shard.
+    std::span<DatagramPacket> packets;           ///< Received datagrams; sender in `address`/`port`.
+    std::span<const DatagramReadResult> results; ///< Per-datagram sizes, truncation and raw source address.
+
+    /// @brief Number of datagrams in the batch.
+    [[nodiscard]] std::size_t size() const noexcept { return packets.size(); }
+
+    /// @brief Received bytes of datagram @p i.
+    [[nodiscard]] std::string_view payload(const std::size_t i) const noexcept
+    {
+        return {packets[i].buffer.data(), results[i].bytes};
+    }
+};
+
+/**
+ * @class ShardedDatagramServer
+ * @ingroup udp
+ * @brief Receives one UDP port on N independent sockets, each drained by its own thread in batches.
+ *
+ * A single `DatagramSocket` read by several threads serialises them on the socket's receive queue lock, and one
+ * reader thread caps the service at one core. `ShardedDatagramServer` binds one socket per shard to the same
+ * port with `SO_REUSEPORT`; the kernel spreads datagrams over the sockets (by 4-tuple hash, or by receiving CPU
+ * with `cpuSteering`), and every shard receives with `readBatch()` (`recvmmsg()` on Linux) on its own thread.
+ * Shards share nothing, so throughput scales with the number of cores.
+ *
+ * The handler is called on the shard's thread with each batch. Replies should be sent through
+ * `DatagramBatch::socket`, the socket the requests arrived on, so that they leave from the same port and stay
+ * on the same core; `writeBatch()` sends a whole batch of replies in one system call.
+ *
+ * ### CPU locality
+ * With `pinThreads`, shard `i` runs on CPU `i` and its socket's `SO_INCOMING_CPU` is set to `i`. With
+ * `cpuSteering`, a classic BPF program on the reuseport group (`SO_ATTACH_REUSEPORT_CBPF`) selects socket
+ * `cpu % shards`, so with one shard per core (and RSS/RPS spreading packets over cores) each datagram is
+ * received and handled on the core that processed it. `incomingCpu()` reports where each shard's traffic
+ * actually arrives.
+ *
+ * ### Portability
+ * On platforms without `SO_REUSEPORT` (Windows), a single shard is used. Pinning and steering are Linux-only.
+ *
+ * ### Errors
+ * Receive errors and exceptions escaping the handler are passed to the optional error handler from the shard's
+ * thread; the shard then carries on with the next batch.
+ *
+ * ### Example
+ * @code{.cpp}
+ * ShardedDatagramServer server(5353, [](const DatagramBatch& batch) {
+ *     for (std::size_t i = 0; i < batch.size(); ++i)
+ *         batch.socket.writeTo(batch.packets[i].address, batch.packets[i].port, batch.payload(i));
+ * });
+ * @endcode
+ *
+ * @see DatagramSocket::readBatch()
+ * @see ShardedServer
+ * @see SocketOptions::setReusePort()
+ */
+class ShardedDatagramServer
+{
+  public:
+    /// @brief Handles one batch of datagrams; runs on the receiving shard's thread.
+    using Handler = std::function<void(const DatagramBatch&)>;
+
+    /// @brief Receives receive errors and exceptions escaping the handler.
+    using ErrorHandler = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @brief Binds every shard's socket and starts the shard threads.
+     *
+     * @param[in] port Port to serve; `0` lets the first shard pick an ephemeral port that the others then join
+     *                 (see `getLocalPort()`).
+     * @param[in] handler Batch handler.
+     * @param[in] options Shard count, batching and CPU placement.
+     * @param[in] onError Optional error sink; if empty, errors are dropped.
+     *
+     * @throws SocketException If `handler` is empty, `batchSize` or `maxDatagramSize` is `0`, or a socket or
+     *         thread cannot be created.
+     */
+    ShardedDatagramServer(Port port, Handler handler, ShardedDatagramServerOptions options = {},
+                          ErrorHandler onError = {});
+
+    /**
+     * @brief Stops all shards and joins their threads. See `stop()`.
+     */
+    ~ShardedDatagramServer() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; the server owns threads.
+     */
+    ShardedDatagramServer(const ShardedDatagramServer&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; the server owns threads.
+     */
+    ShardedDatagramServer& operator=(const ShardedDatagramServer&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; running threads refer to this object.
+     */
+    ShardedDatagramServer(ShardedDatagramServer&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; running threads refer to this object.
+     */
+    ShardedDatagramServer& operator=(ShardedDatagramServer&&) = delete;
+
+    /**
+     * @brief Stops receiving, joins the shard threads (within `stopCheckMillis` plus the running handler) and
+     *        closes the sockets.
+     *
+     * Must not be called from the handler. Idempotent.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief `true` until `stop()` is called.
+     */
+    [[nodiscard]] bool isRunning() const noexcept { return !_stopping.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Port all shards are bound to.
+     */
+    [[nodiscard]] Port getLocalPort() const noexcept { return _port; }
+
+    /**
+     * @brief Number of shards.
+     */
+    [[nodiscard]] std::size_t shardCount() const noexcept { return _shards.size(); }
+
+    /**
+     * @brief Datagrams received by shard @p index so far.
+     * @throws std::out_of_range If @p index is not less than `shardCount()`.
+     */
+    [[nodiscard]] std::uint64_t receivedCount(std::size_t index) const;
+
+    /**
+     * @brief Datagrams received by all shards so far.
+     */
+    [[nodiscard]] std::uint64_t receivedCount() const noexcept;
+
+    /**
+     * @brief CPU that last processed a datagram for shard @p index (`SO_INCOMING_CPU`), or `-1` if unknown.
+     *
+     * Always `-1` on platforms without `SO_INCOMING_CPU` and after `stop()`.
+     *
+     * @throws std::out_of_range If @p index is not less than `shardCount()`.
+     */
+    [[nodiscard]] int incomingCpu(std::size_t index) const;
+
+    /**
+     * @brief `true` if the CPU-steering reuseport program is attached to the sockets.
+     */
+    [[nodiscard]] bool isCpuSteeringActive() const noexcept { return _cpuSteering; }
+
+  private:
+    /// @brief One socket and its receiving thread.
+    struct Shard
+    {
+        std::unique_ptr<DatagramSocket> socket{}; ///< Reuseport member `index` of the group.
+        std::atomic<std::uint64_t> received{0};   ///< Datagrams received by this shard.
+        std::thread thread{};                     ///< Runs `shardMain()`.
+    };
+
+    void shardMain(Shard& shard, std::size_t index);
+    void reportError(std::exception_ptr error) noexcept;
+
+    Handler _handler;                              ///< Batch handler.
+    ErrorHandler _onError;                         ///< Optional error sink.
+    ShardedDatagramServerOptions _options;         ///< Configuration fixed at construction.
+    Port _port = 0;                                ///< Port shared by all sockets.
+    bool _cpuSteering = false;                     ///< Reuseport CBPF program attached.
+    std::atomic<bool> _stopping{false};            ///< Set once by `stop()`.
+    std::vector<std::unique_ptr<Shard>> _shards{}; ///< Shards, in bind order.
+};
+
+} // namespace jsocketpp
@@ -0,0 +1,208 @@
+/**
+ * @file ShardedServer.hpp
+ * @brief Per-core TCP server: one `SO_REUSEPORT` listener, event loop and thread per shard.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "EventLoop.hpp"
+#include "ServerSocket.hpp"
+#include "Socket.hpp"
+#include "Task.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jsocketpp
+{
+
+/**
+ * @struct ShardedServerOptions
+ * @brief Shard count, binding and CPU placement for `ShardedServer`.
+ * @ingroup reactor
+ */
+struct ShardedServerOptions
+{
+    /// Number of shards (listener + event loop + thread). `0` is replaced by the number of hardware threads.
+    std::size_t shards = std::thread::hardware_concurrency();
+
+    std::string localAddress{}; ///< Address to bind; empty binds all interfaces.
+    int backlog = 128;          ///< Listen backlog of each shard's listener.
+
+    /// Pin shard `i`'s thread to CPU `i` (Linux only; best effort, skipped for CPUs outside the affinity mask).
+    bool pinThreads = true;
+
+    /// Attach a reuseport CBPF program that routes each connection to shard `cpu % shards`, where `cpu` is the
+    /// core that processed the incoming SYN (Linux only, and only with at most one shard per hardware thread).
+    /// Otherwise, or if the kernel rejects it, connections are spread by the default 4-tuple hash; see
+    /// `ShardedServer::isCpuSteeringActive()`.
+    bool cpuSteering = true;
+};
+
+/**
+ * @class ShardedServer
+ * @ingroup reactor
+ * @brief Serves one TCP port from N independent shards, each with its own listener, `EventLoop` and thread.
+ *
+ * A single listening socket serialises every `accept()` on one queue and one lock, and the accepted connection
+ * is then typically handled on a different core than the one whose softirq received it. Above roughly 100k new
+ * connections per second that queue and the resulting cross-core cache traffic dominate.
+ *
+ * `ShardedServer` instead binds one `ServerSocket` per shard to the same port with `SO_REUSEPORT`, so the kernel
+ * keeps a separate accept queue per listener. Each shard runs a coroutine accept loop on its own `EventLoop`,
+ * and every accepted connection is served by the session the factory returns, on that shard's thread, for its
+ * whole lifetime. Shards share nothing.
+ *
+ * ### CPU locality
+ * With `pinThreads`, shard `i` runs on CPU `i`. With `cpuSteering`, a classic BPF program attached to the
+ * reuseport group (`SO_ATTACH_REUSEPORT_CBPF`) selects listener `cpu % shards` for each new connection, so when
+ * the shard count matches the core count a connection is accepted and served on the core that received it.
+ * Combine with RSS/RPS (or `SO_INCOMING_CPU`-aware NIC steering) for full end-to-end locality.
+ *
+ * ### Portability
+ * On platforms without `SO_REUSEPORT` (Windows), all shards accept from one shared listener; the loops and
+ * threads are still independent, but the accept queue is not. Pinning and CPU steering are Linux-only.
+ *
+ * ### Errors
+ * Exceptions escaping a session, and accept failures other than transient ones, are passed to the optional
+ * error handler from the shard's thread. After a resource-exhaustion failure (`EMFILE`, `ENFILE`, ...) the
+ * shard backs off for 10 ms before accepting again.
+ *
+ * ### Example
+ * @code{.cpp}
+ * ShardedServer server(8080, [](EventLoop& loop, Socket client) -> Task<void> {
+ *     while (true)
+ *         co_await asyncWriteAll(loop, client, co_await asyncReadUntil(loop, client, "\n"));
+ * });
+ * // ...
+ * server.stop();
+ * @endcode
+ *
+ * @see EventLoop
+ * @see AcceptLoop
+ * @see SocketOptions::setReusePort()
+ */
+class ShardedServer
+{
+  public:
+    /// @brief Creates the session coroutine for one accepted connection; runs on the accepting shard's thread.
+    using SessionFactory = std::function<Task<void>(EventLoop&, Socket)>;
+
+    /// @brief Receives accept failures and exceptions escaping sessions.
+    using ErrorHandler = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @brief Binds every shard's listener and starts the shard threads.
+     *
+     * @param[in] port Port to serve; `0` lets the first shard pick an ephemeral port that the others then join
+     *                 (see `getLocalPort()`).
+     * @param[in] factory Session factory, called once per accepted connection.
+     * @param[in] options Shard count, bind address and CPU placement.
+     * @param[in] onError Optional error sink; if empty, errors are dropped.
+     *
+     * @throws SocketException If `factory` is empty, or a listener, event loop or thread cannot be created.
+     */
+    ShardedServer(Port port, SessionFactory factory, ShardedServerOptions options = {}, ErrorHandler onError = {});
+
+    /**
+     * @brief Stops all shards and joins their threads. See `stop()`.
+     */
+    ~ShardedServer() noexcept;
+
+    /**
+     * @brief Copy construction is disallowed; the server owns threads.
+     */
+    ShardedServer(const ShardedServer&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; the server owns threads.
+     */
+    ShardedServer& operator=(const ShardedServer&) = delete;
+
+    /**
+     * @brief Move construction is disallowed; running threads refer to this object.
+     */
+    ShardedServer(ShardedServer&&) = delete;
+
+    /**
+     * @brief Move assignment is disallowed; running threads refer to this object.
+     */
+    ShardedServer& operator=(ShardedServer&&) = delete;
+
+    /**
+     * @brief Stops accepting, joins the shard threads, destroys unfinished sessions (closing their sockets) and
+     *        closes the listeners.
+     *
+     * Idempotent. When called from a session, the calling shard's thread is not joined (it cannot join itself)
+     * and its loop is kept, since the session runs inside it; the thread exits once the session suspends or
+     * returns, and the destructor must then run on another thread to join it and destroy the loop.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief `true` until `stop()` is called.
+     */
+    [[nodiscard]] bool isRunning() const noexcept { return !_stopping.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Port all shards are bound to.
+     */
+    [[nodiscard]] Port getLocalPort() const noexcept { return _port; }
+
+    /**
+     * @brief Number of shards.
+     */
+    [[nodiscard]] std::size_t shardCount() const noexcept { return _shards.size(); }
+
+    /**
+     * @brief Connections accepted by shard @p index so far.
+     * @throws std::out_of_range If @p index is not less than `shardCount()`.
+     */
+    [[nodiscard]] std::uint64_t acceptedCount(std::size_t index) const;
+
+    /**
+     * @brief Connections accepted by all shards so far.
+     */
+    [[nodiscard]] std::uint64_t acceptedCount() const noexcept;
+
+    /**
+     * @brief `true` if the CPU-steering reuseport program is attached to the listeners.
+     */
+    [[nodiscard]] bool isCpuSteeringActive() const noexcept { return _cpuSteering; }
+
+  private:
+    /// @brief One listener, loop and thread.
+    struct Shard
+    {
+        std::shared_ptr<ServerSocket> listener{}; ///< Own listener, or the shared one without `SO_REUSEPORT`.
+        std::unique_ptr<EventLoop> loop{};        ///< Runs the accept loop and sessions; released by `stop()`.
+        std::atomic<std::uint64_t> accepted{0};   ///< Connections accepted by this shard.
+        std::thread thread{};                     ///< Runs `EventLoop::runOnce()` until stopped.
+    };
+
+    Task<void> acceptLoop(Shard& shard);
+    void shardMain(Shard& shard, std::size_t index);
+    void reportError(std::exception_ptr error) noexcept;
+
+    SessionFactory _factory;                       ///< Session factory.
+    ErrorHandler _onError;                         ///< Optional error sink.
+    ShardedServerOptions _options;                 ///< Configuration fixed at construction.
+    Port _port = 0;                                ///< Port shared by all listeners.
+    bool _cpuSteering = false;                     ///< Reuseport CBPF program attached.
+    std::atomic<bool> _stopping{false};            ///< Set once by `stop()`.
+    std::mutex _stopMutex{};                       ///< Serializes `stop()` calls.
+    std::vector<std::unique_ptr<Shard>> _shards{}; ///< Shards, in listener bind order.
+};
+
+} // namespace jsocketpp
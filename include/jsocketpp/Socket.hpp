@@ -8,18 +8,28 @@
 
 #pragma once
 
+#include "BufferPool.hpp"
 #include "BufferView.hpp"
 #include "common.hpp"
+#include "IoResult.hpp"
 #include "SocketException.hpp"
 #include "SocketOptions.hpp"
+#include "internal/PollWait.hpp"
+#include "internal/ReceiveBuffer.hpp"
 
 #include <array>
 #include <bit>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <memory_resource>
 #include <optional>
 #include <span>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 using jsocketpp::DefaultBufferSize;
@@ -27,6 +37,8 @@ using jsocketpp::DefaultBufferSize;
 namespace jsocketpp
 {
 
+class IoService;
+
 /**
  * @class Socket
  * @ingroup tcp
@@ -68,7 +80,12 @@ namespace jsocketpp
  *
  * ### Internal Buffer
  * - The socket maintains an internal read buffer (default: @ref DefaultBufferSize).
+ * - All read methods consume from this buffer first, so bytes received past a delimiter or a fixed-size
+ *   object are kept for the next call instead of being dropped. A single `recv()` can therefore serve
+ *   many small reads (e.g. pipelined lines or length-prefixed frames).
  * - You can resize it with `setInternalBufferSize()` if you expect to receive larger or smaller messages.
+ * - The buffer's memory is borrowed from a shared `BufferPool` only while it holds unread bytes, so idle
+ *   connections, and those whose reads drain it completely, do not keep one allocated.
  *
  * ### Error Handling
  * - Almost all methods throw `jsocketpp::SocketException` on error (e.g., connect failure, write error, etc).
@@ -106,6 +123,11 @@ class Socket : public SocketOptions
      */
     friend class ServerSocket;
 
+    /**
+     * @brief Grants `IoService` access to the accepted-socket constructor for io_uring multishot accepts.
+     */
+    friend class IoService;
+
   protected:
     /**
      * @brief Wraps an accepted TCP client socket with optional tuning parameters.
@@ -147,23 +169,26 @@ class Socket : public SocketOptions
      * @param[in] client A connected socket descriptor returned by `accept()`
      * @param[in] addr The client's address information (from `accept()`)
      * @param[in] len Length of the address structure
-     * @param[in] recvBufferSize OS-level receive buffer size
-     * @param[in] sendBufferSize OS-level send buffer size
+     * @param[in] recvBufferSize OS-level receive buffer size; `std::nullopt` keeps the inherited size
+     * @param[in] sendBufferSize OS-level send buffer size; `std::nullopt` keeps the inherited size
      * @param[in] internalBufferSize Internal read buffer size
      * @param[in] soRecvTimeoutMillis Timeout for `recv()`/`read()` in milliseconds; `-1` disables
      * @param[in] soSendTimeoutMillis Timeout for `send()` in milliseconds; `-1` disables
-     * @param[in] tcpNoDelay Whether to disable Nagle's algorithm
-     * @param[in] keepAlive Whether to enable TCP keep-alive
-     * @param[in] nonBlocking Whether to set the socket to non-blocking mode
+     * @param[in] tcpNoDelay Whether to disable Nagle's algorithm; `std::nullopt` keeps the inherited setting
+     * @param[in] keepAlive Whether to enable TCP keep-alive; `std::nullopt` keeps the inherited setting
+     * @param[in] nonBlocking Whether to set the socket to non-blocking mode; `std::nullopt` leaves the mode the
+     *                        descriptor was accepted with
      *
      * @throws SocketException If any tuning operation fails after the socket is accepted
      *
      * @see ServerSocket::accept(), setSoRecvTimeout(), setSoSendTimeout(), setTcpNoDelay(), setNonBlocking()
      */
-    Socket(SOCKET client, const sockaddr_storage& addr, socklen_t len, std::size_t recvBufferSize = DefaultBufferSize,
-           std::size_t sendBufferSize = DefaultBufferSize, std::size_t internalBufferSize = DefaultBufferSize,
-           int soRecvTimeoutMillis = -1, int soSendTimeoutMillis = -1, bool tcpNoDelay = true, bool keepAlive = false,
-           bool nonBlocking = false);
+    Socket(SOCKET client, const sockaddr_storage& addr, socklen_t len,
+           std::optional<std::size_t> recvBufferSize = DefaultBufferSize,
+           std::optional<std::size_t> sendBufferSize = DefaultBufferSize,
+           std::size_t internalBufferSize = DefaultBufferSize, int soRecvTimeoutMillis = -1,
+           int soSendTimeoutMillis = -1, std::optional<bool> tcpNoDelay = true, std::optional<bool> keepAlive = false,
+           std::optional<bool> nonBlocking = false);
 
   public:
     /**
@@ -331,13 +356,15 @@ class Socket : public SocketOptions
         : SocketOptions(rhs.getSocketFd()), _remoteAddr(rhs._remoteAddr), _remoteAddrLen(rhs._remoteAddrLen),
           _cliAddrInfo(std::move(rhs._cliAddrInfo)), _selectedAddrInfo(rhs._selectedAddrInfo),
           _internalBuffer(std::move(rhs._internalBuffer)), _isBound(rhs._isBound), _isConnected(rhs._isConnected),
-          _inputShutdown(rhs._inputShutdown), _outputShutdown(rhs._outputShutdown)
+          _inputShutdown(rhs._inputShutdown), _outputShutdown(rhs._outputShutdown),
+          _memoryResource(rhs._memoryResource), _zeroCopy(std::move(rhs._zeroCopy))
     {
         rhs.setSocketFd(INVALID_SOCKET);
         rhs._selectedAddrInfo = nullptr;
         rhs._isBound = false;
         rhs._isConnected = false;
         rhs.resetShutdownFlags();
+        rhs._zeroCopy = {};
     }
 
     /**
@@ -425,6 +452,8 @@ class Socket : public SocketOptions
             _isConnected = rhs._isConnected;
             _inputShutdown = rhs._inputShutdown;
             _outputShutdown = rhs._outputShutdown;
+            _memoryResource = rhs._memoryResource;
+            _zeroCopy = std::move(rhs._zeroCopy);
 
             // Reset source
             rhs.setSocketFd(INVALID_SOCKET);
@@ -432,6 +461,7 @@ class Socket : public SocketOptions
             rhs._isBound = false;
             rhs._isConnected = false;
             rhs.resetShutdownFlags();
+            rhs._zeroCopy = {};
         }
         return *this;
     }
@@ -814,23 +844,19 @@ class Socket : public SocketOptions
      *
      * - **Non-blocking Mode with Timeout** (`timeoutMillis >= 0`):
      *   - Temporarily switches the socket to non-blocking mode.
-     *   - Initiates a connection and waits for readiness using `select()`.
+     *   - Initiates a connection and waits for writability with `poll()` (`ppoll()` on Linux, `WSAPoll()` on
+     *     Windows).
      *   - Throws an exception if the connection does not complete within the timeout period.
      *   - Restores original blocking mode automatically (RAII).
      *   - Recommended for GUI, async, or responsive applications.
      *
      * ### Implementation Details
-     * - Uses `::connect()` followed by `::select()` to monitor write readiness.
+     * - Uses `::connect()` followed by a `poll()`-family wait to monitor write readiness, so descriptors of any
+     *   value are supported (there is no `FD_SETSIZE` ceiling as with `select()`).
+     * - The timeout is measured on `std::chrono::steady_clock`, so wall-clock adjustments do not affect it.
      * - Once writable, uses `getsockopt(SO_ERROR)` to determine if the connection succeeded.
-     * - On POSIX systems, if the socket descriptor exceeds `FD_SETSIZE`, a `SocketException` is thrown.
      * - The socket's original blocking mode is automatically restored using `ScopedBlockingMode`.
      *
-     * ### Platform Notes
-     * - On **POSIX**, `select()` monitors the socket using `fd_set`; the file descriptor must be `< FD_SETSIZE`
-     * (typically 1024).
-     * - On **Windows**, `select()` ignores its first parameter and allows descriptors up to `~2030`, but limits still
-     * apply.
-     *
      * ### Example Usage
      * @code{.cpp}
      * Socket sock("example.com", 80);
@@ -857,8 +883,7 @@ class Socket : public SocketOptions
      *         - No address information was resolved
      *         - The socket is invalid or closed
      *         - The connection fails (e.g., refused, unreachable, or timed out)
-     *         - The descriptor exceeds platform-specific `select()` limits
-     *         - `getsockopt()` reports an error after select returns success
+     *         - `getsockopt()` reports an error after the wait reports writability
      *
      * @note This method is **not thread-safe**. Do not call `connect()` on the same `Socket`
      *       instance concurrently from multiple threads.
@@ -870,6 +895,42 @@ class Socket : public SocketOptions
      */
     void connect(int timeoutMillis = -1);
 
+    /**
+     * @brief Starts a non-blocking connection attempt without waiting for it to complete.
+     * @ingroup tcp
+     *
+     * Switches the socket to non-blocking mode (permanently) and issues `::connect()` to the address
+     * resolved at construction. This is the first half of the connect sequence used by event loops, in the
+     * style of Java's `SocketChannel.connect()`:
+     *
+     * @code{.cpp}
+     * if (!sock.beginConnect()) {
+     *     // wait until the socket is writable (Selector, EventLoop::writable(), ...)
+     *     sock.finishConnect();
+     * }
+     * @endcode
+     *
+     * @return `true` if the connection completed immediately (typical for loopback), `false` if it is in
+     *         progress and `finishConnect()` must be called once the socket becomes writable.
+     * @throws SocketException If the socket is already connected, no address was resolved, or the attempt
+     *         fails immediately.
+     *
+     * @see finishConnect(), connect()
+     */
+    [[nodiscard]] bool beginConnect();
+
+    /**
+     * @brief Completes a connection started by `beginConnect()` once the socket is writable.
+     * @ingroup tcp
+     *
+     * Reads the outcome of the attempt with `getsockopt(SO_ERROR)` and marks the socket as connected.
+     *
+     * @throws SocketException If the connection attempt failed (refused, unreachable, ...).
+     *
+     * @see beginConnect()
+     */
+    void finishConnect();
+
     /**
      * @brief Reads a fixed-size, trivially copyable object of type `T` from the socket.
      * @ingroup tcp
@@ -880,9 +941,10 @@ class Socket : public SocketOptions
      * a binary stream, without any decoding or parsing overhead.
      *
      * ### Implementation Details
-     * - Allocates a temporary buffer of `sizeof(T)` bytes
-     * - Loops on `recv()` until all bytes are received (handles partial reads)
-     * - Copies the buffer into a `std::array<std::byte, sizeof(T)>` and performs a `std::bit_cast`
+     * - Consumes bytes already held in the internal buffer first
+     * - Refills the internal buffer with `recv()` until `sizeof(T)` bytes are available (handles partial reads);
+     *   surplus bytes stay buffered for the next read
+     * - Copies the bytes into a `std::array<std::byte, sizeof(T)>` and performs a `std::bit_cast`
      * - Enforces type constraint: `std::is_trivially_copyable_v<T>` and `std::is_standard_layout_v<T>`
      * - Performs **no** byte order conversion, alignment, or field normalization
      *
@@ -936,8 +998,8 @@ class Socket : public SocketOptions
      *          custom allocators, or layout-dependent structures. Misuse may result in
      *          undefined behavior, security vulnerabilities, or memory corruption.
      *
-     * @note This method allocates a temporary buffer for each call. It does not use
-     *       or affect the internal string buffer used by methods like `readUntil()`.
+     * @note This method shares the internal read buffer with `readUntil()`, `readExact()` and the other
+     *       read methods, so mixing them on the same stream preserves byte order.
      *
      * @see write()              For writing fixed-size objects to the socket
      * @see readPrefixed()       For reading length-prefixed dynamic types
@@ -950,30 +1012,14 @@ class Socket : public SocketOptions
         static_assert(std::is_standard_layout_v<T>, "Socket::read<T>() requires a standard layout type");
 
         std::array<std::byte, sizeof(T)> buffer{};
-        std::size_t totalRead = 0;
-        std::size_t remaining = sizeof(T);
+        std::size_t totalRead = consumeBuffered(buffer.data(), sizeof(T));
 
-        while (remaining > 0)
+        while (totalRead < sizeof(T))
         {
-            const auto len = ::recv(getSocketFd(), reinterpret_cast<char*>(buffer.data()) + totalRead,
-#ifdef _WIN32
-                                    static_cast<int>(remaining),
-#else
-                                    remaining,
-#endif
-                                    0);
-
-            if (len == SOCKET_ERROR)
-            {
-                const int error = GetSocketError();
-                throw SocketException(error, SocketErrorMessage(error));
-            }
-
-            if (len == 0)
+            if (fillInternalBuffer() == 0)
                 throw SocketException("Connection closed by remote host before full object was received.");
 
-            totalRead += static_cast<std::size_t>(len);
-            remaining -= static_cast<std::size_t>(len);
+            totalRead += consumeBuffered(buffer.data() + totalRead, sizeof(T) - totalRead);
         }
 
         return std::bit_cast<T>(buffer);
@@ -988,9 +1034,9 @@ class Socket : public SocketOptions
      * or disconnection occurs. This method guarantees exact-length delivery
      * and is suitable for fixed-length binary protocols or framed data.
      *
-     * Internally, it repeatedly calls `recv()` as needed to handle partial reads.
-     * It allocates a string of size `n` and fills it directly with received data
-     * in order, preserving byte order and content integrity.
+     * Internally, it drains the internal read buffer first and then calls `recv()` as needed to
+     * handle partial reads. Small remainders are received through the internal buffer (so a single
+     * `recv()` can serve following reads); large remainders are received directly into the result.
      *
      * ### Implementation Details
      * - Uses a loop around `recv()` to read remaining bytes
@@ -1037,6 +1083,28 @@ class Socket : public SocketOptions
      */
     std::string readExact(std::size_t n) const;
 
+    /**
+     * @brief Reads exactly @p n bytes into a string allocated from @p resource.
+     * @ingroup tcp
+     *
+     * Same as `readExact(std::size_t)`, but the result uses a `std::pmr` allocator, so a request handler can read
+     * into a per-request arena (e.g. `std::pmr::monotonic_buffer_resource`) instead of the global heap.
+     *
+     * @code{.cpp}
+     * std::array<std::byte, 4096> storage;
+     * std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size());
+     * std::pmr::string header = sock.readExact(16, &arena); // no malloc
+     * @endcode
+     *
+     * @param[in] n        The number of bytes to read.
+     * @param[in] resource Resource for the returned string; `nullptr` selects `getMemoryResource()`.
+     * @return A `std::pmr::string` containing exactly `n` bytes.
+     * @throws SocketException As `readExact(std::size_t)`.
+     *
+     * @see setMemoryResource()
+     */
+    std::pmr::string readExact(std::size_t n, std::pmr::memory_resource* resource) const;
+
     /**
      * @brief Reads data from the socket until a specified delimiter character is encountered.
      * @ingroup tcp
@@ -1052,8 +1120,10 @@ class Socket : public SocketOptions
      *
      * ### Implementation Details
      * - Uses `_internalBuffer` for buffered reads (size configurable via `setInternalBufferSize()`)
-     * - Performs repeated `recv()` calls to fill the buffer and search for the delimiter
-     * - Tracks and accumulates received data until the delimiter is located
+     * - Scans bytes already buffered before issuing any `recv()`; each byte is scanned only once
+     * - The scan is vectorized (SSE2/AVX2, selected at runtime) with a scalar fallback on other targets
+     * - Bytes received after the delimiter are retained for subsequent reads (pipelining-safe)
+     * - If a pending line fills the whole buffer, the buffer grows (up to `maxLen`) instead of dropping data
      * - Supports truncation or inclusion of the delimiter via `includeDelimiter`
      * - Throws on early connection close or delimiter absence beyond `maxLen`
      *
@@ -1097,6 +1167,58 @@ class Socket : public SocketOptions
      */
     std::string readUntil(char delimiter, std::size_t maxLen = 8192, bool includeDelimiter = true);
 
+    /**
+     * @brief Reads data from the socket until a multi-byte delimiter sequence is encountered.
+     * @ingroup tcp
+     *
+     * Multi-byte counterpart of `readUntil(char, std::size_t, bool)`, intended for text protocols whose
+     * records end in a sequence rather than a single byte, such as `"\r\n"` (line-oriented protocols) or
+     * `"\r\n\r\n"` (end of an HTTP header block).
+     *
+     * The delimiter may be split across several `recv()` calls. After an unsuccessful scan only the last
+     * `delimiter.size() - 1` bytes of the buffered window are examined again once more data arrives, so
+     * the cost of a read stays linear in the number of received bytes regardless of how the stream is
+     * fragmented.
+     *
+     * ### Implementation Details
+     * - Shares the internal buffer with all other stream reads; bytes past the delimiter are retained
+     * - Candidate positions are filtered with a vectorized first/last-byte comparison (SSE2/AVX2 selected
+     *   at runtime, scalar fallback elsewhere) before the full delimiter is compared
+     * - A single-byte delimiter behaves exactly like `readUntil(char, std::size_t, bool)`
+     * - `maxLen` counts the delimiter itself; the buffer grows up to `maxLen` for long records
+     *
+     * ### Example Usage
+     * @code{.cpp}
+     * Socket sock("example.com", 80);
+     * sock.connect();
+     * sock.writeAll("GET / HTTP/1.1\r\nHost: example.com\r\n\r\n");
+     *
+     * // Status line without the trailing CRLF
+     * std::string status = sock.readUntil("\r\n", 1024, false);
+     *
+     * // Remaining header block, including the terminating blank line
+     * std::string headers = sock.readUntil("\r\n\r\n", 64 * 1024);
+     * @endcode
+     *
+     * @param[in] delimiter Non-empty byte sequence that terminates the record.
+     * @param[in] maxLen Maximum number of bytes (including the delimiter) to read before giving up (default: 8192).
+     * @param[in] includeDelimiter Whether to include the delimiter in the returned string (default: true).
+     *
+     * @return A `std::string` containing the data read up to the delimiter.
+     *
+     * @throws SocketException If:
+     *         - `delimiter` is empty or longer than `maxLen`
+     *         - The connection is closed before the delimiter is received
+     *         - `maxLen` bytes are read without finding the delimiter
+     *         - A network or system error occurs during reading
+     * @throws SocketTimeoutException If a configured receive timeout expires.
+     *
+     * @see readUntil(char, std::size_t, bool) Single-byte delimiter variant
+     * @see readLine() For newline-terminated text input
+     * @see setInternalBufferSize() To configure the initial buffer size
+     */
+    std::string readUntil(std::string_view delimiter, std::size_t maxLen = 8192, bool includeDelimiter = true);
+
     /**
      * @brief Reads a line terminated by '\n' from the socket.
      * @ingroup tcp
@@ -1182,6 +1304,21 @@ class Socket : public SocketOptions
      */
     std::string readAtMost(std::size_t n) const;
 
+    /**
+     * @brief Reads up to @p n bytes into a string allocated from @p resource.
+     * @ingroup tcp
+     *
+     * Same as `readAtMost(std::size_t)`, but the result uses a `std::pmr` allocator.
+     *
+     * @param[in] n        Maximum number of bytes to read.
+     * @param[in] resource Resource for the returned string; `nullptr` selects `getMemoryResource()`.
+     * @return The bytes received, at most @p n.
+     * @throws SocketException As `readAtMost(std::size_t)`.
+     *
+     * @see setMemoryResource()
+     */
+    std::pmr::string readAtMost(std::size_t n, std::pmr::memory_resource* resource) const;
+
     /**
      * @brief Reads available data from the socket into the provided buffer.
      * @ingroup tcp
@@ -1224,9 +1361,27 @@ class Socket : public SocketOptions
      * @see readIntoExact() For guaranteed full-length reads
      * @see read() Template method for type-safe reads
      * @see readUntil() For delimiter-based reading
+     * @see tryReadInto() Non-throwing variant for readiness loops
      */
     std::size_t readInto(void* buffer, const std::size_t len) const { return readIntoInternal(buffer, len, false); }
 
+    /**
+     * @brief Non-throwing `readInto()`: reads up to @p len bytes and reports the outcome as an `IoResult`.
+     * @ingroup tcp
+     *
+     * Same transfer as `readInto()` (buffered bytes first, then at most one `recv()`), but would-block, end of
+     * stream and errors are returned rather than thrown, with no allocation. Intended for non-blocking sockets
+     * driven by a readiness loop, where most attempts may find no data.
+     *
+     * @param[out] buffer Destination for the received bytes.
+     * @param[in] len Capacity of @p buffer in bytes.
+     * @return `Ok` with the byte count (0 only if @p buffer is null or @p len is 0), `WouldBlock` if no data is
+     *         available yet, `Closed` once the peer has shut down its side, or `Error` with the native code.
+     *
+     * @see readInto(), IoResult
+     */
+    [[nodiscard]] IoResult tryReadInto(void* buffer, std::size_t len) const noexcept;
+
     /**
      * @brief Reads exactly `len` bytes into the given buffer (looped recv).
      * @ingroup tcp
@@ -1547,6 +1702,20 @@ class Socket : public SocketOptions
      */
     std::string readAvailable() const;
 
+    /**
+     * @brief Reads all immediately available bytes into a string allocated from @p resource.
+     * @ingroup tcp
+     *
+     * Same as `readAvailable()`, but the result uses a `std::pmr` allocator.
+     *
+     * @param[in] resource Resource for the returned string; `nullptr` selects `getMemoryResource()`.
+     * @return The available bytes; empty if none.
+     * @throws SocketException As `readAvailable()`.
+     *
+     * @see setMemoryResource()
+     */
+    std::pmr::string readAvailable(std::pmr::memory_resource* resource) const;
+
     /**
      * @brief Reads all currently available bytes into the provided buffer without blocking.
      * @ingroup tcp
@@ -1771,16 +1940,16 @@ class Socket : public SocketOptions
      * @brief Peeks at incoming data without consuming it.
      * @ingroup tcp
      *
-     * This method performs a non-destructive read of up to `n` bytes using the `MSG_PEEK` flag.
-     * It allows inspecting the contents of the socket's receive buffer without removing the
-     * data from the queue. This is useful for implementing lookahead parsing, protocol sniffing,
-     * or waiting for specific patterns before consuming data.
+     * This method performs a non-destructive read of up to `n` bytes. Data is pulled into the
+     * socket's internal read buffer and returned without being consumed, so the next read call
+     * returns the same bytes without another system call. This is useful for implementing lookahead
+     * parsing, protocol sniffing, or waiting for specific patterns before consuming data.
      *
      * ### Implementation Details
-     * - Performs a single `recv()` call with `MSG_PEEK`
-     * - Does not remove any bytes from the socket buffer
-     * - May return fewer bytes than requested if less data is available
-     * - Does not block indefinitely if the socket is non-blocking or has a timeout
+     * - Blocks in a single `recv()` only when the internal buffer is empty
+     * - Tops up a partially filled buffer only if the kernel already reports pending bytes (`FIONREAD`)
+     * - Does not consume any bytes from the stream
+     * - May return fewer bytes than requested if less data is available (or `n` exceeds the buffer size)
      *
      * ### Example Usage
      * @code{.cpp}
@@ -1807,6 +1976,113 @@ class Socket : public SocketOptions
      */
     std::string peek(std::size_t n) const;
 
+    /**
+     * @brief Peeks at up to @p n bytes, returning a string allocated from @p resource.
+     * @ingroup tcp
+     *
+     * Same as `peek(std::size_t)`, but the result uses a `std::pmr` allocator.
+     *
+     * @param[in] n        Maximum number of bytes to peek.
+     * @param[in] resource Resource for the returned string; `nullptr` selects `getMemoryResource()`.
+     * @return Up to @p n bytes, which remain unread.
+     * @throws SocketException As `peek(std::size_t)`.
+     *
+     * @see setMemoryResource()
+     */
+    std::pmr::string peek(std::size_t n, std::pmr::memory_resource* resource) const;
+
+    /**
+     * @brief Returns a view of the next @p n bytes inside the internal read buffer, without copying or consuming.
+     * @ingroup tcp
+     *
+     * The zero-copy counterpart of `readExact()`: blocks until @p n bytes are buffered and returns them in place.
+     * The bytes stay unread until `consume()` is called, so a parser can look at a header, wait for the rest of
+     * the frame with a larger @p n, and consume the whole frame once it has handled it.
+     *
+     * ### Borrowed-view protocol
+     * - `viewExact()`, `viewAtMost()`, `viewUntil()` and `viewAvailable()` return views into the buffer.
+     * - A view is valid until the next call on this socket that reads, consumes, peeks or changes the buffer
+     *   (including another `view*()` call, which may compact or grow it).
+     * - `consume(n)` marks the first @p n buffered bytes as read. Once the buffer is empty, its storage goes back
+     *   to the `BufferPool`.
+     * - Use `std::as_bytes(std::span(view))` for a `std::span<const std::byte>`.
+     *
+     * @code{.cpp}
+     * // Length-prefixed frames without a std::string per message
+     * std::uint32_t length = 0;
+     * std::memcpy(&length, sock.viewExact(4).data(), 4);
+     * const auto frame = sock.viewExact(4 + net::fromNetwork(length));
+     * handle(frame.substr(4));
+     * sock.consume(frame.size());
+     * @endcode
+     *
+     * @param[in] n Number of bytes to view. If larger than the internal buffer, the buffer grows to @p n bytes
+     *              and keeps that size (see `setInternalBufferSize()`).
+     * @return View of exactly @p n bytes; empty if @p n is 0.
+     * @throws SocketException If the connection closes first or a socket error or timeout occurs.
+     *
+     * @see consume(), readExact()
+     */
+    [[nodiscard]] std::string_view viewExact(std::size_t n) const;
+
+    /**
+     * @brief Returns a view of up to @p n buffered bytes, receiving once if the buffer is empty.
+     * @ingroup tcp
+     *
+     * The zero-copy counterpart of `readAtMost()`. Nothing is consumed; follow the protocol described at
+     * `viewExact()`.
+     *
+     * @param[in] n Maximum number of bytes to view.
+     * @return View of between 1 and @p n bytes; empty only if @p n is 0.
+     * @throws SocketException If the connection is closed or a socket error or timeout occurs.
+     *
+     * @see consume(), viewExact()
+     */
+    [[nodiscard]] std::string_view viewAtMost(std::size_t n) const;
+
+    /**
+     * @brief Returns a view of the buffered bytes up to and including the next @p delimiter.
+     * @ingroup tcp
+     *
+     * The zero-copy counterpart of `readUntil()`: receives until @p delimiter is buffered and returns the line in
+     * place, delimiter included. Nothing is consumed; call `consume(view.size())` once the line is handled.
+     *
+     * @param[in] delimiter Non-empty delimiter to search for.
+     * @param[in] maxLen    Maximum line length, delimiter included.
+     * @return View of the line, ending with @p delimiter.
+     * @throws SocketException As `readUntil()`.
+     *
+     * @see consume(), readUntil()
+     */
+    [[nodiscard]] std::string_view viewUntil(std::string_view delimiter, std::size_t maxLen = 8192) const;
+
+    /**
+     * @brief Returns a view of every buffered byte, first topping up from the kernel without blocking.
+     * @ingroup tcp
+     *
+     * The zero-copy counterpart of `readAvailable()`. If the kernel reports pending data, one receive moves as
+     * much of it as fits into the internal buffer. Nothing is consumed.
+     *
+     * @return View of all buffered bytes; empty if none are available.
+     * @throws SocketException If the socket is invalid or a socket error occurs.
+     *
+     * @see consume(), readAvailable()
+     */
+    [[nodiscard]] std::string_view viewAvailable() const;
+
+    /**
+     * @brief Marks the first @p n buffered bytes as read.
+     * @ingroup tcp
+     *
+     * Completes the borrowed-view protocol of `viewExact()` and friends. Invalidates all views.
+     *
+     * @param[in] n Number of bytes to drop; at most `bufferedBytes()`.
+     * @throws SocketException If @p n exceeds `bufferedBytes()`.
+     *
+     * @see viewExact(), discard()
+     */
+    void consume(std::size_t n) const;
+
     /**
      * @brief Discards exactly `n` bytes from the socket by reading and discarding them.
      * @ingroup tcp
@@ -1995,9 +2271,22 @@ class Socket : public SocketOptions
      * @see writev() For vectorized scatter/gather writes
      * @see setNonBlocking() To configure non-blocking socket behavior
      * @see setSoSendTimeout() To configure write timeouts
+     * @see tryWrite() Non-throwing variant for readiness loops
      */
     [[nodiscard]] std::size_t write(std::string_view message) const;
 
+    /**
+     * @brief Non-throwing `write()`: one `send()` whose outcome is reported as an `IoResult`.
+     * @ingroup tcp
+     *
+     * @param[in] message The data to send.
+     * @return `Ok` with the number of bytes sent (possibly fewer than `message.size()`), `WouldBlock` if the send
+     *         buffer is full, or `Error` with the native code. Never `Closed`: a reset peer shows up as `Error`.
+     *
+     * @see write(), IoResult
+     */
+    [[nodiscard]] IoResult tryWrite(std::string_view message) const noexcept;
+
     /**
      * @brief Writes the entire contents of a message to the socket, retrying as needed.
      * @ingroup tcp
@@ -2249,7 +2538,8 @@ class Socket : public SocketOptions
      * ### Implementation Details
      * - On POSIX: uses `writev()` with `struct iovec[]`
      * - On Windows: uses `WSASend()` with `WSABUF[]`
-     * - Handles up to IOV_MAX or WSABUF_MAX entries (platform limit)
+     * - Passes at most `IOV_MAX` entries per call; longer lists send only their first `IOV_MAX` buffers
+     * - The descriptor array is built on the stack; no heap allocation
      * - Ensures the total byte count written is returned
      *
      * ### Example Usage
@@ -2286,8 +2576,9 @@ class Socket : public SocketOptions
      *
      * ### Implementation Details
      * - Uses `writev()` or `WSASend()` to send as much as possible
-     * - Tracks which buffers are partially sent
-     * - Rebuilds the buffer list on each retry to resume from the last offset
+     * - Converts the buffers into an `iovec`/`WSABUF` array on the stack, `IOV_MAX` entries at a time
+     * - After a partial send, skips the sent entries and trims the partially sent one in place, so the total
+     *   work is linear in the number of buffers; no heap allocation
      * - Stops only when all buffers are fully transmitted or an error occurs
      *
      * ### Example Usage
@@ -2434,6 +2725,106 @@ class Socket : public SocketOptions
      */
     std::size_t writeFromAll(const void* data, std::size_t len) const;
 
+#if defined(__linux__)
+    /**
+     * @brief Enables or disables zero-copy transmission (`SO_ZEROCOPY`) for `writeZeroCopy()`.
+     * @ingroup tcp
+     *
+     * With zero copy enabled, `writeZeroCopy()` passes `MSG_ZEROCOPY` so the kernel transmits directly from the
+     * caller's pages instead of copying them into socket buffers. This pays off for large payloads (hundreds of
+     * KiB and up); for small writes the page pinning and completion bookkeeping cost more than the copy saves.
+     *
+     * Enabling resets the mode to "active". If the kernel later reports that it had to copy the data anyway
+     * (e.g. loopback, or a device without scatter-gather), the socket falls back to ordinary sends on its own;
+     * see `isZeroCopyActive()`.
+     *
+     * @param[in] enable `true` to enable, `false` to disable.
+     * @throws SocketException If the kernel does not support `SO_ZEROCOPY` (Linux 4.14+ for TCP).
+     *
+     * @note Linux-only.
+     * @see writeZeroCopy(), waitZeroCopy()
+     */
+    void setZeroCopy(bool enable);
+
+    /**
+     * @brief Whether zero-copy transmission was enabled with `setZeroCopy()`.
+     * @ingroup tcp
+     * @note Linux-only.
+     */
+    [[nodiscard]] bool getZeroCopy() const noexcept { return _zeroCopy.enabled; }
+
+    /**
+     * @brief Whether `writeZeroCopy()` currently sends with `MSG_ZEROCOPY`.
+     * @ingroup tcp
+     *
+     * Becomes `false` once the kernel reports a copied completion (`SO_EE_CODE_ZEROCOPY_COPIED`), after which
+     * pinning pages only adds overhead. Calling `setZeroCopy(true)` again re-arms it.
+     *
+     * @note Linux-only.
+     */
+    [[nodiscard]] bool isZeroCopyActive() const noexcept { return _zeroCopy.active; }
+#endif
+
+    /**
+     * @brief Sends all of @p data, without copying it into the kernel when zero copy is enabled.
+     * @ingroup tcp
+     *
+     * Behaves like `writeAll()`, except that with `setZeroCopy(true)` each `send()` carries `MSG_ZEROCOPY`.
+     * The kernel then keeps referencing the caller's memory after this call returns, so **@p data must stay
+     * alive and unmodified until the returned ticket completes**. Check with `isZeroCopyComplete()` or block in
+     * `waitZeroCopy()`.
+     *
+     * Tickets are ordered: when a ticket completes, every earlier one has completed too. When zero copy is
+     * disabled, unsupported, or has fallen back, the data is copied as in `writeAll()` and the returned ticket
+     * completes together with earlier zero-copy sends (immediately, if there are none).
+     *
+     * ### Example
+     * @code{.cpp}
+     * sock.setZeroCopy(true);
+     * const auto ticket = sock.writeZeroCopy(blob);
+     * // ... do other work ...
+     * sock.waitZeroCopy(ticket); // blob may now be reused or freed
+     * @endcode
+     *
+     * @param[in] data Bytes to send; must outlive the returned ticket.
+     * @return Completion ticket for this write.
+     *
+     * @throws SocketException As for `writeAll()`.
+     *
+     * @note Completion notifications are read from the socket error queue (`MSG_ERRQUEUE`). While they are
+     *       pending the descriptor reports `POLLERR`, which readiness loops should treat as "call
+     *       `isZeroCopyComplete()`" rather than as a failure.
+     *
+     * @see setZeroCopy(), isZeroCopyComplete(), waitZeroCopy(), writeAll()
+     */
+    std::uint32_t writeZeroCopy(std::string_view data) const;
+
+    /**
+     * @brief Collects pending zero-copy notifications and reports whether @p ticket has completed.
+     * @ingroup tcp
+     *
+     * Never blocks. Once this returns `true`, the buffer passed to the corresponding `writeZeroCopy()` (and to
+     * every earlier one) may be reused.
+     *
+     * @param[in] ticket Value returned by `writeZeroCopy()`.
+     * @throws SocketException If reading the error queue fails.
+     */
+    [[nodiscard]] bool isZeroCopyComplete(std::uint32_t ticket) const;
+
+    /**
+     * @brief Blocks until @p ticket has completed.
+     * @ingroup tcp
+     *
+     * @param[in] ticket Value returned by `writeZeroCopy()`.
+     * @param[in] timeoutMillis Maximum wait in milliseconds; negative waits indefinitely.
+     *
+     * @throws SocketTimeoutException If the ticket has not completed within @p timeoutMillis.
+     * @throws SocketException If polling or reading the error queue fails, or if the connection fails or is
+     *         shut down while the ticket is still pending. The kernel may then still reference the buffer, so
+     *         keep it until the socket is closed.
+     */
+    void waitZeroCopy(std::uint32_t ticket, int timeoutMillis = -1) const;
+
     /**
      * @brief Writes the full payload with a total timeout across all retries.
      * @ingroup tcp
@@ -2505,7 +2896,7 @@ class Socket : public SocketOptions
      * - Uses `std::chrono::steady_clock` to enforce a total wall-clock timeout.
      * - Waits for writability using `waitReady(true, remainingTime)` between sends.
      * - Uses `writev()` to send multiple buffers in one system call.
-     * - After partial sends, dynamically rebuilds the buffer span to reflect unsent data.
+     * - After partial sends, advances past the sent bytes in place (no copying of the buffer list).
      *
      * ### Example Usage
      * @code{.cpp}
@@ -2548,6 +2939,91 @@ class Socket : public SocketOptions
      */
     std::size_t writevWithTotalTimeout(std::span<const std::string_view> buffers, int timeoutMillis) const;
 
+    /**
+     * @brief Progress callback for `sendFile()`: bytes sent so far and the total being sent.
+     * @ingroup tcp
+     */
+    using SendFileProgress = std::function<void(std::uint64_t sent, std::uint64_t total)>;
+
+    /**
+     * @brief Sends a range of an open file to the peer without copying it through user space.
+     * @ingroup tcp
+     *
+     * Transmits @p length bytes of @p fileDescriptor starting at @p offset. On Linux this uses `sendfile(2)`,
+     * so the file contents go from the page cache to the socket inside the kernel. Files that `sendfile()`
+     * cannot handle, and other platforms, fall back to reading 64 KiB chunks and sending them.
+     *
+     * The file position of @p fileDescriptor is not used or changed, so one descriptor can serve several
+     * connections concurrently.
+     *
+     * ### Semantics
+     * - Like `writeAll()`, returns only when everything was sent, or throws.
+     * - Partial sends are continued from where they stopped.
+     * - On a non-blocking socket, `EAGAIN` waits for writability instead of failing.
+     * - `SIGPIPE` is suppressed on POSIX; a closed peer surfaces as `SocketException` (`EPIPE`).
+     *
+     * ### Example
+     * @code{.cpp}
+     * const int fd = ::open("artifact.tar", O_RDONLY);
+     * sock.writeAll(header);
+     * sock.sendFile(fd); // the whole file
+     * @endcode
+     *
+     * @param[in] fileDescriptor Readable file descriptor (POSIX `open()`, or `_open()` on Windows).
+     * @param[in] offset Position in the file of the first byte to send.
+     * @param[in] length Number of bytes to send; `std::nullopt` sends up to the end of the file.
+     * @param[in] progress Optional callback invoked after each chunk with the running and total byte counts.
+     * @return Number of bytes sent (always the requested length on success).
+     *
+     * @throws SocketException If the socket is invalid, the file cannot be read or ends before @p length bytes,
+     *         or a network error occurs.
+     *
+     * @see sendFileWithTotalTimeout(), writeAll()
+     */
+    std::uint64_t sendFile(int fileDescriptor, std::uint64_t offset = 0, std::optional<std::uint64_t> length = {},
+                           const SendFileProgress& progress = {}) const;
+
+    /**
+     * @brief Opens @p path and sends a range of it, as `sendFile(int, ...)`.
+     * @ingroup tcp
+     * @throws SocketException Additionally if @p path cannot be opened.
+     */
+    std::uint64_t sendFile(const std::string& path, std::uint64_t offset = 0, std::optional<std::uint64_t> length = {},
+                           const SendFileProgress& progress = {}) const;
+
+    /**
+     * @brief Sends a range of an open file, failing if it does not complete within @p timeoutMillis.
+     * @ingroup tcp
+     *
+     * The deadline-bounded variant of `sendFile()`, mirroring `writeWithTotalTimeout()`: before every chunk the
+     * socket is polled for writability with the time left, and a `SocketTimeoutException` is thrown once the
+     * deadline passes. Bytes sent before the timeout stay sent; @p progress reports how far the transfer got.
+     *
+     * @param[in] fileDescriptor Readable file descriptor.
+     * @param[in] offset Position in the file of the first byte to send.
+     * @param[in] length Number of bytes to send; `std::nullopt` sends up to the end of the file.
+     * @param[in] timeoutMillis Total time allowed for the whole transfer, in milliseconds.
+     * @param[in] progress Optional callback invoked after each chunk.
+     * @return Number of bytes sent (always the requested length on success).
+     *
+     * @throws SocketTimeoutException If the transfer does not complete in time.
+     * @throws SocketException As for `sendFile()`.
+     *
+     * @see sendFile(), writeWithTotalTimeout()
+     */
+    std::uint64_t sendFileWithTotalTimeout(int fileDescriptor, std::uint64_t offset,
+                                           std::optional<std::uint64_t> length, int timeoutMillis,
+                                           const SendFileProgress& progress = {}) const;
+
+    /**
+     * @brief Opens @p path and sends a range of it, as `sendFileWithTotalTimeout(int, ...)`.
+     * @ingroup tcp
+     * @throws SocketException Additionally if @p path cannot be opened.
+     */
+    std::uint64_t sendFileWithTotalTimeout(const std::string& path, std::uint64_t offset,
+                                           std::optional<std::uint64_t> length, int timeoutMillis,
+                                           const SendFileProgress& progress = {}) const;
+
     /**
      * @brief Writes multiple raw memory regions using vectorized I/O.
      * @ingroup tcp
@@ -2678,23 +3154,50 @@ class Socket : public SocketOptions
      */
     std::size_t writevFromWithTotalTimeout(std::span<BufferView> buffers, int timeoutMillis) const;
 
+    /**
+     * @brief Delivers incoming data through @p io until end of stream, error or cancellation.
+     * @ingroup tcp
+     *
+     * Shorthand for `io.asyncReceive(*this, handler)`; see `IoService::asyncReceive()` for the callback rules.
+     * The socket must outlive the operation.
+     *
+     * @return Operation identifier for `IoService::cancel()`.
+     * @throws SocketException If the socket is closed, already has a receive operation, or the request cannot
+     *         be queued.
+     */
+    std::uint64_t asyncReceive(IoService& io, std::function<void(std::span<const char>, std::exception_ptr)> handler);
+
+    /**
+     * @brief Sends @p buffers in order through @p io and reports the total once all are written.
+     * @ingroup tcp
+     *
+     * Shorthand for `io.asyncSendChain(*this, buffers, handler)`.
+     *
+     * @return Operation identifier for `IoService::cancel()`.
+     * @throws SocketException If the socket is closed or the request cannot be queued.
+     */
+    std::uint64_t asyncSendChain(IoService& io, std::vector<std::string> buffers,
+                                 std::function<void(std::size_t, std::exception_ptr)> handler = {}) const;
+
     /**
      * @brief Sets the size of the internal read buffer used for string operations.
      * @ingroup tcp
      *
-     * This method controls the size of the internal buffer used by read<std::string>()
-     * operations. This is distinct from setReceiveBufferSize(), which controls the
-     * operating system's socket buffer (SO_RCVBUF).
+     * This method controls the size of the internal read buffer shared by all read operations
+     * (`read<T>()`, `read<std::string>()`, `readUntil()`, `readExact()`, `peek()`, ...). This is
+     * distinct from setReceiveBufferSize(), which controls the operating system's socket buffer (SO_RCVBUF).
      *
      * ### Purpose
      * - Controls maximum size of data readable in one read<std::string>() call
-     * - Affects memory usage of the Socket object
+     * - Controls how many bytes a single buffered `recv()` may pull in for small reads
+     * - Sets the block size borrowed from the receive `BufferPool` while bytes are buffered
      * - Does not affect system socket buffers or network behavior
      *
      * ### Implementation Details
-     * - Resizes internal std::vector<char> buffer
-     * - Used only for string-based reads
-     * - Not used for fixed-size read<T>() operations
+     * - Records the new size only; no memory is allocated while the buffer is empty
+     * - Unread buffered bytes are preserved (moved to a block of the new size); the buffer never shrinks below
+     *   their count
+     * - `readUntil()` may grow the buffer (up to its `maxLen`) when a single line does not fit
      * - Thread-safe with respect to other Socket instances
      *
      * ### Example Usage
@@ -2709,15 +3212,124 @@ class Socket : public SocketOptions
      * std::string data = sock.read<std::string>();
      * @endcode
      *
-     * @param[in] newLen New size for the internal buffer in bytes
+     * @param[in] newLen New size for the internal buffer in bytes; must be greater than zero
+     * @throws SocketException If `newLen` is zero
      * @throws std::bad_alloc If memory allocation fails
      *
      * @see setReceiveBufferSize() For setting the OS socket receive buffer
      * @see read<std::string>() Uses this buffer for string operations
      * @see setSendBufferSize() For setting the OS socket send buffer
+     * @see setReceiveBufferPool() For choosing where the buffer memory comes from
      */
     void setInternalBufferSize(std::size_t newLen);
 
+    /**
+     * @brief Selects the pool the internal read buffer borrows its storage from.
+     * @ingroup tcp
+     *
+     * The internal read buffer holds memory only while it contains unread bytes: a buffered read borrows a block
+     * of `setInternalBufferSize()` bytes and returns it once every byte has been consumed. By default blocks come
+     * from `BufferPool::global()`, which keeps one block per size class for each thread; a per-thread or
+     * per-`EventLoop` pool avoids sharing free lists between threads altogether and bounds each one's cache
+     * separately.
+     *
+     * @param[in] pool Pool to use from now on; must outlive this socket. Buffered bytes, if any, are moved into a
+     *                 block from it.
+     * @throws std::bad_alloc If bytes are buffered and a block cannot be borrowed from @p pool.
+     *
+     * @see BufferPool, setInternalBufferSize()
+     */
+    void setReceiveBufferPool(BufferPool& pool);
+
+#if defined(__linux__)
+    /**
+     * @brief Backs the internal read buffer with a double-mapped ring instead of blocks from the `BufferPool`.
+     * @ingroup tcp
+     *
+     * The ring is one anonymous memory file (`memfd_create()`) mapped twice, back-to-back. Bytes that wrap past
+     * the end of the ring are still contiguous in memory, so a buffered `recv()` always lands in one free region
+     * and consumed bytes are never moved to the front of the buffer. This suits stream parsers that read
+     * messages through `readPrefixed()`, `readUntil()` or the `view*()` calls at high rates, where the linear
+     * buffer would otherwise `memmove` every partial message left at its end.
+     *
+     * The ring is at least `setInternalBufferSize()` bytes, rounded up to a multiple of the page size; later calls
+     * to `setInternalBufferSize()` (or growth by `readUntil()`/`viewExact()`) map a new ring. Unlike pooled blocks,
+     * the ring stays mapped while the buffer is empty, until mirroring is disabled or the socket is destroyed.
+     *
+     * @code{.cpp}
+     * sock.setInternalBufferSize(1 << 20);
+     * sock.setMirroredReceiveBuffer(true);
+     * while (true)
+     *     handle(sock.readPrefixed<std::uint32_t>());
+     * @endcode
+     *
+     * @param[in] enable `true` to switch to a ring, `false` to go back to pooled blocks. Buffered bytes are kept.
+     * @throws SocketException If the memory file cannot be created or mapped.
+     * @throws std::bad_alloc If disabling with bytes buffered and a block cannot be borrowed from the pool.
+     *
+     * @note Linux-only. No extra file descriptor stays open, but each ring counts as two mappings towards
+     *       `vm.max_map_count`, which matters with many thousands of mirrored sockets.
+     * @see setInternalBufferSize(), setReceiveBufferPool()
+     */
+    void setMirroredReceiveBuffer(bool enable);
+
+    /**
+     * @brief Whether the internal read buffer is a ring set up by `setMirroredReceiveBuffer()`.
+     * @ingroup tcp
+     * @note Linux-only.
+     */
+    [[nodiscard]] bool getMirroredReceiveBuffer() const noexcept { return _internalBuffer.mirrored(); }
+#endif
+
+    /**
+     * @brief Sets the memory resource for this socket's temporary allocations and `std::pmr` reads.
+     * @ingroup tcp
+     *
+     * `discard()` and the read-and-send fallback of `sendFile()` allocate their scratch buffers from this resource,
+     * as do the `std::pmr::string` overloads of `readExact()`, `readAtMost()`, `readAvailable()` and `peek()`
+     * when passed `nullptr`. Scatter/gather calls allocate nothing. Together with `setReceiveBufferPool()`, this
+     * lets a connection run without touching the global heap.
+     *
+     * @code{.cpp}
+     * std::pmr::unsynchronized_pool_resource perConnection;
+     * sock.setMemoryResource(&perConnection);
+     * std::pmr::string body = sock.readExact(length, nullptr); // from perConnection
+     * @endcode
+     *
+     * @param[in] resource Resource to use; must outlive this socket. `nullptr` restores
+     *                     `std::pmr::get_default_resource()`.
+     *
+     * @note Strings returned by the `std::string` overloads always use the global heap.
+     * @see getMemoryResource()
+     */
+    void setMemoryResource(std::pmr::memory_resource* resource) noexcept
+    {
+        _memoryResource = resource != nullptr ? resource : std::pmr::get_default_resource();
+    }
+
+    /**
+     * @brief Returns the memory resource set by `setMemoryResource()`.
+     * @ingroup tcp
+     *
+     * @return The resource; `std::pmr::get_default_resource()` (as of construction) unless changed.
+     */
+    [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const noexcept { return _memoryResource; }
+
+    /**
+     * @brief Returns the number of received bytes held in the internal read buffer.
+     * @ingroup tcp
+     *
+     * These bytes were already received from the kernel (e.g. past a `readUntil()` delimiter or by `peek()`)
+     * and will be returned by the next read call before any new `recv()` is issued. Event-driven code should
+     * drain them before waiting for readiness, because the kernel no longer reports them as readable.
+     *
+     * @return Number of unread buffered bytes.
+     *
+     * @see waitReady() Returns immediately for reads while this is non-zero
+     * @see setInternalBufferSize()
+     */
+    [[nodiscard]] std::size_t bufferedBytes() const noexcept { return _internalBuffer.size(); }
+
     /**
      * @brief Check if the socket is valid and open for communication.
      * @ingroup tcp
@@ -2760,19 +3372,20 @@ class Socket : public SocketOptions
      * @ingroup tcp
      *
      * This method performs a blocking or timed wait until the socket is ready for either
-     * reading or writing, depending on the `forWrite` parameter. Internally, it uses the
-     * `select()` system call to monitor readiness.
+     * reading or writing, depending on the `forWrite` parameter. Internally, it uses
+     * `ppoll()` (Linux), `poll()` (other POSIX) or `WSAPoll()` (Windows) on this single descriptor.
      *
      * The timeout is specified in milliseconds. A negative timeout value (e.g., `-1`)
      * causes the method to wait indefinitely until the socket becomes ready.
      * A timeout of `0` performs a non-blocking poll.
      *
      * ### Implementation Notes
-     * - Internally uses `select()` on both POSIX and Windows platforms.
-     * - On POSIX, the socket descriptor must be **less than `FD_SETSIZE`** (typically 1024).
-     *   If the descriptor exceeds this limit, a `SocketException` is thrown.
-     * - On Windows, the first parameter to `select()` is ignored and always set to 0.
+     * - Works for descriptors of any value; there is no `FD_SETSIZE` ceiling as with `select()`.
+     * - The timeout is measured against `std::chrono::steady_clock`; a wait interrupted by a signal resumes
+     *   with the time that is left.
      * - This method works for both blocking and non-blocking sockets.
+     * - When waiting for reads, returns `true` immediately if `bufferedBytes()` is non-zero.
+     * - Error and hang-up conditions count as ready; the next I/O call reports them.
      *
      * ### Example
      * @code{.cpp}
@@ -2795,27 +3408,12 @@ class Socket : public SocketOptions
      * @retval false The timeout expired before the socket became ready.
      *
      * @throws SocketException If:
-     *         - The socket is invalid (`INVALID_SOCKET`)
-     *         - The socket descriptor exceeds `FD_SETSIZE` (POSIX only)
+     *         - The socket is invalid (`INVALID_SOCKET`, or a descriptor the system reports as invalid)
      *         - A system error occurs during polling
      *
-     * @note
-     * This method uses the legacy `select()` system call, which is portable but has limitations:\n
-     * - On POSIX systems, it cannot monitor descriptors ≥ `FD_SETSIZE` (usually 1024)\n
-     * - `fd_set` is a static bitset, and overflow causes undefined behavior\n
-     * - `select()` scales poorly with large socket sets\n\n
-     * **Alternatives:**\n
-     * - On POSIX: `poll()` (removes FD_SETSIZE limit, cleaner API)\n
-     * - On Linux: `epoll` (scales to thousands of fds)\n
-     * - On BSD/macOS: `kqueue` (efficient and feature-rich)\n
-     * - On Windows: `WSAPoll()` (requires Windows Vista+), or I/O Completion Ports for async\n\n
-     * These alternatives are better suited for server-side multiplexing and event-driven designs.
-     * For single-socket or per-connection waiting, `select()` remains simple and widely compatible.
-     *
      * @see setBlocking() To configure blocking/non-blocking mode
      * @see read()        For reading data once the socket is ready
      * @see write()       For writing data once the socket is ready
-     * @see FD_SETSIZE    System-defined maximum descriptor index for `select()`
      */
     bool waitReady(bool forWrite, int timeoutMillis) const;
 
@@ -2969,6 +3567,35 @@ class Socket : public SocketOptions
      */
     std::size_t readIntoInternal(void* buffer, std::size_t len, bool exact = false) const;
 
+    /**
+     * @brief Performs one `recv()` into the free region of the internal read buffer.
+     * @ingroup tcp
+     *
+     * Unread bytes stay in place and the new bytes are appended after them. An empty buffer first borrows a
+     * block from its `BufferPool` (and gives it back if nothing arrives); when the free tail falls below half of
+     * the capacity the unread bytes are compacted to the front first.
+     *
+     * @return Number of bytes received; `0` means the peer closed the connection.
+     *
+     * @throws SocketException If `recv()` fails (including timeouts and `EWOULDBLOCK`), or if the buffer is
+     *         completely filled with unread bytes.
+     *
+     * @see consumeBuffered(), bufferedBytes()
+     */
+    std::size_t fillInternalBuffer() const;
+
+    /**
+     * @brief Copies up to `n` unread bytes out of the internal read buffer and advances the read cursor.
+     * @ingroup tcp
+     *
+     * @param[out] dst Destination memory (at least `n` bytes).
+     * @param[in] n Maximum number of bytes to copy.
+     * @return Number of bytes copied (`min(n, bufferedBytes())`).
+     *
+     * @see fillInternalBuffer(), bufferedBytes()
+     */
+    std::size_t consumeBuffered(void* dst, std::size_t n) const noexcept;
+
     /**
      * @brief Internal helper that closes the socket and clears address resolution state.
      * @ingroup tcp
@@ -3129,14 +3756,76 @@ class Socket : public SocketOptions
   private:
     sockaddr_storage _remoteAddr; ///< sockaddr_in for IPv4; sockaddr_in6 for IPv6; sockaddr_storage for both
     ///< (portability)
-    mutable socklen_t _remoteAddrLen = 0;         ///< Length of remote address (for recvfrom/recvmsg)
-    internal::AddrinfoPtr _cliAddrInfo = nullptr; ///< Address info for connection (from getaddrinfo)
-    addrinfo* _selectedAddrInfo = nullptr;        ///< Selected address info for connection
-    std::vector<char> _internalBuffer;            ///< Internal buffer for read operations, not thread-safe
-    bool _isBound = false;                        ///< True if the socket is bound to an address
-    bool _isConnected = false;                    ///< True if the socket is connected to a remote peer
-    bool _inputShutdown = false;                  ///< True if input side is shutdown (recv disabled)
-    bool _outputShutdown = false;                 ///< True if output side is shutdown (send disabled)
+    mutable socklen_t _remoteAddrLen = 0;            ///< Length of remote address (for recvfrom/recvmsg)
+    internal::AddrinfoPtr _cliAddrInfo = nullptr;    ///< Address info for connection (from getaddrinfo)
+    addrinfo* _selectedAddrInfo = nullptr;           ///< Selected address info for connection
+    mutable internal::ReceiveBuffer _internalBuffer; ///< Read buffer; holds pooled storage only while non-empty
+    bool _isBound = false;                           ///< True if the socket is bound to an address
+    bool _isConnected = false;                       ///< True if the socket is connected to a remote peer
+    bool _inputShutdown = false;                     ///< True if input side is shutdown (recv disabled)
+    bool _outputShutdown = false;                    ///< True if output side is shutdown (send disabled)
+
+    /// @brief Source of scratch allocations and `std::pmr` read results; see `setMemoryResource()`.
+    std::pmr::memory_resource* _memoryResource = std::pmr::get_default_resource();
+
+    /// @brief Bookkeeping for `writeZeroCopy()`; sequence numbers follow the kernel's per-socket counter.
+    struct ZeroCopyState
+    {
+        bool enabled = false;   ///< `SO_ZEROCOPY` set via `setZeroCopy()`
+        bool active = false;    ///< Sends carry `MSG_ZEROCOPY` (cleared on copied completions)
+        std::uint32_t sent = 0; ///< Number of `MSG_ZEROCOPY` sends issued
+        std::uint32_t done = 0; ///< Every send below this sequence number has completed
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> early{}; ///< Completed ranges past `done`
+    };
+    mutable ZeroCopyState _zeroCopy{}; ///< Zero-copy send state
+
+    /**
+     * @brief Drains zero-copy notifications from the error queue without blocking.
+     * @return `true` if at least one notification was read.
+     */
+    bool reapZeroCopyCompletions() const;
+
+    /**
+     * @brief Shared implementation of `sendFile()` and `sendFileWithTotalTimeout()`.
+     * @param[in] timeoutMillis Total deadline in milliseconds, or negative for none.
+     */
+    std::uint64_t sendFileImpl(int fileDescriptor, std::uint64_t offset, std::optional<std::uint64_t> length,
+                               int timeoutMillis, const SendFileProgress& progress) const;
+
+    /**
+     * @brief `waitReady()` against a deadline shared by several waits, as in the `*WithTotalTimeout()` loops.
+     * @return `true` if ready, `false` once @p deadline has passed.
+     */
+    bool waitReady(bool forWrite, const internal::Deadline& deadline) const;
+
+    /**
+     * @brief Shared body of both `readAtMost()` overloads; @p result is empty and supplies the allocator.
+     */
+    template <typename String> String readAtMostAs(std::size_t n, String result) const;
+
+    /**
+     * @brief Shared body of both `readAvailable()` overloads; @p result is empty and supplies the allocator.
+     */
+    template <typename String> String readAvailableAs(String result) const;
+
+    /**
+     * @brief Shared body of both `peek()` overloads; @p result is empty and supplies the allocator.
+     */
+    template <typename String> String peekAs(std::size_t n, String result) const;
+
+    /**
+     * @brief Receives until @p delimiter is buffered and returns the line length including it.
+     * @param[in] caller Name used in exception messages.
+     */
+    std::size_t bufferUntil(std::string_view delimiter, std::size_t maxLen, const char* caller) const;
+
+    /**
+     * @brief Resource for a `std::pmr` read: @p resource, or `getMemoryResource()` if it is `nullptr`.
+     */
+    [[nodiscard]] std::pmr::memory_resource* resourceOr(std::pmr::memory_resource* resource) const noexcept
+    {
+        return resource != nullptr ? resource : _memoryResource;
+    }
 };
 
 /**
@@ -3160,9 +3849,9 @@ class Socket : public SocketOptions
  *
  * ### Implementation Details
  * 1. Uses `_internalBuffer` sized via `setInternalBufferSize()`
- * 2. Performs a single `recv()` call up to the buffer size
- * 3. Returns a `std::string` containing only the received portion
- * 4. Internal buffer is reused across calls and not resized dynamically
+ * 2. If bytes are already buffered (e.g. left over from `readUntil()`), returns them without a syscall
+ * 3. Otherwise performs a single `recv()` call up to the buffer size
+ * 4. Returns a `std::string` containing only the received portion
  *
  * ### Example Usage
  * @code{.cpp}
@@ -3197,22 +3886,12 @@ class Socket : public SocketOptions
  */
 template <> inline std::string Socket::read()
 {
-    const auto len = recv(getSocketFd(), _internalBuffer.data(),
-#ifdef _WIN32
-                          static_cast<int>(_internalBuffer.size()),
-#else
-                          _internalBuffer.size(),
-#endif
-                          0);
-    if (len == SOCKET_ERROR)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-
-    if (len == 0)
+    if (bufferedBytes() == 0 && fillInternalBuffer() == 0)
         throw SocketException("Connection closed by remote host.");
-    return {_internalBuffer.data(), static_cast<size_t>(len)};
+
+    std::string result(_internalBuffer.data(), bufferedBytes());
+    _internalBuffer.clear();
+    return result;
 }
 
 } // namespace jsocketpp
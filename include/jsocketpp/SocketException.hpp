@@ -10,10 +10,13 @@
 
 #include "common.hpp"
 
+#include <concepts>
+#include <cstddef>
 #include <exception>
-#include <sstream>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace jsocketpp
@@ -56,26 +59,102 @@ namespace jsocketpp
  * }
  * @endcode
  *
+ * ### Lazy Messages
+ * Throwing is often the common path (timeouts in polling loops, `EAGAIN` on non-blocking sockets), so the
+ * constructors that take an error code only record it, together with the context text. The full message,
+ * including the system description from `SocketErrorMessage()`, is formatted on the first call to `what()` and
+ * cached; concurrent first calls are serialized with `std::call_once`. Context given as a string literal is
+ * referenced, not copied, so such exceptions allocate nothing. Any other string, including a `std::string`, a
+ * `const char*` or a pointer into a local buffer, is copied.
+ *
  * @note This class is exception-safe and designed for cross-platform error reporting.
  * @note Nested exceptions are supported but optional.
  */
 class SocketException : public std::runtime_error
 {
   public:
+    /**
+     * @brief Text known at compile time, which a SocketException may reference instead of copying.
+     *
+     * The constructor is `consteval`, so it only accepts a character array whose contents are a constant
+     * expression, such as a string literal. A local or otherwise mutable `char` buffer does not compile as a
+     * Literal; pass it as `std::string(buffer)` so that it is copied.
+     */
+    class Literal
+    {
+      public:
+        /**
+         * @brief Wraps the string literal @p text.
+         * @param text Null-terminated character array with static storage duration.
+         */
+        template <std::size_t N>
+        // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions) - literals convert implicitly
+        consteval Literal(const char (&text)[N]) : _text(text)
+        {
+            // Reading the array is what rejects buffers whose contents are not known at compile time
+            if (text[N - 1] != '\0')
+                throw "SocketException::Literal: text must be null-terminated";
+        }
+
+        /// @brief Returns the wrapped text.
+        [[nodiscard]] constexpr const char* c_str() const noexcept { return _text; }
+
+      private:
+        const char* _text; ///< Static, null-terminated text.
+    };
+
+    /**
+     * @brief Constructs a SocketException with the generic message `"SocketException"`.
+     * @ingroup exceptions
+     */
+    SocketException() : SocketException(Literal("SocketException")) {}
+
     /**
      * @brief Constructs a SocketException with a custom error message and no associated error code.
      * @ingroup exceptions
      *
      * This overload is typically used when the error does not correspond to a specific platform error code
      * (e.g., logic errors, precondition failures, etc.), but still warrants raising a socket-specific exception.
+     * The message is copied; character arrays go through `SocketException(Literal)` instead.
      *
+     * @tparam String Any type implicitly convertible to `std::string`, other than a character array.
      * @param message A human-readable description of the error context.
      *
-     * @see SocketException(int, const std::string&)
+     * @see SocketException(int, const String&)
      * @see getErrorCode()
      */
-    explicit SocketException(const std::string& message = "SocketException")
-        : std::runtime_error(message), _errorCode(0)
+    template <typename String>
+        requires(std::convertible_to<const String&, std::string> && !std::is_array_v<String>)
+    explicit SocketException(const String& message) : std::runtime_error(""), _errorCode(0), _message(message)
+    {
+    }
+
+    /**
+     * @brief Constructs a SocketException from a string literal, without copying it.
+     *
+     * @param message Static description of the failure; `what()` returns it as-is.
+     */
+    explicit SocketException(const Literal message)
+        : std::runtime_error(""), _errorCode(0), _context(message.c_str())
+    {
+    }
+
+    /**
+     * @brief Constructs a SocketException for a system error code, described by `SocketErrorMessage()`.
+     *
+     * This is the usual way to report a failed system call. Nothing is formatted until `what()` is called, which
+     * then returns the platform description of @p code followed by `" (error code N)"`.
+     *
+     * @code
+     * if (::recv(fd, buf, len, 0) == SOCKET_ERROR)
+     *     throw SocketException(GetSocketError());
+     * @endcode
+     *
+     * @param code Integer error code returned by the operating system (`errno`, `WSAGetLastError()`).
+     *
+     * @see getErrorCode()
+     */
+    explicit SocketException(const int code) : std::runtime_error(""), _errorCode(code), _withCode(true)
     {
     }
 
@@ -86,16 +165,31 @@ class SocketException : public std::runtime_error
      * (such as `errno` on POSIX or `WSAGetLastError()` on Windows), which is stored and included
      * in the final exception message.
      *
-     * The formatted error message passed to `std::runtime_error` includes the original message
-     * and the error code (e.g., "Connection failed (error code 111)").
+     * The message returned by `what()` includes the original message and the error code
+     * (e.g., "Connection failed (error code 111)"). An empty @p message is replaced by the system
+     * description of @p code, as in `SocketException(int)`.
      *
      * @param code    Integer error code returned by the operating system.
      * @param message Descriptive error message describing the failure context.
      *
+     * @tparam String  Any type implicitly convertible to `std::string`, other than a character array.
      * @see getErrorCode()
      */
-    explicit SocketException(const int code, const std::string& message = "SocketException")
-        : std::runtime_error(buildErrorMessage(message, code)), _errorCode(code)
+    template <typename String>
+        requires(std::convertible_to<const String&, std::string> && !std::is_array_v<String>)
+    SocketException(const int code, const String& message)
+        : std::runtime_error(""), _errorCode(code), _message(message), _withCode(true)
+    {
+    }
+
+    /**
+     * @brief Same as `SocketException(int, const String&)`, but references the string literal @p context.
+     *
+     * @param code    Integer error code returned by the operating system.
+     * @param context Static description of the failure context.
+     */
+    SocketException(const int code, const Literal context)
+        : std::runtime_error(""), _errorCode(code), _context(context.c_str()), _withCode(true)
     {
     }
 
@@ -125,8 +219,34 @@ class SocketException : public std::runtime_error
      * @see std::rethrow_if_nested
      */
     SocketException(const std::string& message, std::exception_ptr nested)
-        : std::runtime_error(message), _errorCode(0), _nested(std::move(nested))
+        : std::runtime_error(""), _errorCode(0), _message(message), _nested(std::move(nested))
+    {
+    }
+
+    /**
+     * @brief Returns the error message, formatting and caching it on first use.
+     *
+     * Messages without an error code are returned as given. Otherwise the result has the form
+     * `"message (error code 123)"`, where `message` is the context passed to the constructor or, if there was
+     * none, `SocketErrorMessage(getErrorCode())`.
+     *
+     * @return Null-terminated message, valid for the lifetime of this exception object.
+     */
+    [[nodiscard]] const char* what() const noexcept override
     {
+        if (!_withCode)
+            return _context ? _context : _message.c_str();
+
+        try
+        {
+            std::call_once(_formatted, [this] { _what = buildErrorMessage(); });
+        }
+        catch (...)
+        {
+            // Out of memory while formatting: fall back to the unformatted context
+            return _context ? _context : "SocketException";
+        }
+        return _what.c_str();
     }
 
     /**
@@ -139,7 +259,7 @@ class SocketException : public std::runtime_error
      *
      * @return Integer error code reported by the system at the time the exception was constructed.
      *
-     * @see SocketException(int, const std::string&)
+     * @see SocketException(int, const String&)
      */
     [[nodiscard]] int getErrorCode() const noexcept { return _errorCode; }
 
@@ -163,42 +283,106 @@ class SocketException : public std::runtime_error
      */
     [[nodiscard]] std::exception_ptr getNestedException() const noexcept { return _nested; }
 
+    /**
+     * @brief Copies the exception.
+     *
+     * The `what()` cache is not copied, since another thread may be filling it; the copy formats its own on first
+     * use.
+     *
+     * @param other Exception to copy.
+     */
+    SocketException(const SocketException& other)
+        : std::runtime_error(other), _errorCode(other._errorCode), _context(other._context), _message(other._message),
+          _withCode(other._withCode), _nested(other._nested)
+    {
+    }
+
+    /**
+     * @brief Moves the exception. As with copying, the `what()` cache is left behind.
+     * @param other Exception to move from.
+     */
+    SocketException(SocketException&& other) noexcept
+        : std::runtime_error(other), _errorCode(other._errorCode), _context(other._context),
+          _message(std::move(other._message)), _withCode(other._withCode), _nested(std::move(other._nested))
+    {
+    }
+
+    /**
+     * @brief Copy-assigns the exception.
+     *
+     * A `std::once_flag` cannot be reset, so the new message is formatted here instead of on the next `what()`.
+     *
+     * @param other Exception to copy.
+     * @return Reference to this exception.
+     */
+    SocketException& operator=(const SocketException& other)
+    {
+        if (this != &other)
+            assign(other._errorCode, other._context, other._message, other._withCode, other._nested);
+        return *this;
+    }
+
+    /**
+     * @brief Move-assigns the exception, formatting the new message eagerly as for copy assignment.
+     * @param other Exception to move from.
+     * @return Reference to this exception.
+     */
+    SocketException& operator=(SocketException&& other)
+    {
+        if (this != &other)
+            assign(other._errorCode, other._context, std::move(other._message), other._withCode,
+                   std::move(other._nested));
+        return *this;
+    }
+
     /**
      * @brief Destroys the SocketException.
      *
      * This destructor is explicitly marked `override` to ensure correct polymorphic behavior
      * when SocketException is used through a base class pointer (e.g., `std::exception*`).
-     * It is declared `default` because the base class destructors (`std::runtime_error`)
-     * and all members (`int`, `std::exception_ptr`) are trivially destructible.
-     *
-     * No resources are dynamically allocated by this class.
      */
     ~SocketException() override = default;
 
   private:
-    int _errorCode;               ///< Platform-specific error code (e.g., errno, WSA error).
-    std::exception_ptr _nested{}; ///< Captured nested exception for chaining, if any.
+    int _errorCode;                      ///< Platform-specific error code (e.g., errno, WSA error).
+    const char* _context{};              ///< Static context text (string literal), or null if `_message` is used.
+    std::string _message{};              ///< Owned context text; empty for literal or system-described errors.
+    bool _withCode{};                    ///< Whether `what()` describes `_errorCode`.
+    mutable std::once_flag _formatted{}; ///< Guards the one-time formatting of `_what`.
+    mutable std::string _what{};         ///< `what()` text, formatted on first access when `_withCode` is set.
+    std::exception_ptr _nested{};        ///< Captured nested exception for chaining, if any.
 
     /**
-     * @brief Builds a formatted error message combining a textual description and an error code.
+     * @brief Replaces the stored error with the given one, for the assignment operators.
      *
-     * This utility function is used internally to generate consistent exception messages
-     * that include both the high-level context and the underlying system error code.
+     * `_formatted` cannot be reset, so it is marked as done and `_what` is formatted here. Assignment must not race
+     * with `what()` on the same object anyway.
+     */
+    void assign(const int code, const char* context, std::string message, const bool withCode,
+                std::exception_ptr nested)
+    {
+        _errorCode = code;
+        _context = context;
+        _message = std::move(message);
+        _withCode = withCode;
+        _nested = std::move(nested);
+
+        std::call_once(_formatted, [] {});
+        _what = _withCode ? buildErrorMessage() : std::string();
+    }
+
+    /**
+     * @brief Builds the message returned by `what()` for exceptions that carry an error code.
      *
-     * The resulting string takes the form: `"message (error code 123)"`.
+     * The resulting string takes the form: `"message (error code 123)"`, where `message` is the stored context
+     * or, when there is none, the system description of the error code.
      *
-     * @param msg   Descriptive error message explaining the context of the failure.
-     * @param code  Platform-specific error code to append (e.g., errno, WSA error).
-     * @return      Formatted string combining the message and error code.
+     * @return Formatted string combining the message and error code.
      *
-     * @note This method is used by constructors of SocketException and is not intended for external use.
+     * @note This method is used by `what()` and is not intended for external use. Defined in common.cpp, next to
+     *       `SocketErrorMessage()`, which this header cannot see.
      */
-    static std::string buildErrorMessage(const std::string& msg, const int code)
-    {
-        std::ostringstream oss;
-        oss << msg << " (error code " << code << ")";
-        return oss.str();
-    }
+    [[nodiscard]] std::string buildErrorMessage() const;
 };
 
 } // namespace jsocketpp
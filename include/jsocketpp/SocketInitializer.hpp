@@ -28,7 +28,7 @@ class SocketInitializer
         if (InitSockets() != 0)
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
     }
 
@@ -1754,6 +1754,58 @@ class SocketOptions
      */
     [[nodiscard]] bool getReusePort() const;
 
+#endif
+
+#if defined(SO_INCOMING_CPU)
+
+    /**
+     * @brief Sets the CPU this socket prefers to receive on (`SO_INCOMING_CPU`).
+     * @ingroup socketopts
+     *
+     * When several `SO_REUSEPORT` sockets match an incoming packet or connection, the kernel favours the one
+     * whose incoming CPU equals the core processing it. Set it to the core of the thread that serves the socket
+     * so that packets are handled where they were received.
+     *
+     * ---
+     *
+     * ### 🔀 Platform Support
+     * - ✅ Linux (kernel ≥ 3.19 to read, ≥ 4.4 to set)
+     * - ❌ Other platforms: Not available — this method is excluded at compile time
+     *
+     * ---
+     *
+     * @param[in] cpu Zero-based CPU number.
+     *
+     * @throws SocketException If the socket is invalid or `setsockopt()` fails.
+     *
+     * @see getIncomingCpu()
+     * @see setReusePort()
+     */
+    void setIncomingCpu(int cpu);
+
+    /**
+     * @brief Returns the CPU that last processed a packet for this socket (`SO_INCOMING_CPU`).
+     * @ingroup socketopts
+     *
+     * Useful for reporting where traffic is being received, and for checking whether RSS/RPS and reuseport
+     * steering keep each socket's packets on its serving core.
+     *
+     * ---
+     *
+     * ### 🔀 Platform Support
+     * - ✅ Linux (kernel ≥ 3.19)
+     * - ❌ Other platforms: Not available — this method is excluded at compile time
+     *
+     * ---
+     *
+     * @return CPU number, or `-1` if no packet has been processed yet.
+     *
+     * @throws SocketException If the socket is invalid or `getsockopt()` fails.
+     *
+     * @see setIncomingCpu()
+     */
+    [[nodiscard]] int getIncomingCpu() const;
+
 #endif
 
     /**
@@ -2482,7 +2534,7 @@ class SocketOptions
      * setsockopt(sockFd, level, optname, reinterpret_cast<const char*>(&on), sizeof(on));
      * @endcode
      */
-    static [[nodiscard]] int detectFamily(SOCKET fd);
+    [[nodiscard]] static int detectFamily(SOCKET fd);
 
   private:
     SOCKET _sockFd = INVALID_SOCKET; ///< Underlying socket file descriptor
@@ -24,7 +24,7 @@ namespace jsocketpp
  * - Windows: `WSAETIMEDOUT`
  * - POSIX: `ETIMEDOUT`
  *
- * The default message is generated using @ref SocketErrorMessage for the given timeout error code.
+ * The default message is generated lazily using @ref SocketErrorMessage for the given timeout error code.
  *
  * ### Example
  * @code
@@ -39,14 +39,33 @@ class SocketTimeoutException final : public SocketException
 {
   public:
     /**
-     * @brief Construct a new SocketTimeoutException with the specified or default timeout code and message.
+     * @brief Construct a new SocketTimeoutException with the specified or default timeout code.
+     *
+     * The message is the system description of @p errorCode, formatted only if `what()` is called, so throwing
+     * and catching timeouts in a polling loop does not allocate.
+     *
      * @param errorCode The platform-specific timeout code (default: JSOCKETPP_TIMEOUT_CODE).
-     * @param message Optional error message. If omitted, it will be generated from the error code.
      */
-    explicit SocketTimeoutException(const int errorCode = JSOCKETPP_TIMEOUT_CODE, std::string message = "")
-        : SocketException(errorCode, message.empty() ? SocketErrorMessage(errorCode) : std::move(message))
+    explicit SocketTimeoutException(const int errorCode = JSOCKETPP_TIMEOUT_CODE) : SocketException(errorCode) {}
+
+    /**
+     * @brief Construct a new SocketTimeoutException with the specified timeout code and message.
+     * @tparam String Any type implicitly convertible to `std::string`, other than a character array.
+     * @param errorCode The platform-specific timeout code.
+     * @param message Error message, copied. If empty, the system description of @p errorCode is used.
+     */
+    template <typename String>
+        requires(std::convertible_to<const String&, std::string> && !std::is_array_v<String>)
+    SocketTimeoutException(const int errorCode, const String& message) : SocketException(errorCode, message)
     {
     }
+
+    /**
+     * @brief Construct a new SocketTimeoutException whose message is the string literal @p context (not copied).
+     * @param errorCode The platform-specific timeout code.
+     * @param context Static description of the timed-out operation.
+     */
+    SocketTimeoutException(const int errorCode, const Literal context) : SocketException(errorCode, context) {}
 };
 
 } // namespace jsocketpp
@@ -0,0 +1,212 @@
+/**
+ * @file Task.hpp
+ * @brief Lazily started C++20 coroutine type used by `EventLoop` and the awaitable socket operations.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace jsocketpp
+{
+
+template <typename T> class Task;
+
+namespace internal
+{
+
+/**
+ * @brief State shared by all `Task` promises: who to resume on completion, and the pending exception.
+ * @ingroup internal
+ *
+ * A task awaited by another coroutine resumes it through symmetric transfer, so arbitrarily long chains of
+ * `co_await` do not grow the native stack. A task spawned on an `EventLoop` has no continuation; it reports
+ * completion through `onDetachedDone` so that the loop can destroy its frame.
+ */
+class TaskPromiseBase
+{
+  public:
+    /// @brief Final-suspend awaiter that transfers control to the continuation, if any.
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<Promise> self) const noexcept
+        {
+            TaskPromiseBase& promise = self.promise();
+            if (promise.continuation)
+                return promise.continuation;
+            if (promise.onDetachedDone != nullptr)
+                promise.onDetachedDone(promise.detachedContext, self);
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+
+    std::coroutine_handle<> continuation{};                           ///< Awaiting coroutine, if any.
+    void (*onDetachedDone)(void*, std::coroutine_handle<>) = nullptr; ///< Completion hook for spawned tasks.
+    void* detachedContext = nullptr;                                  ///< Argument for `onDetachedDone`.
+    std::exception_ptr error{};                                       ///< Exception escaping the coroutine body.
+};
+
+/// @brief Promise for `Task<T>`: stores the returned value.
+template <typename T> class TaskPromise : public TaskPromiseBase
+{
+  public:
+    Task<T> get_return_object() noexcept;
+
+    template <typename U> void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+
+    T result()
+    {
+        if (error)
+            std::rethrow_exception(error);
+        return std::move(*_value);
+    }
+
+  private:
+    std::optional<T> _value{};
+};
+
+/// @brief Promise for `Task<void>`.
+template <> class TaskPromise<void> : public TaskPromiseBase
+{
+  public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void result() const
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+};
+
+} // namespace internal
+
+/**
+ * @class Task
+ * @ingroup reactor
+ * @brief Coroutine returning `T`, started when awaited (or when spawned on an `EventLoop`).
+ *
+ * `Task` is the return type of every awaitable operation in jsocketpp. It owns its coroutine frame:
+ * destroying a `Task` that has not completed destroys the suspended coroutine. Exceptions thrown inside
+ * the coroutine are rethrown from `co_await`.
+ *
+ * @code{.cpp}
+ * Task<void> session(EventLoop& loop, Socket client) {
+ *     while (true) {
+ *         std::string line = co_await asyncReadUntil(loop, client, "\n");
+ *         co_await asyncWriteAll(loop, client, line);
+ *     }
+ * }
+ * @endcode
+ *
+ * @tparam T Result type; `void` for tasks that produce no value.
+ *
+ * @see EventLoop
+ */
+template <typename T = void> class [[nodiscard]] Task
+{
+  public:
+    using promise_type = internal::TaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /**
+     * @brief Wraps a coroutine handle (called by the promise).
+     */
+    explicit Task(const Handle handle) noexcept : _handle(handle) {}
+
+    /**
+     * @brief Destroys the coroutine frame if this task still owns it.
+     */
+    ~Task()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    /**
+     * @brief Copy construction is disallowed; a task has a single owner.
+     */
+    Task(const Task&) = delete;
+
+    /**
+     * @brief Copy assignment is disallowed; a task has a single owner.
+     */
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Transfers ownership of the coroutine frame.
+     */
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+
+    /**
+     * @brief Transfers ownership of the coroutine frame, destroying the current one.
+     */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Gives up ownership of the coroutine frame. Used by `EventLoop::spawn()`.
+     */
+    [[nodiscard]] Handle release() noexcept { return std::exchange(_handle, {}); }
+
+    /**
+     * @brief Starts the task and suspends the caller until it completes.
+     */
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            Handle handle;
+
+            [[nodiscard]] bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> caller) const noexcept
+            {
+                handle.promise().continuation = caller;
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().result(); }
+        };
+        return Awaiter{_handle};
+    }
+
+  private:
+    Handle _handle{};
+};
+
+template <typename T> Task<T> internal::TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+inline Task<void> internal::TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+} // namespace jsocketpp
@@ -0,0 +1,222 @@
+/**
+ * @file TimerWheel.hpp
+ * @brief Hierarchical timer wheel with O(1) arm, re-arm and cancel, for per-connection deadlines.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "common.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace jsocketpp
+{
+
+/**
+ * @class TimerWheel
+ * @ingroup reactor
+ * @brief Schedules many timers that are mostly re-armed or cancelled before they expire.
+ *
+ * A server with tens of thousands of connections typically keeps an idle, read or write deadline per
+ * connection and pushes it back on every transfer. An ordered container pays `O(log n)` and an allocation for
+ * each of those updates; this wheel pays a few pointer writes. Timers are intrusive (`TimerWheel::Timer` is
+ * embedded in the object that owns the deadline), so arming never allocates.
+ *
+ * ### Structure
+ * Time is divided into ticks (1 ms by default). Four levels of 256 slots each cover 256, 2^16, 2^24 and 2^32
+ * ticks ahead (about 49 days at 1 ms); later deadlines are parked in the outermost level and re-filed as time
+ * passes. When the innermost level wraps around, the next slot of the level above is redistributed ("cascaded")
+ * into it, as in the classic Linux kernel timer wheel.
+ *
+ * ### Precision
+ * A timer never fires before its deadline and fires at most one tick after it, provided that `advance()` is
+ * called promptly. `nextExpiry()` returns a lower bound that callers can use as a poll timeout.
+ *
+ * ### Example
+ * @code{.cpp}
+ * TimerWheel wheel;
+ * TimerWheel::Timer idle([&] { client.shutdown(ShutdownMode::Both); });
+ * wheel.scheduleAfter(idle, std::chrono::seconds(30));
+ *
+ * // On every read: push the idle deadline back
+ * wheel.scheduleAfter(idle, std::chrono::seconds(30));
+ *
+ * // In the event loop
+ * wheel.advance(TimerWheel::Clock::now());
+ * @endcode
+ *
+ * @note Not thread-safe. `EventLoop` owns one, reachable through `EventLoop::timers()`, which must only be used
+ *       from the loop's thread.
+ *
+ * @see EventLoop::timers()
+ */
+class TimerWheel
+{
+  public:
+    /// @brief Clock that deadlines are measured on.
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t Levels = 4;             ///< Number of wheel levels.
+    static constexpr std::size_t SlotBits = 8;           ///< log2 of the slots per level.
+    static constexpr std::size_t Slots = 1u << SlotBits; ///< Slots per level.
+
+  private:
+    /// @brief Link of a circular, doubly linked slot list.
+    struct Node
+    {
+        Node* prev = this; ///< Previous entry, or the list head.
+        Node* next = this; ///< Next entry, or the list head.
+    };
+
+  public:
+    /**
+     * @class Timer
+     * @brief One deadline and the callback run when it passes; embed it in the object it belongs to.
+     *
+     * A timer is armed with `TimerWheel::schedule()` or `scheduleAfter()` and disarmed by `cancel()`, by
+     * expiring, or by its destructor. It cannot be copied or moved while the wheel may refer to it.
+     */
+    class Timer : private Node
+    {
+      public:
+        Timer() = default;
+
+        /**
+         * @brief Creates a disarmed timer with the given expiry callback.
+         */
+        explicit Timer(std::function<void()> onExpire) : callback(std::move(onExpire)) {}
+
+        /**
+         * @brief Disarms the timer.
+         */
+        ~Timer() { cancel(); }
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        Timer(Timer&&) = delete;
+        Timer& operator=(Timer&&) = delete;
+
+        /**
+         * @brief Whether the timer is scheduled and has not fired or been cancelled.
+         */
+        [[nodiscard]] bool armed() const noexcept { return _wheel != nullptr; }
+
+        /**
+         * @brief Disarms the timer if it is armed; the callback will not run. O(1).
+         */
+        void cancel() noexcept;
+
+        /**
+         * @brief Run on the wheel's thread, from `TimerWheel::advance()`, once the deadline has passed.
+         *
+         * The timer is already disarmed when the callback runs, so it may re-arm itself.
+         */
+        std::function<void()> callback{};
+
+      private:
+        friend class TimerWheel;
+
+        static constexpr std::uint16_t NoSlot = 0xFFFF; ///< Not filed in a wheel slot.
+
+        TimerWheel* _wheel = nullptr; ///< Wheel the timer is armed on, or `nullptr`.
+        std::uint64_t _expires = 0;   ///< Deadline in ticks since the wheel's origin.
+        std::uint16_t _slot = NoSlot; ///< `level * Slots + index` of the slot holding the timer.
+    };
+
+    /**
+     * @brief Creates an empty wheel.
+     * @param[in] tick   Resolution of the wheel; must be positive. Deadlines are rounded up to whole ticks.
+     * @param[in] origin Time of tick 0.
+     * @throws SocketException If @p tick is not positive.
+     */
+    explicit TimerWheel(Clock::duration tick = std::chrono::milliseconds(1), Clock::time_point origin = Clock::now());
+
+    /**
+     * @brief Cancels every timer still armed.
+     */
+    ~TimerWheel() noexcept;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /**
+     * @brief Arms @p timer to fire at @p deadline, or moves its deadline if it is already armed. O(1).
+     *
+     * A deadline that has already passed fires on the next `advance()` that moves the wheel forward.
+     *
+     * @throws SocketException If @p timer is armed on a different wheel.
+     */
+    void schedule(Timer& timer, Clock::time_point deadline);
+
+    /**
+     * @brief Arms @p timer to fire @p delay from now; see `schedule()`.
+     */
+    void scheduleAfter(Timer& timer, const Clock::duration delay) { schedule(timer, Clock::now() + delay); }
+
+    /**
+     * @brief Disarms @p timer; equivalent to `timer.cancel()`.
+     */
+    static void cancel(Timer& timer) noexcept { timer.cancel(); }
+
+    /**
+     * @brief Runs the callbacks of all timers whose deadline is at or before @p now.
+     *
+     * Callbacks may arm and cancel timers, including the one that is firing. If a callback throws, the timers
+     * that were due but have not run yet stay armed and fire on the next call.
+     *
+     * @param[in] now Current time; calls with an earlier time than before are ignored.
+     * @return Number of callbacks run.
+     */
+    std::size_t advance(Clock::time_point now);
+
+    /**
+     * @brief A time at or before the earliest armed deadline, for use as a poll timeout.
+     *
+     * Exact when the earliest timer is less than `Slots` ticks away; otherwise the next time the innermost level
+     * wraps around, at which point `advance()` cascades the outer timers and this can be asked again.
+     *
+     * @return `std::nullopt` if no timer is armed.
+     */
+    [[nodiscard]] std::optional<Clock::time_point> nextExpiry() const noexcept;
+
+    /**
+     * @brief Number of armed timers.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return _count; }
+
+    /**
+     * @brief Whether no timer is armed.
+     */
+    [[nodiscard]] bool empty() const noexcept { return _count == 0; }
+
+  private:
+    /// @brief One bit per slot of a level, set while the slot is non-empty.
+    using Occupancy = std::array<std::uint64_t, Slots / 64>;
+
+    void file(Timer& timer) noexcept;
+    void unlink(Timer& timer) noexcept;
+    void cascade(std::size_t level) noexcept;
+    void fireSlot(std::size_t index, std::size_t& fired);
+    [[nodiscard]] std::uint64_t ticksAt(Clock::time_point time, bool roundUp) const noexcept;
+
+    static void append(Node& list, Node& node) noexcept;
+
+    Clock::duration _tick;                                ///< Length of one tick.
+    Clock::time_point _origin;                            ///< Time of tick 0.
+    std::uint64_t _next = 0;                              ///< Next tick `advance()` will process.
+    std::size_t _count = 0;                               ///< Armed timers.
+    std::array<std::array<Node, Slots>, Levels> _slots{}; ///< Slot list heads, per level.
+    std::array<Occupancy, Levels> _occupied{};            ///< Non-empty slots, per level.
+};
+
+} // namespace jsocketpp
@@ -190,7 +190,7 @@ class UnixSocket : SocketOptions
         if (len == SOCKET_ERROR)
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
         if (len == 0)
             throw SocketException("Connection closed by remote socket.");
@@ -208,6 +208,11 @@ class UnixSocket : SocketOptions
      */
     [[nodiscard]] bool isValid() const { return getSocketFd() != INVALID_SOCKET; }
 
+    /**
+     * @brief Native descriptor of the socket, for use with `Selector`, `relay()` or system calls.
+     */
+    using SocketOptions::getSocketFd;
+
     /**
      * @brief Returns the path of the Unix domain socket.
      * @return String containing the filesystem path of the socket.
@@ -279,7 +284,7 @@ template <> inline std::string UnixSocket::read()
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
     if (len == 0)
         throw SocketException("Connection closed by remote socket.");
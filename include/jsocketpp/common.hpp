@@ -24,6 +24,7 @@
 #define DIAGNOSTIC_POP()
 #endif
 
+#include <chrono>
 #include <cstring> // Use std::memset()
 #include <exception>
 #include <iostream>
@@ -179,6 +180,22 @@
  * @see Socket::setSoLinger(), Socket::getSoLinger(), Socket::setTcpNoDelay(), etc.
  */
 
+/**
+ * @defgroup reactor Event-Driven I/O
+ * @ingroup jsocketpp
+ * @brief Readiness multiplexing for serving many sockets from few threads.
+ *
+ * This module contains the `Selector` class and its supporting types (`Interest`, `TriggerMode`,
+ * `SelectionKey`), modeled after Java NIO. On Linux the implementation uses `epoll`; other platforms fall
+ * back to `poll()`/`WSAPoll()`. Built on top of it are `AcceptLoop`, the completion-based `IoService`,
+ * `EventLoop`, which runs C++20 coroutines (`Task`) over the awaitable socket operations and keeps their
+ * deadlines in a `TimerWheel`, and `ShardedServer`, which runs one `EventLoop` per core behind `SO_REUSEPORT`
+ * listeners.
+ *
+ * @see Selector
+ * @see EventLoop
+ */
+
 /**
  * @defgroup utils Utility Functions
  * @ingroup jsocketpp
@@ -967,6 +984,23 @@ using AddrinfoPtr = std::unique_ptr<addrinfo, AddrinfoDeleter>;
     return AddrinfoPtr{raw};
 }
 
+/**
+ * @brief Parses a numeric IPv4 or IPv6 literal into a socket address without calling `getaddrinfo()`.
+ * @ingroup internal
+ *
+ * Fast path for the common case of sending to an IP address: `inet_pton()` on a stack copy of @p host,
+ * plus `if_nametoindex()` for an IPv6 zone suffix (`"fe80::1%eth0"`). The result matches what
+ * `resolveAddress(host, port, AF_UNSPEC, SOCK_DGRAM, IPPROTO_UDP)` would return first for a numeric host.
+ *
+ * @param[in]  host Candidate address literal.
+ * @param[in]  port Port in host byte order.
+ * @param[out] out Receives the address on success.
+ * @param[out] outLen Receives the address length on success.
+ * @return `true` if @p host is a numeric address; `false` otherwise (the caller should resolve it).
+ */
+[[nodiscard]] bool parseNumericAddress(std::string_view host, Port port, sockaddr_storage& out,
+                                       socklen_t& outLen) noexcept;
+
 /**
  * @brief Retrieves the local IP address to which the socket is currently bound.
  * @ingroup internal
@@ -1160,6 +1194,28 @@ void sendExact(SOCKET fd, const void* data, std::size_t size);
 void sendExactTo(SOCKET fd, const void* data, std::size_t size, const sockaddr* addr, socklen_t addrLen,
                  void (*afterSuccess)(void* ctx), void* ctx);
 
+/**
+ * @brief Sends the concatenation of several fragments as one datagram using scatter-gather I/O.
+ * @ingroup internal
+ *
+ * Hands the fragments to `sendmsg()` (POSIX) or `WSASendTo()` (Windows) directly, so the payload is never copied
+ * into an intermediate buffer. The descriptor array is an `IoVecCursor` batch on the stack, so nothing is
+ * allocated; only when there are more fragments than the system's `IOV_MAX` are they coalesced into one
+ * contiguous buffer first.
+ *
+ * @param[in] fd       The socket file descriptor to send data on.
+ * @param[in] buffers  Fragments forming the datagram payload, in order.
+ * @param[in] addr     Destination address, or `nullptr` to send to the connected peer.
+ * @param[in] addrLen  Length of @p addr in bytes (ignored when @p addr is `nullptr`).
+ *
+ * @throws SocketException
+ *         If the socket is invalid, if the send fails, or if a partial datagram is sent.
+ *
+ * @see sendExact(), sendExactTo()
+ */
+void sendExactv(SOCKET fd, std::span<const std::string_view> buffers, const sockaddr* addr = nullptr,
+                socklen_t addrLen = 0);
+
 /**
  * @brief Attempts to close a socket descriptor without throwing exceptions.
  * @ingroup internal
@@ -1248,10 +1304,70 @@ inline void closeOrThrow(const SOCKET fd)
     if (CloseSocket(fd) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
+/**
+ * @brief Tells whether a non-blocking socket call failed only because it would have had to wait.
+ * @ingroup internal
+ *
+ * @param[in] error Error code from `GetSocketError()` or `SocketException::getErrorCode()`.
+ * @return `true` for `EAGAIN`/`EWOULDBLOCK` (`WSAEWOULDBLOCK` on Windows).
+ */
+inline bool isWouldBlock(const int error) noexcept
+{
+#ifdef _WIN32
+    return error == WSAEWOULDBLOCK;
+#else
+    // NOLINTNEXTLINE(misc-redundant-expression): the two are equal on Linux but not on every POSIX system
+    return error == EAGAIN || error == EWOULDBLOCK;
+#endif
+}
+
+/**
+ * @brief Tells whether an `accept()` failure only affects the connection being accepted.
+ * @ingroup internal
+ *
+ * The peer gave up between the handshake and the `accept()` call (or a signal interrupted it); the next
+ * pending connection is unaffected, so accept loops should simply try again.
+ *
+ * @param[in] error Error code from `GetSocketError()` or a negated io_uring completion result.
+ * @return `true` for `ECONNABORTED`, `EINTR`, `EPROTO` (`WSAECONNRESET`, `WSAEINTR` on Windows).
+ */
+inline bool isTransientAcceptError(const int error) noexcept
+{
+#ifdef _WIN32
+    return error == WSAECONNRESET || error == WSAEINTR;
+#else
+    return error == ECONNABORTED || error == EINTR || error == EPROTO;
+#endif
+}
+
+/**
+ * @brief Tells whether an `accept()` failure persists until descriptors or memory are released.
+ * @ingroup internal
+ *
+ * Retrying such a failure immediately would spin a core; accept loops should back off briefly instead.
+ *
+ * @param[in] error Error code from `GetSocketError()`.
+ * @return `true` for `EMFILE`, `ENFILE`, `ENOBUFS`, `ENOMEM` (`WSAEMFILE`, `WSAENOBUFS` on Windows).
+ */
+inline bool isResourceExhaustion(const int error) noexcept
+{
+#ifdef _WIN32
+    return error == WSAEMFILE || error == WSAENOBUFS;
+#else
+    return error == EMFILE || error == ENFILE || error == ENOBUFS || error == ENOMEM;
+#endif
+}
+
+/**
+ * @brief How long accept loops pause after a failure for which `isResourceExhaustion()` is `true`.
+ * @ingroup internal
+ */
+inline constexpr auto ResourceBackoff = std::chrono::milliseconds(10);
+
 /**
  * @brief Query the exact size of the next UDP datagram, if the platform can provide it.
  *
@@ -1346,7 +1462,7 @@ inline ssize_t recvInto(const SOCKET fd, std::span<std::byte> dst, const int fla
  * project’s canonical two-argument pattern:
  *
  * @code
- * throw SocketException(err, SocketErrorMessage(err));
+ * throw SocketException(err);
  * @endcode
  *
  * When internal error-context is enabled (see build-time switch `JSOCKETPP_INCLUDE_ERROR_CONTEXT`),
@@ -1390,7 +1506,7 @@ inline ssize_t recvInto(const SOCKET fd, std::span<std::byte> dst, const int fla
     throw SocketException(err, std::move(msg));
 #else
     (void) loc;
-    throw SocketException(err, SocketErrorMessage(err));
+    throw SocketException(err);
 #endif
 }
 
@@ -1406,7 +1522,7 @@ inline ssize_t recvInto(const SOCKET fd, std::span<std::byte> dst, const int fla
  *
  * @param[in]  sa Pointer to a valid `sockaddr` (e.g., `sockaddr_in`/`sockaddr_in6`).
  * @param[in]  len Size of the structure pointed to by @p sa.
- * @param[out] host Receives the numeric host string (e.g., `"192.0.2.10"`, `"fe80::1%eth0"`).
+ * @param[out] host Receives the numeric host string (e.g., `"192.0.2.10"`, `"fe80::1%eth0"`); any allocator.
  * @param[out] port Receives the numeric service string (e.g., `"8080"`).
  *
  * @throws SocketException
@@ -1415,7 +1531,9 @@ inline ssize_t recvInto(const SOCKET fd, std::span<std::byte> dst, const int fla
  * @note Uses purely numeric resolution to avoid blocking DNS queries.
  * @since 1.0
  */
-inline void resolveNumericHostPort(const sockaddr* sa, const socklen_t len, std::string& host, Port& port)
+template <typename Allocator>
+void resolveNumericHostPort(const sockaddr* sa, const socklen_t len,
+                            std::basic_string<char, std::char_traits<char>, Allocator>& host, Port& port)
 {
     char hostBuf[NI_MAXHOST]{};
     char servBuf[NI_MAXSERV]{};
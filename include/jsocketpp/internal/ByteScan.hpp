@@ -0,0 +1,60 @@
+/**
+ * @file ByteScan.hpp
+ * @brief Vectorized byte and pattern search used by delimiter-based stream reads.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief Finds the first occurrence of a byte in a memory range.
+ *
+ * Equivalent to `std::memchr()`, but dispatched at runtime to the widest available implementation:
+ * - **glibc:** `std::memchr()` itself, which glibc already dispatches to unrolled AVX2/EVEX code
+ * - **x86/x86-64 (GCC/Clang, other C libraries):** AVX2 when the CPU supports it, otherwise SSE2
+ * - **x86-64 (MSVC):** SSE2
+ * - **Other targets:** scalar fallback (`std::memchr()`)
+ *
+ * The CPU feature check runs once per process; later calls only pay an indirect call.
+ *
+ * @param[in] data Start of the range to search.
+ * @param[in] len Number of bytes to search.
+ * @param[in] needle Byte value to look for.
+ * @return Pointer to the first matching byte, or `nullptr` if none is found.
+ *
+ * @see findPattern()
+ * @see Socket::readUntil()
+ *
+ * @ingroup internal
+ */
+[[nodiscard]] const char* findByte(const char* data, std::size_t len, char needle) noexcept;
+
+/**
+ * @brief Finds the first occurrence of a multi-byte pattern in a memory range.
+ *
+ * Uses the same runtime dispatch as `findByte()`. The SIMD paths compare the first and last pattern
+ * byte against two shifted windows at once and only verify the remaining bytes for candidate positions,
+ * so short delimiters such as `"\r\n"` or `"\r\n\r\n"` are found at close to `memchr()` speed.
+ *
+ * @param[in] data Start of the range to search.
+ * @param[in] len Number of bytes to search.
+ * @param[in] pattern Non-empty byte sequence to look for.
+ * @return Pointer to the first byte of the first match, or `nullptr` if the pattern does not occur
+ *         entirely inside `[data, data + len)`.
+ *
+ * @see findByte()
+ * @see Socket::readUntil(std::string_view, std::size_t, bool)
+ *
+ * @ingroup internal
+ */
+[[nodiscard]] const char* findPattern(const char* data, std::size_t len, std::string_view pattern) noexcept;
+
+} // namespace jsocketpp::internal
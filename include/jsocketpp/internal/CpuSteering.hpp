@@ -0,0 +1,89 @@
+/**
+ * @file CpuSteering.hpp
+ * @brief Thread pinning and reuseport CPU steering shared by the sharded servers.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "../common.hpp"
+
+#include <cstddef>
+#include <thread>
+
+#if defined(__linux__)
+#include <cstdint>
+#include <iterator>
+#include <linux/filter.h>
+#include <pthread.h>
+#include <sched.h>
+
+#ifndef SO_ATTACH_REUSEPORT_CBPF
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
+#endif
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief Pins the calling thread to @p cpu.
+ * @ingroup internal
+ *
+ * Best effort: a CPU outside the process affinity mask (cgroups, `taskset`) is left to the scheduler, and
+ * failures are ignored. Does nothing on platforms other than Linux.
+ *
+ * @param[in] cpu Zero-based CPU number.
+ */
+inline void pinCurrentThreadToCpu([[maybe_unused]] const std::size_t cpu) noexcept
+{
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (cpu >= CPU_SETSIZE || ::sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || !CPU_ISSET(cpu, &allowed))
+        return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    (void) ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+#endif
+}
+
+/**
+ * @brief Attaches a reuseport program that hands each packet or connection to socket `cpu % groupSize`.
+ * @ingroup internal
+ *
+ * `cpu` is the core processing the incoming packet (the SYN for TCP). The program (`SO_ATTACH_REUSEPORT_CBPF`)
+ * belongs to the whole `SO_REUSEPORT` group of @p fd, whose members are numbered in the order they joined
+ * (`listen()` for TCP, `bind()` for UDP). Together with `pinCurrentThreadToCpu(i)` for member `i`, traffic is
+ * handled on the core that received it.
+ *
+ * @param[in] fd        Any member of the reuseport group.
+ * @param[in] groupSize Number of members in the group.
+ * @return `true` if the kernel accepted the program; `false` on failure, on platforms other than Linux, or when
+ *         @p groupSize exceeds the number of hardware threads (members past the last CPU would never be
+ *         chosen). The default 4-tuple hash then keeps spreading traffic.
+ */
+inline bool attachReuseportCpuProgram([[maybe_unused]] const SOCKET fd,
+                                      [[maybe_unused]] const std::size_t groupSize) noexcept
+{
+#if defined(__linux__)
+    if (groupSize < 2 || groupSize > std::thread::hardware_concurrency())
+        return false;
+
+    sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)}, // A = cpu
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(groupSize)},              // A %= groupSize
+        {BPF_RET | BPF_A, 0, 0, 0},                                                           // member index
+    };
+    const sock_fprog program{static_cast<unsigned short>(std::size(code)), code};
+    return ::setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace jsocketpp::internal
@@ -0,0 +1,163 @@
+/**
+ * @file IoVecCursor.hpp
+ * @brief Allocation-free walk over a buffer list as successive `readv`/`writev` (or `WSARecv`/`WSASend`) batches.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "../BufferView.hpp"
+#include "../common.hpp"
+
+#include <algorithm>
+#include <climits> // IOV_MAX
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace jsocketpp::internal
+{
+
+#ifdef _WIN32
+using IoVec = WSABUF; ///< Scatter/gather entry of the platform's vectored I/O calls.
+#else
+using IoVec = iovec; ///< Scatter/gather entry of the platform's vectored I/O calls.
+#endif
+
+/// @brief Most entries handed to one vectored I/O call.
+#if defined(IOV_MAX)
+inline constexpr std::size_t IoVecMax = IOV_MAX;
+#else
+inline constexpr std::size_t IoVecMax = 1024;
+#endif
+
+/**
+ * @brief One `writev()`/`WSASend()` over @p count entries.
+ * @ingroup internal
+ * @return Number of bytes sent; may be less than the entries hold.
+ * @throws SocketException On failure, including `EWOULDBLOCK` on a non-blocking socket.
+ */
+std::size_t sendIoVecs(SOCKET fd, IoVec* vec, std::size_t count);
+
+/**
+ * @brief Converts buffer lists to `IoVec` arrays on the stack and tracks partial transfers in place.
+ * @ingroup internal
+ *
+ * Up to `IoVecMax` buffers are converted at a time into a fixed array inside the cursor; `data()`/`size()` are
+ * the entries for the next call. After a transfer, `advance()` drops the transferred bytes from the front by
+ * moving an index and trimming the first partially transferred entry, and converts the next batch once the
+ * current one is used up. No heap memory is allocated, and the total work is linear in the number of buffers
+ * plus the number of calls, however the transfers split.
+ *
+ * @tparam Buffer `const std::string_view`, `const BufferView` or `BufferView`.
+ *
+ * @note The cursor holds `IoVecMax` entries (16 KiB with `IOV_MAX == 1024`); create it on the stack of the call
+ *       doing the I/O, not in long-lived objects.
+ */
+template <typename Buffer> class IoVecCursor
+{
+  public:
+    /**
+     * @brief Converts the first batch of @p buffers, which must outlive the cursor.
+     */
+    explicit IoVecCursor(const std::span<Buffer> buffers) noexcept : _source(buffers) { refill(); }
+
+    IoVecCursor(const IoVecCursor&) = delete;
+    IoVecCursor& operator=(const IoVecCursor&) = delete;
+
+    /// @brief Whether every byte has been transferred (empty buffers count as transferred once reached).
+    [[nodiscard]] bool done() const noexcept { return _first == _count && _source.empty(); }
+
+    /// @brief First entry of the current batch.
+    [[nodiscard]] IoVec* data() noexcept { return _batch + _first; }
+
+    /// @brief Entries in the current batch; at most `IoVecMax`.
+    [[nodiscard]] std::size_t size() const noexcept { return _count - _first; }
+
+    /**
+     * @brief Drops @p bytes transferred bytes from the front, along with any empty entries they reach.
+     */
+    void advance(std::size_t bytes) noexcept
+    {
+        while (true)
+        {
+            if (_first == _count)
+            {
+                if (_source.empty())
+                    return;
+                refill();
+            }
+            IoVec& entry = _batch[_first];
+            const std::size_t length = lengthOf(entry);
+            if (bytes < length)
+            {
+                trim(entry, bytes);
+                return;
+            }
+            bytes -= length;
+            ++_first;
+        }
+    }
+
+  private:
+    static IoVec toIoVec(const std::string_view buffer) noexcept
+    {
+        // Neither iovec nor WSABUF is const-correct; sends never write through the pointer
+        return toIoVec(const_cast<char*>(buffer.data()), buffer.size());
+    }
+
+    static IoVec toIoVec(const BufferView& buffer) noexcept { return toIoVec(buffer.data, buffer.size); }
+
+    static IoVec toIoVec(void* data, const std::size_t size) noexcept
+    {
+        IoVec entry{};
+#ifdef _WIN32
+        entry.buf = static_cast<CHAR*>(data);
+        entry.len = static_cast<ULONG>(size);
+#else
+        entry.iov_base = data;
+        entry.iov_len = size;
+#endif
+        return entry;
+    }
+
+    static std::size_t lengthOf(const IoVec& entry) noexcept
+    {
+#ifdef _WIN32
+        return entry.len;
+#else
+        return entry.iov_len;
+#endif
+    }
+
+    static void trim(IoVec& entry, const std::size_t bytes) noexcept
+    {
+#ifdef _WIN32
+        entry.buf += bytes;
+        entry.len -= static_cast<ULONG>(bytes);
+#else
+        entry.iov_base = static_cast<char*>(entry.iov_base) + bytes;
+        entry.iov_len -= bytes;
+#endif
+    }
+
+    void refill() noexcept
+    {
+        _count = (std::min) (_source.size(), IoVecMax);
+        for (std::size_t i = 0; i < _count; ++i)
+            _batch[i] = toIoVec(_source[i]);
+        _source = _source.subspan(_count);
+        _first = 0;
+    }
+
+    std::span<Buffer> _source; ///< Buffers not yet converted.
+    std::size_t _first = 0;    ///< First entry not yet fully transferred.
+    std::size_t _count = 0;    ///< Entries converted into `_batch`.
+
+    /// @brief Current batch; entries before `_first` are done. A plain array, so that it is not zeroed per call.
+    IoVec _batch[IoVecMax]; // NOLINT(*-avoid-c-arrays)
+};
+
+} // namespace jsocketpp::internal
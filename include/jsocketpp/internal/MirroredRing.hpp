@@ -0,0 +1,78 @@
+/**
+ * @file MirroredRing.hpp
+ * @brief Ring buffer storage mapped twice back-to-back, so that every readable or writable region is contiguous.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief `capacity()` bytes of memory that also appear again directly after themselves.
+ * @ingroup internal
+ *
+ * The pages of one anonymous memory file (`memfd_create()`) are mapped at `data()` and again at
+ * `data() + capacity()`, so byte `i` and byte `i + capacity()` are the same memory. A ring buffer over it can hand
+ * out `[head, head + size)` and `[tail, tail + free)` as plain pointers for any `head < capacity()`; wrapping
+ * around costs nothing and unread bytes never have to be moved to the front.
+ *
+ * The capacity is rounded up to a multiple of the page size. The mapping is held until the ring is destroyed.
+ *
+ * @note Linux-only. Elsewhere the constructor throws.
+ */
+class MirroredRing
+{
+  public:
+    /// @brief Maps nothing; `mapped()` is `false`.
+    MirroredRing() noexcept = default;
+
+    /**
+     * @brief Maps a ring of at least @p minCapacity bytes.
+     * @throws SocketException If the memory file cannot be created or mapped, or on platforms other than Linux.
+     */
+    explicit MirroredRing(std::size_t minCapacity);
+
+    ~MirroredRing() { unmap(); }
+
+    MirroredRing(const MirroredRing&) = delete;
+    MirroredRing& operator=(const MirroredRing&) = delete;
+
+    MirroredRing(MirroredRing&& rhs) noexcept
+        : _data(std::exchange(rhs._data, nullptr)), _capacity(std::exchange(rhs._capacity, 0))
+    {
+    }
+
+    MirroredRing& operator=(MirroredRing&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            _data = std::exchange(rhs._data, nullptr);
+            _capacity = std::exchange(rhs._capacity, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Start of the first mapping; the second starts at `data() + capacity()`.
+    [[nodiscard]] char* data() const noexcept { return _data; }
+
+    /// @brief Size of one mapping, a multiple of the page size; 0 if nothing is mapped.
+    [[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+
+    [[nodiscard]] bool mapped() const noexcept { return _data != nullptr; }
+
+  private:
+    void unmap() noexcept;
+
+    char* _data = nullptr;     ///< First of the two mappings, or `nullptr`.
+    std::size_t _capacity = 0; ///< Bytes per mapping.
+};
+
+} // namespace jsocketpp::internal
@@ -0,0 +1,158 @@
+/**
+ * @file PollWait.hpp
+ * @brief Monotonic deadlines and the single-descriptor readiness wait shared by the blocking socket classes.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "../common.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief A point on `std::chrono::steady_clock` by which a timed operation must finish, or no limit at all.
+ * @ingroup internal
+ *
+ * Operations that wait several times (the `*WithTotalTimeout()` loops, multi-address `connect()`) create one
+ * `Deadline` up front and pass it to every wait, so that the remaining time is derived from a single fixed point
+ * rather than re-accumulated around each call. The clock is monotonic, so wall-clock adjustments cannot stretch
+ * or cut short a timeout.
+ */
+class Deadline
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief A deadline that never expires.
+    Deadline() noexcept = default;
+
+    /**
+     * @brief Deadline @p timeoutMillis from now.
+     * @param[in] timeoutMillis Milliseconds from now; negative means no limit.
+     */
+    [[nodiscard]] static Deadline after(const int timeoutMillis) noexcept
+    {
+        Deadline deadline;
+        if (timeoutMillis >= 0)
+        {
+            deadline._at = Clock::now() + std::chrono::milliseconds(timeoutMillis);
+            deadline._infinite = false;
+        }
+        return deadline;
+    }
+
+    [[nodiscard]] bool isInfinite() const noexcept { return _infinite; }
+
+    [[nodiscard]] bool expired() const noexcept { return !_infinite && Clock::now() >= _at; }
+
+    /// @brief Time left, clamped at zero; only meaningful when `!isInfinite()`.
+    [[nodiscard]] Clock::duration remaining() const noexcept
+    {
+        return (std::max) (_at - Clock::now(), Clock::duration::zero());
+    }
+
+    /**
+     * @brief Time left in whole milliseconds, rounded up so that a wait never ends before the deadline.
+     * @return -1 if infinite, otherwise a value in `[0, INT_MAX]`, as expected by `poll()`-style timeouts.
+     */
+    [[nodiscard]] int remainingMillis() const noexcept
+    {
+        if (_infinite)
+            return -1;
+        const std::chrono::milliseconds::rep millis = std::chrono::ceil<std::chrono::milliseconds>(remaining()).count();
+        return static_cast<int>((std::min) (millis, static_cast<std::chrono::milliseconds::rep>(INT_MAX)));
+    }
+
+  private:
+    Clock::time_point _at{};
+    bool _infinite = true;
+};
+
+/**
+ * @brief Waits until @p fd reports any of @p events, or until @p deadline passes.
+ * @ingroup internal
+ *
+ * Built on `ppoll()` on Linux (nanosecond timeouts), `poll()` on other POSIX systems and `WSAPoll()` on Windows,
+ * so unlike `select()` it works for descriptors of any value, not just those below `FD_SETSIZE`. Interrupted
+ * waits (`EINTR`) resume with whatever time is left.
+ *
+ * @param[in] fd       Descriptor to wait on.
+ * @param[in] events   `POLLIN`/`POLLOUT` mask; error conditions are reported even when not requested.
+ * @param[in] deadline When to give up.
+ * @return The `revents` reported for @p fd, or 0 if the deadline passed first.
+ * @throws SocketException If the wait itself fails.
+ */
+inline short pollUntil(const SOCKET fd, const short events, const Deadline& deadline)
+{
+    for (;;)
+    {
+#ifdef _WIN32
+        WSAPOLLFD pfd{};
+        pfd.fd = fd;
+        pfd.events = events;
+        const int rc = ::WSAPoll(&pfd, 1, deadline.remainingMillis());
+#elif defined(__linux__)
+        pollfd pfd{fd, events, 0};
+        timespec ts{};
+        const timespec* timeout = nullptr;
+        if (!deadline.isInfinite())
+        {
+            const auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.remaining());
+            ts.tv_sec = static_cast<time_t>(left.count() / 1'000'000'000);
+            ts.tv_nsec = static_cast<long>(left.count() % 1'000'000'000);
+            timeout = &ts;
+        }
+        const int rc = ::ppoll(&pfd, 1, timeout, nullptr);
+#else
+        pollfd pfd{fd, events, 0};
+        const int rc = ::poll(&pfd, 1, deadline.remainingMillis());
+#endif
+        if (rc > 0)
+            return pfd.revents;
+        if (rc == 0)
+            return 0;
+
+        const int error = GetSocketError();
+#ifndef _WIN32
+        if (error == EINTR)
+            continue;
+#endif
+        throw SocketException(error);
+    }
+}
+
+/**
+ * @brief Waits until @p fd is readable (or writable), or until @p deadline passes.
+ * @ingroup internal
+ *
+ * Error and hang-up conditions count as ready, as with `select()`: the next I/O call reports the actual error.
+ *
+ * @param[in] fd       Descriptor to wait on.
+ * @param[in] forWrite `true` to wait for writability, `false` for readability.
+ * @param[in] deadline When to give up.
+ * @return `true` if ready, `false` if the deadline passed first.
+ * @throws SocketException If @p fd is not a valid descriptor, or if the wait itself fails.
+ */
+inline bool waitFor(const SOCKET fd, const bool forWrite, const Deadline& deadline)
+{
+    const short revents = pollUntil(fd, forWrite ? POLLOUT : POLLIN, deadline);
+    if ((revents & POLLNVAL) != 0)
+    {
+#ifdef _WIN32
+        throw SocketException(WSAENOTSOCK);
+#else
+        throw SocketException(EBADF);
+#endif
+    }
+    return revents != 0;
+}
+
+} // namespace jsocketpp::internal
@@ -0,0 +1,240 @@
+/**
+ * @file ReceiveBuffer.hpp
+ * @brief Read buffer that holds pooled storage only while it contains unread bytes.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#include "../BufferPool.hpp"
+#include "MirroredRing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief Linear read buffer (`[head, tail)` unread, `[tail, capacity)` free) backed by a `BufferPool` block.
+ * @ingroup internal
+ *
+ * The block is borrowed by `prepare()` and returned as soon as the buffer becomes empty, so an idle `Socket`
+ * owns no read buffer at all. `capacity()` is the configured size and stays fixed unless changed explicitly.
+ *
+ * With `setMirrored(true)` the storage is a `MirroredRing` instead, held until mirroring is turned off: `head`
+ * wraps at `capacity()` and `[tail, head + capacity)` is free, both contiguous thanks to the second mapping, so
+ * `prepare()` never moves unread bytes.
+ */
+class ReceiveBuffer
+{
+  public:
+    /**
+     * @param[in] capacity Configured size; storage is not allocated until first needed.
+     * @param[in] pool     Pool to borrow from; must outlive the buffer.
+     */
+    explicit ReceiveBuffer(const std::size_t capacity, BufferPool& pool = BufferPool::global()) noexcept
+        : _pool(&pool), _ring(), _capacity(capacity)
+    {
+    }
+
+    ~ReceiveBuffer() { releaseStorage(); }
+
+    ReceiveBuffer(const ReceiveBuffer&) = delete;
+    ReceiveBuffer& operator=(const ReceiveBuffer&) = delete;
+
+    ReceiveBuffer(ReceiveBuffer&& rhs) noexcept
+        : _pool(rhs._pool), _ring(std::move(rhs._ring)), _storage(std::exchange(rhs._storage, nullptr)),
+          _capacity(rhs._capacity), _head(std::exchange(rhs._head, 0)), _tail(std::exchange(rhs._tail, 0))
+    {
+    }
+
+    ReceiveBuffer& operator=(ReceiveBuffer&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            releaseStorage();
+            _pool = rhs._pool;
+            _ring = std::move(rhs._ring);
+            _storage = std::exchange(rhs._storage, nullptr);
+            _capacity = rhs._capacity;
+            _head = std::exchange(rhs._head, 0);
+            _tail = std::exchange(rhs._tail, 0);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+    [[nodiscard]] std::size_t size() const noexcept { return _tail - _head; }
+    [[nodiscard]] bool empty() const noexcept { return _tail == _head; }
+    [[nodiscard]] bool full() const noexcept { return size() == _capacity; }
+
+    /// @brief Whether storage is currently held (i.e. the buffer is non-empty or being filled, or mirrored).
+    [[nodiscard]] bool hasStorage() const noexcept { return _storage != nullptr; }
+
+    /// @brief First unread byte; only meaningful when `!empty()`.
+    [[nodiscard]] const char* data() const noexcept { return _storage + _head; }
+
+    /**
+     * @brief Free region after the unread bytes, borrowing storage first if none is held.
+     *
+     * When the free tail falls below half of the capacity, the unread bytes are moved to the front first, so
+     * that the `memmove` cost stays amortized; mirrored storage needs no move. Follow with `commit()`, even with 0,
+     * to return unused storage.
+     *
+     * @return Free region; empty only if the buffer is full.
+     * @throws std::bad_alloc If storage cannot be borrowed.
+     */
+    [[nodiscard]] std::span<char> prepare()
+    {
+        if (_ring.mapped())
+            return {_storage + _tail, _capacity - size()};
+        if (_storage == nullptr)
+        {
+            _storage = _pool->acquire(_capacity);
+            _head = _tail = 0;
+        }
+        else if (_head > 0 && _capacity - _tail < _capacity / 2)
+        {
+            const std::size_t unread = size();
+            std::memmove(_storage, _storage + _head, unread);
+            _head = 0;
+            _tail = unread;
+        }
+        return {_storage + _tail, _capacity - _tail};
+    }
+
+    /// @brief Appends @p n bytes written into the region returned by `prepare()`.
+    void commit(const std::size_t n) noexcept
+    {
+        _tail += n;
+        if (empty())
+            releaseStorage();
+    }
+
+    /// @brief Drops the first @p n unread bytes (at most `size()`); returns the storage once empty.
+    void consume(const std::size_t n) noexcept
+    {
+        _head += (std::min) (n, size());
+        if (_ring.mapped() && _head >= _capacity)
+        {
+            _head -= _capacity;
+            _tail -= _capacity;
+        }
+        if (empty())
+            releaseStorage();
+    }
+
+    /// @brief Drops all unread bytes and returns the storage.
+    void clear() noexcept { releaseStorage(); }
+
+    /**
+     * @brief Changes the capacity, keeping the unread bytes; never shrinks below `size()`.
+     * @throws std::bad_alloc If storage is held and a larger block cannot be borrowed.
+     */
+    void setCapacity(const std::size_t capacity) { moveTo(*_pool, (std::max) (capacity, size())); }
+
+    /**
+     * @brief Borrows from @p pool from now on, moving any unread bytes into a block from it.
+     * @throws std::bad_alloc If storage is held and a block cannot be borrowed from @p pool.
+     */
+    void setPool(BufferPool& pool) { moveTo(pool, _capacity); }
+
+    /**
+     * @brief Switches between pooled storage and a `MirroredRing` of at least `capacity()` bytes.
+     *
+     * Unread bytes are kept. The ring's capacity is rounded up to a multiple of the page size, and stays at that
+     * size when switching back to pooled blocks.
+     *
+     * @throws SocketException If the ring cannot be mapped (always, on platforms other than Linux).
+     * @throws std::bad_alloc If bytes are buffered and a pool block cannot be borrowed when switching back.
+     */
+    void setMirrored(const bool enable)
+    {
+        if (enable && !_ring.mapped())
+            moveToRing(_capacity);
+        else if (!enable && _ring.mapped())
+            moveOffRing();
+    }
+
+    [[nodiscard]] bool mirrored() const noexcept { return _ring.mapped(); }
+
+    [[nodiscard]] BufferPool& pool() const noexcept { return *_pool; }
+
+  private:
+    void moveTo(BufferPool& pool, const std::size_t capacity)
+    {
+        if (_ring.mapped())
+        {
+            // Resizing a ring maps a new one; the pool is only recorded for when mirroring is turned off
+            if (capacity != _capacity)
+                moveToRing(capacity);
+            _pool = &pool;
+            return;
+        }
+        if (_storage != nullptr)
+        {
+            char* storage = pool.acquire(capacity);
+            const std::size_t unread = size();
+            std::memcpy(storage, _storage + _head, unread);
+            _pool->release(_storage, _capacity);
+            _storage = storage;
+            _head = 0;
+            _tail = unread;
+        }
+        _pool = &pool;
+        _capacity = capacity;
+    }
+
+    void moveToRing(const std::size_t capacity)
+    {
+        MirroredRing ring((std::max) (capacity, size()));
+        const std::size_t unread = size();
+        if (unread > 0)
+            std::memcpy(ring.data(), _storage + _head, unread);
+        if (!_ring.mapped())
+            releaseStorage();
+        _storage = ring.data();
+        _capacity = ring.capacity();
+        _ring = std::move(ring);
+        _head = 0;
+        _tail = unread;
+    }
+
+    void moveOffRing()
+    {
+        char* storage = empty() ? nullptr : _pool->acquire(_capacity);
+        if (storage != nullptr)
+            std::memcpy(storage, _storage + _head, size());
+        _tail = size();
+        _head = 0;
+        _storage = storage;
+        _ring = MirroredRing();
+    }
+
+    void releaseStorage() noexcept
+    {
+        if (_ring.mapped())
+        {
+            _head = _tail = 0; // the ring stays mapped; starting over at its front keeps the touched pages few
+            return;
+        }
+        if (_storage != nullptr)
+            _pool->release(std::exchange(_storage, nullptr), _capacity);
+        _head = _tail = 0;
+    }
+
+    BufferPool* _pool;        ///< Source of `_storage` unless mirrored.
+    MirroredRing _ring;       ///< Mapped while mirrored; `_storage` then points at it.
+    char* _storage = nullptr; ///< Borrowed block of `_capacity` bytes, or `nullptr` while empty; or `_ring.data()`.
+    std::size_t _capacity;    ///< Configured size.
+    std::size_t _head = 0;    ///< First unread byte.
+    std::size_t _tail = 0;    ///< One past the last received byte.
+};
+
+} // namespace jsocketpp::internal
@@ -30,7 +30,7 @@
  *
  * ### Contents
  * - RAII wrappers (e.g., `ScopedBlockingMode`)
- * - Platform-specific buffer conversion tools (e.g., `toIOVec()`, `toWSABUF()`)
+ * - Platform-specific buffer conversion tools (e.g., `IoVecCursor`)
  * - Utility functions for socket state, error codes, and descriptor flags
  *
  * ### Usage
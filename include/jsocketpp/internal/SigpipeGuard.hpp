@@ -0,0 +1,91 @@
+/**
+ * @file SigpipeGuard.hpp
+ * @brief RAII helper that suppresses SIGPIPE around system calls that cannot take MSG_NOSIGNAL.
+ * @author MangaD
+ * @date 2025
+ * @version 1.0
+ */
+
+#pragma once
+
+#if defined(__linux__)
+#include <csignal>
+#include <ctime>
+#endif
+
+namespace jsocketpp::internal
+{
+
+/**
+ * @class SigpipeGuard
+ * @brief Blocks `SIGPIPE` on the calling thread for the guard's lifetime.
+ *
+ * `send()` accepts `MSG_NOSIGNAL`, but `sendfile()` and `splice()` do not: writing to a socket whose peer has gone
+ * raises `SIGPIPE`, which terminates the process by default. While a guard is alive, `SIGPIPE` is blocked, so the
+ * call fails with `EPIPE` instead. On destruction, a `SIGPIPE` raised in the meantime is discarded (unless one was
+ * already pending before the guard) and the previous signal mask is restored.
+ *
+ * ### Example
+ * @code
+ * {
+ *     jsocketpp::internal::SigpipeGuard noSigpipe;
+ *     ::sendfile(sock, file, &offset, count); // EPIPE instead of SIGPIPE
+ * }
+ * @endcode
+ *
+ * @note On platforms other than Linux the guard does nothing.
+ *
+ * @ingroup internal
+ */
+class SigpipeGuard
+{
+  public:
+    /**
+     * @brief Blocks `SIGPIPE` on the calling thread.
+     * @ingroup internal
+     */
+    SigpipeGuard() noexcept
+    {
+#if defined(__linux__)
+        sigemptyset(&_pipe);
+        sigaddset(&_pipe, SIGPIPE);
+        sigset_t pending;
+        sigemptyset(&pending);
+        _wasPending = sigpending(&pending) == 0 && sigismember(&pending, SIGPIPE) == 1;
+        _blocked = pthread_sigmask(SIG_BLOCK, &_pipe, &_previous) == 0;
+#endif
+    }
+
+    /**
+     * @brief Discards a `SIGPIPE` raised while the guard was alive and restores the previous signal mask.
+     * @ingroup internal
+     */
+    ~SigpipeGuard()
+    {
+#if defined(__linux__)
+        if (!_blocked)
+            return;
+        if (!_wasPending)
+        {
+            constexpr timespec zero{0, 0};
+            while (sigtimedwait(&_pipe, nullptr, &zero) > 0)
+            {
+            }
+        }
+        pthread_sigmask(SIG_SETMASK, &_previous, nullptr);
+#endif
+    }
+
+    SigpipeGuard(const SigpipeGuard&) = delete;
+    SigpipeGuard& operator=(const SigpipeGuard&) = delete;
+
+  private:
+#if defined(__linux__)
+    sigset_t _pipe{};          ///< Set containing only SIGPIPE
+    sigset_t _previous{};      ///< Signal mask to restore
+    bool _wasPending = false;  ///< A SIGPIPE was pending before the guard; leave it alone
+    bool _blocked = false;     ///< pthread_sigmask() succeeded
+#endif
+};
+
+} // namespace jsocketpp::internal
@@ -0,0 +1,208 @@
+#include "jsocketpp/AcceptLoop.hpp"
+
+#include <utility>
+
+using namespace jsocketpp;
+
+AcceptLoop::AcceptLoop(ServerSocket& server, Handler handler, AcceptLoopOptions options, ErrorHandler onError)
+    : _server(server), _handler(std::move(handler)), _onError(std::move(onError)), _options(std::move(options))
+{
+    if (!_server.isListening())
+        throw SocketException("AcceptLoop: server socket is not listening.");
+    if (!_handler)
+        throw SocketException("AcceptLoop: handler must not be empty.");
+    if (_options.maxQueuedConnections == 0)
+        throw SocketException("AcceptLoop: maxQueuedConnections must be greater than 0.");
+
+    _restoreBlocking = !_server.getNonBlocking();
+    _server.setNonBlocking(true);
+    _selector.registerSocket(_server, Interest::Accept);
+
+    try
+    {
+        _workers.reserve(_options.workerThreads);
+        for (std::size_t i = 0; i < _options.workerThreads; ++i)
+            _workers.emplace_back(&AcceptLoop::workerMain, this);
+        _acceptThread = std::thread(&AcceptLoop::run, this);
+    }
+    catch (const std::system_error& e)
+    {
+        stop();
+        throw SocketException(e.code().value(), std::string("AcceptLoop: failed to start threads: ") + e.what());
+    }
+}
+
+AcceptLoop::~AcceptLoop() noexcept
+{
+    stop();
+}
+
+void AcceptLoop::stop() noexcept
+{
+    {
+        const std::lock_guard lock(_mutex);
+        _stopping.store(true, std::memory_order_release);
+    }
+    _notEmpty.notify_all();
+    _notFull.notify_all();
+
+    try
+    {
+        _selector.wakeup();
+    }
+    catch (...)
+    {
+        // The accept thread also re-checks _stopping after every select() timeout
+    }
+
+    const auto self = std::this_thread::get_id();
+    if (_acceptThread.joinable() && _acceptThread.get_id() != self)
+        _acceptThread.join();
+    for (auto& worker : _workers)
+    {
+        if (worker.joinable() && worker.get_id() != self)
+            worker.join();
+    }
+
+    std::deque<Socket> abandoned;
+    {
+        const std::lock_guard lock(_mutex);
+        abandoned.swap(_queue);
+    }
+    // abandoned connections are closed by ~Socket() outside the lock
+
+    // The accept thread has exited (or, if this is it, accepts nothing more), so the listener is ours to restore
+    if (std::exchange(_restoreBlocking, false) && _server.isValid())
+    {
+        try
+        {
+            _server.setNonBlocking(false);
+        }
+        catch (...)
+        {
+            // Nothing to report to from a noexcept stop(); the listener stays non-blocking
+        }
+    }
+}
+
+std::size_t AcceptLoop::queuedCount() const
+{
+    const std::lock_guard lock(_mutex);
+    return _queue.size();
+}
+
+void AcceptLoop::run()
+{
+    while (!_stopping.load(std::memory_order_acquire))
+    {
+        try
+        {
+            // A bounded timeout keeps shutdown prompt even if a wakeup is lost
+            if (_selector.select(1000) > 0)
+                drain();
+        }
+        catch (...)
+        {
+            reportError(std::current_exception());
+        }
+    }
+}
+
+void AcceptLoop::drain()
+{
+    while (!_stopping.load(std::memory_order_acquire))
+    {
+        if (!_workers.empty())
+        {
+            std::unique_lock lock(_mutex);
+            _notFull.wait(lock, [this] { return _stopping.load() || _queue.size() < _options.maxQueuedConnections; });
+            if (_stopping.load())
+                return;
+        }
+
+        std::optional<Socket> client;
+        try
+        {
+            client = _server.acceptNonBlocking(_options.recvBufferSize, _options.sendBufferSize,
+                                               _options.internalBufferSize, _options.soRecvTimeoutMillis,
+                                               _options.soSendTimeoutMillis, _options.tcpNoDelay,
+                                               _options.keepAlive, _options.nonBlocking);
+        }
+        catch (const SocketException& e)
+        {
+            if (internal::isTransientAcceptError(e.getErrorCode()))
+                continue;
+
+            reportError(std::current_exception());
+            if (internal::isResourceExhaustion(e.getErrorCode()))
+            {
+                std::unique_lock lock(_mutex);
+                _notFull.wait_for(lock, internal::ResourceBackoff, [this] { return _stopping.load(); });
+                return;
+            }
+            continue;
+        }
+
+        if (!client)
+            return; // listener drained
+
+        _accepted.fetch_add(1, std::memory_order_relaxed);
+
+        if (_workers.empty())
+        {
+            dispatch(std::move(*client));
+            continue;
+        }
+
+        {
+            const std::lock_guard lock(_mutex);
+            _queue.push_back(std::move(*client));
+        }
+        _notEmpty.notify_one();
+    }
+}
+
+void AcceptLoop::workerMain()
+{
+    while (true)
+    {
+        std::unique_lock lock(_mutex);
+        _notEmpty.wait(lock, [this] { return _stopping.load() || !_queue.empty(); });
+        if (_stopping.load())
+            return;
+
+        Socket client = std::move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        _notFull.notify_one();
+
+        dispatch(std::move(client));
+    }
+}
+
+void AcceptLoop::dispatch(Socket client) noexcept
+{
+    try
+    {
+        _handler(std::move(client));
+    }
+    catch (...)
+    {
+        reportError(std::current_exception());
+    }
+}
+
+void AcceptLoop::reportError(std::exception_ptr error) noexcept
+{
+    if (!_onError)
+        return;
+
+    try
+    {
+        _onError(std::move(error));
+    }
+    catch (...)
+    {
+        // An error handler that throws has nowhere left to report to
+    }
+}
@@ -0,0 +1,181 @@
+#include "jsocketpp/BufferPool.hpp"
+
+#include <bit>
+#include <cassert>
+#include <new>
+#include <utility>
+
+using namespace jsocketpp;
+
+namespace
+{
+
+constexpr std::size_t MinShift = std::countr_zero(BufferPool::MinBlockSize);
+
+// Free-list index for a pooled size
+std::size_t classIndex(const std::size_t size) noexcept
+{
+    return static_cast<std::size_t>(std::bit_width(BufferPool::blockSize(size) - 1)) - MinShift;
+}
+
+// Set when the thread's cache is destroyed; trivially destructible, so it stays readable until the thread ends
+thread_local bool threadCacheClosed = false;
+
+} // namespace
+
+struct BufferPool::ThreadCache
+{
+    std::array<void*, Classes> blocks{}; ///< Cached block per size class, or null.
+
+    ThreadCache() noexcept = default;
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ThreadCache(ThreadCache&&) = delete;
+    ThreadCache& operator=(ThreadCache&&) = delete;
+
+    ~ThreadCache()
+    {
+        // Buffers destroyed after this point (other thread-locals) go straight to the shared free lists
+        threadCacheClosed = true;
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            if (blocks[i] != nullptr)
+                global().push(i, blocks[i]);
+        }
+    }
+};
+
+BufferPool::BufferPool(const std::size_t maxCachedBytes) noexcept : _maxCachedBytes(maxCachedBytes)
+{
+}
+
+BufferPool::~BufferPool() noexcept
+{
+    // A block released after this would update a destroyed pool
+    assert(_outstanding.load(std::memory_order_relaxed) == 0 && "BufferPool destroyed while blocks are borrowed");
+    trim();
+}
+
+BufferPool& BufferPool::global() noexcept
+{
+    // Deliberately leaked: sockets destroyed during static destruction may still return blocks, and exiting threads
+    // hand their cached blocks back
+    static BufferPool* const pool = []
+    {
+        auto* created = new BufferPool();
+        created->_threadCached = true;
+        return created;
+    }();
+    return *pool;
+}
+
+BufferPool::ThreadCache* BufferPool::threadCache() noexcept
+{
+    if (threadCacheClosed)
+        return nullptr;
+    thread_local ThreadCache cache;
+    return &cache;
+}
+
+void BufferPool::push(const std::size_t index, void* block) noexcept
+{
+    SizeClass& sizeClass = _classes[index];
+    const std::lock_guard lock(sizeClass.mutex);
+    sizeClass.head = ::new (block) FreeBlock{sizeClass.head};
+}
+
+std::size_t BufferPool::blockSize(const std::size_t size) noexcept
+{
+    if (size <= MinBlockSize)
+        return MinBlockSize;
+    if (size > MaxBlockSize)
+        return size;
+    return std::bit_ceil(size);
+}
+
+char* BufferPool::acquire(const std::size_t size)
+{
+    const std::size_t bytes = blockSize(size);
+    if (bytes <= MaxBlockSize)
+    {
+        const std::size_t index = classIndex(size);
+        void* block = nullptr;
+        if (ThreadCache* cache = _threadCached ? threadCache() : nullptr)
+            block = std::exchange(cache->blocks[index], nullptr);
+        if (block == nullptr)
+        {
+            SizeClass& sizeClass = _classes[index];
+            const std::lock_guard lock(sizeClass.mutex);
+            if (FreeBlock* head = sizeClass.head)
+            {
+                sizeClass.head = head->next;
+                block = head;
+            }
+        }
+        if (block != nullptr)
+        {
+            _cached.fetch_sub(bytes, std::memory_order_relaxed);
+            _outstanding.fetch_add(bytes, std::memory_order_relaxed);
+            return static_cast<char*>(block);
+        }
+    }
+
+    auto* block = static_cast<char*>(::operator new(bytes));
+    _outstanding.fetch_add(bytes, std::memory_order_relaxed);
+    return block;
+}
+
+void BufferPool::release(char* block, const std::size_t size) noexcept
+{
+    if (block == nullptr)
+        return;
+
+    const std::size_t bytes = blockSize(size);
+    _outstanding.fetch_sub(bytes, std::memory_order_relaxed);
+
+    // Reserve room on the free lists first, so that concurrent releases cannot overshoot the bound
+    if (bytes <= MaxBlockSize && _cached.fetch_add(bytes, std::memory_order_relaxed) + bytes <= _maxCachedBytes)
+    {
+        const std::size_t index = classIndex(size);
+        ThreadCache* cache = _threadCached ? threadCache() : nullptr;
+        if (cache != nullptr && cache->blocks[index] == nullptr)
+            cache->blocks[index] = block;
+        else
+            push(index, block);
+        return;
+    }
+    if (bytes <= MaxBlockSize)
+        _cached.fetch_sub(bytes, std::memory_order_relaxed);
+    ::operator delete(block);
+}
+
+void BufferPool::trim() noexcept
+{
+    if (ThreadCache* cache = _threadCached ? threadCache() : nullptr)
+    {
+        for (std::size_t i = 0; i < Classes; ++i)
+        {
+            if (void* block = std::exchange(cache->blocks[i], nullptr))
+            {
+                ::operator delete(block);
+                _cached.fetch_sub(MinBlockSize << i, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < Classes; ++i)
+    {
+        FreeBlock* head = nullptr;
+        {
+            const std::lock_guard lock(_classes[i].mutex);
+            head = std::exchange(_classes[i].head, nullptr);
+        }
+        while (head != nullptr)
+        {
+            FreeBlock* next = head->next;
+            ::operator delete(head);
+            _cached.fetch_sub(MinBlockSize << i, std::memory_order_relaxed);
+            head = next;
+        }
+    }
+}
@@ -0,0 +1,209 @@
+#include "jsocketpp/internal/ByteScan.hpp"
+
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define JSOCKETPP_BYTESCAN_SSE2 1
+#define JSOCKETPP_BYTESCAN_AVX2 1
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define JSOCKETPP_BYTESCAN_SSE2 1
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+using namespace jsocketpp;
+
+namespace
+{
+
+using FindByteFn = const char* (*) (const char*, std::size_t, char) noexcept;
+using FindPatternFn = const char* (*) (const char*, std::size_t, std::string_view) noexcept;
+
+const char* findByteScalar(const char* data, const std::size_t len, const char needle) noexcept
+{
+    return static_cast<const char*>(std::memchr(data, static_cast<unsigned char>(needle), len));
+}
+
+const char* findPatternScalar(const char* data, const std::size_t len, const std::string_view pattern) noexcept
+{
+    const std::size_t m = pattern.size();
+    if (m == 0 || len < m)
+        return nullptr;
+
+    const char* p = data;
+    const char* const last = data + (len - m); // last valid start position
+    while (p <= last)
+    {
+        p = findByteScalar(p, static_cast<std::size_t>(last - p) + 1, pattern.front());
+        if (p == nullptr)
+            return nullptr;
+        if (std::memcmp(p + 1, pattern.data() + 1, m - 1) == 0)
+            return p;
+        ++p;
+    }
+    return nullptr;
+}
+
+#if defined(JSOCKETPP_BYTESCAN_SSE2)
+
+inline unsigned lowestBit(const unsigned mask) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+const char* findByteSse2(const char* data, const std::size_t len, const char needle) noexcept
+{
+    const __m128i n = _mm_set1_epi8(needle);
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, n))); mask != 0)
+            return data + i + lowestBit(mask);
+    }
+    return findByteScalar(data + i, len - i, needle);
+}
+
+// First/last-byte filter: a position is a candidate only if both the first and the last pattern byte match,
+// which rejects almost every position of typical text before any memcmp() is issued.
+const char* findPatternSse2(const char* data, const std::size_t len, const std::string_view pattern) noexcept
+{
+    const std::size_t m = pattern.size();
+    if (m == 0 || len < m)
+        return nullptr;
+    if (m == 1)
+        return findByteSse2(data, len, pattern.front());
+
+    const __m128i first = _mm_set1_epi8(pattern.front());
+    const __m128i last = _mm_set1_epi8(pattern.back());
+    std::size_t i = 0;
+    for (; i + m - 1 + 16 <= len; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + m - 1));
+        auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+        while (mask != 0)
+        {
+            const unsigned bit = lowestBit(mask);
+            if (std::memcmp(data + i + bit + 1, pattern.data() + 1, m - 2) == 0)
+                return data + i + bit;
+            mask &= mask - 1;
+        }
+    }
+    return findPatternScalar(data + i, len - i, pattern);
+}
+
+#endif // JSOCKETPP_BYTESCAN_SSE2
+
+#if defined(JSOCKETPP_BYTESCAN_AVX2)
+
+__attribute__((target("avx2"))) const char* findByteAvx2(const char* data, const std::size_t len,
+                                                         const char needle) noexcept
+{
+    const __m256i n = _mm256_set1_epi8(needle);
+    std::size_t i = 0;
+
+    // Two vectors per iteration: the combined mask is tested once, and only a hit pays for locating the byte
+    for (; i + 64 <= len; i += 64)
+    {
+        const __m256i eq0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), n);
+        const __m256i eq1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32)), n);
+        if (_mm256_movemask_epi8(_mm256_or_si256(eq0, eq1)) != 0)
+        {
+            if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(eq0)); mask != 0)
+                return data + i + lowestBit(mask);
+            return data + i + 32 + lowestBit(static_cast<unsigned>(_mm256_movemask_epi8(eq1)));
+        }
+    }
+    for (; i + 32 <= len; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, n))); mask != 0)
+            return data + i + lowestBit(mask);
+    }
+    return findByteSse2(data + i, len - i, needle);
+}
+
+__attribute__((target("avx2"))) const char* findPatternAvx2(const char* data, const std::size_t len,
+                                                            const std::string_view pattern) noexcept
+{
+    const std::size_t m = pattern.size();
+    if (m == 0 || len < m)
+        return nullptr;
+    if (m == 1)
+        return findByteAvx2(data, len, pattern.front());
+
+    const __m256i first = _mm256_set1_epi8(pattern.front());
+    const __m256i last = _mm256_set1_epi8(pattern.back());
+    std::size_t i = 0;
+    for (; i + m - 1 + 32 <= len; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + m - 1));
+        auto mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+        while (mask != 0)
+        {
+            const unsigned bit = lowestBit(mask);
+            if (std::memcmp(data + i + bit + 1, pattern.data() + 1, m - 2) == 0)
+                return data + i + bit;
+            mask &= mask - 1;
+        }
+    }
+    return findPatternSse2(data + i, len - i, pattern);
+}
+
+#endif // JSOCKETPP_BYTESCAN_AVX2
+
+FindByteFn selectFindByte() noexcept
+{
+#if defined(__GLIBC__)
+    // glibc's memchr() is already ifunc-dispatched to unrolled AVX2/EVEX code and outruns the loops above
+    return &findByteScalar;
+#else
+#if defined(JSOCKETPP_BYTESCAN_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return &findByteAvx2;
+#endif
+#if defined(JSOCKETPP_BYTESCAN_SSE2)
+    return &findByteSse2;
+#else
+    return &findByteScalar;
+#endif
+#endif // __GLIBC__
+}
+
+FindPatternFn selectFindPattern() noexcept
+{
+#if defined(JSOCKETPP_BYTESCAN_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return &findPatternAvx2;
+#endif
+#if defined(JSOCKETPP_BYTESCAN_SSE2)
+    return &findPatternSse2;
+#else
+    return &findPatternScalar;
+#endif
+}
+
+} // namespace
+
+const char* internal::findByte(const char* data, const std::size_t len, const char needle) noexcept
+{
+    static const FindByteFn impl = selectFindByte();
+    return impl(data, len, needle);
+}
+
+const char* internal::findPattern(const char* data, const std::size_t len, const std::string_view pattern) noexcept
+{
+    static const FindPatternFn impl = selectFindPattern();
+    return impl(data, len, pattern);
+}
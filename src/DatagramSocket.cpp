@@ -1,14 +1,59 @@
 #include "jsocketpp/DatagramSocket.hpp"
+#include "jsocketpp/internal/PollWait.hpp"
 #include "jsocketpp/internal/ScopedBlockingMode.hpp"
 #include "jsocketpp/SocketException.hpp"
 #include "jsocketpp/SocketTimeoutException.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <numeric>
 #include <optional>
 
 using namespace jsocketpp;
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+
+// Older C libraries lack the UDP offload option names; the values are fixed by the kernel ABI
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+namespace
+{
+/// Messages per recvmmsg()/sendmmsg() call; bounds the on-stack header arrays.
+constexpr std::size_t BatchSize = 64;
+
+/// Segments per UDP_SEGMENT send (the kernel's UDP_MAX_SEGMENTS on pre-6.x kernels).
+constexpr std::size_t MaxGsoSegments = 64;
+} // namespace
+#endif
+
+namespace
+{
+/// Error code to report for a `POLLERR`/`POLLNVAL`/`POLLHUP` result: the pending `SO_ERROR`, or a generic code.
+int pollErrorCode(const SOCKET fd, const short revents)
+{
+    if (revents & POLLNVAL)
+    {
+#ifdef _WIN32
+        return WSAENOTSOCK;
+#else
+        return EBADF;
+#endif
+    }
+
+    int soerr = 0;
+    auto optlen = static_cast<socklen_t>(sizeof(soerr));
+    (void) ::getsockopt(fd, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&soerr), &optlen);
+    return soerr != 0 ? soerr : EIO; // fall back if no specific error reported
+}
+} // namespace
+
 DatagramSocket::DatagramSocket(const Port localPort, const std::string_view localAddress,
                                const std::optional<std::size_t> recvBufferSize,
                                const std::optional<std::size_t> sendBufferSize,
@@ -170,7 +215,7 @@ void DatagramSocket::cleanup()
 void DatagramSocket::cleanupAndThrow(const int errorCode)
 {
     cleanup();
-    throw SocketException(errorCode, SocketErrorMessage(errorCode));
+    throw SocketException(errorCode);
 }
 
 void DatagramSocket::cleanupAndRethrow()
@@ -231,7 +276,7 @@ void DatagramSocket::bind(const std::string_view localAddress, const Port localP
     }
 
     const int error = GetSocketError();
-    throw SocketException(error, SocketErrorMessage(error));
+    throw SocketException(error);
 }
 
 void DatagramSocket::bind(const Port localPort)
@@ -251,11 +296,6 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
     if (_isConnected)
         throw SocketException("connect() called on an already-connected socket");
 
-    // If you keep using select(), guard FD_SETSIZE up front.
-    if (timeoutMillis >= 0 && getSocketFd() >= FD_SETSIZE)
-        throw SocketException("connect(): socket descriptor exceeds FD_SETSIZE (" + std::to_string(FD_SETSIZE) +
-                              "), select() cannot be used");
-
     // Resolve all candidates (IPv6/IPv4 as available)
     const auto remoteInfo = internal::resolveAddress(host, port, AF_UNSPEC, SOCK_DGRAM, IPPROTO_UDP);
     const addrinfo* ai = remoteInfo.get();
@@ -270,29 +310,16 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
     if (useNonBlocking)
         blockingGuard.emplace(getSocketFd(), true);
 
-    // Track deadline so multiple candidates don't exceed the total timeout.
-    const auto start = std::chrono::steady_clock::now();
-    auto remaining_ms = [&]() -> int
-    {
-        if (!useNonBlocking)
-            return -1;
-        const auto elapsed =
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
-        const long rem = static_cast<long>(timeoutMillis) - static_cast<long>(elapsed);
-        return rem > 0 ? static_cast<int>(rem) : 0;
-    };
+    // One deadline for all candidates, so that together they don't exceed the total timeout.
+    const auto deadline = internal::Deadline::after(timeoutMillis);
 
     int lastErr = 0;
 
     for (const addrinfo* p = ai; p != nullptr; p = p->ai_next)
     {
         // Quick check: if we have a deadline and it's gone, throw timeout now.
-        if (useNonBlocking)
-        {
-            if (const int rem = remaining_ms(); rem == 0)
-                throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                             "Connection timed out after " + std::to_string(timeoutMillis) + " ms");
-        }
+        if (deadline.expired())
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Connection timed out");
 
         const int rc = ::connect(getSocketFd(), p->ai_addr,
 #ifdef _WIN32
@@ -334,30 +361,10 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
         }
 
         // Non-blocking connect in progress — wait for writability within remaining time.
-        const int rem_ms = remaining_ms();
-        if (rem_ms == 0)
-            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                         "Connection timed out after " + std::to_string(timeoutMillis) + " ms");
-
-        timeval tv{};
-        tv.tv_sec = rem_ms / 1000;
-        tv.tv_usec = (rem_ms % 1000) * 1000;
-
-        fd_set writeFds;
-        FD_ZERO(&writeFds);
-        FD_SET(getSocketFd(), &writeFds);
+        if (deadline.expired())
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Connection timed out");
 
-#ifdef _WIN32
-        const int sel = ::select(0, nullptr, &writeFds, nullptr, &tv);
-#else
-        int sel;
-        do
-        {
-            sel = ::select(getSocketFd() + 1, nullptr, &writeFds, nullptr, &tv);
-        } while (sel < 0 && errno == EINTR);
-#endif
-
-        if (sel == 0)
+        if (!internal::waitFor(getSocketFd(), true /* forWrite */, deadline))
         {
             // Timed out waiting for this candidate — try next if any time remains, else throw.
             // We *don’t* immediately throw here to give other candidates a chance within the total timeout.
@@ -365,11 +372,6 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
             lastErr = JSOCKETPP_TIMEOUT_CODE;
             continue;
         }
-        if (sel < 0)
-        {
-            const int selErr = GetSocketError();
-            throw SocketException(selErr, SocketErrorMessage(selErr));
-        }
 
         // Writable: check SO_ERROR to determine success/failure of the connect attempt.
         int so_error = 0;
@@ -383,7 +385,7 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
                          &len) < 0)
         {
             const int optErr = GetSocketError();
-            throw SocketException(optErr, SocketErrorMessage(optErr));
+            throw SocketException(optErr);
         }
 
         if (so_error == 0)
@@ -404,13 +406,12 @@ void DatagramSocket::connect(const std::string_view host, const Port port, const
     }
 
     // No candidate succeeded.
-    if (useNonBlocking && remaining_ms() == 0 && lastErr == JSOCKETPP_TIMEOUT_CODE)
+    if (deadline.expired() && lastErr == JSOCKETPP_TIMEOUT_CODE)
     {
-        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                     "Connection timed out after " + std::to_string(timeoutMillis) + " ms");
+        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Connection timed out");
     }
     if (lastErr != 0)
-        throw SocketException(lastErr, SocketErrorMessage(lastErr));
+        throw SocketException(lastErr);
 
     // Fallback (shouldn’t happen): generic failure.
     throw SocketException("connect() failed for all address candidates");
@@ -444,7 +445,7 @@ void DatagramSocket::disconnect()
     if (rc == SOCKET_ERROR)
     {
         const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     _isConnected = false;
@@ -545,6 +546,199 @@ void DatagramSocket::write(const DatagramPacket& packet)
     internal::sendExact(getSocketFd(), packet.buffer.data(), len);
 }
 
+std::size_t DatagramSocket::writeBatch(const std::span<const DatagramPacket> packets)
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::writeBatch(): socket is not open.");
+
+#if defined(__linux__)
+    std::array<mmsghdr, BatchSize> msgs{};
+    std::array<iovec, BatchSize> iovs{};
+    std::array<sockaddr_storage, BatchSize> names{};
+    std::size_t pending = 0;
+
+    // Most recent resolution, reused while consecutive packets target the same host and port
+    std::string_view lastHost;
+    Port lastPort = 0;
+    sockaddr_storage lastAddr{};
+    socklen_t lastAddrLen = 0;
+    int family = AF_UNSPEC;
+    bool sentUnconnected = false;
+
+    const auto flush = [&]
+    {
+        std::size_t sent = 0;
+        while (sent < pending)
+        {
+            const int n = ::sendmmsg(getSocketFd(), msgs.data() + sent, static_cast<unsigned>(pending - sent),
+                                     MSG_NOSIGNAL);
+            if (n < 0)
+            {
+                const int err = GetSocketError();
+                if (err == EINTR)
+                    continue;
+                throw SocketException(err);
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        pending = 0;
+    };
+
+    for (const DatagramPacket& packet : packets)
+    {
+        const std::size_t len = packet.buffer.size();
+        if (len == 0)
+            continue;
+
+        mmsghdr& msg = msgs[pending];
+        msg = mmsghdr{};
+
+        if (packet.hasDestination())
+        {
+            if (lastAddrLen == 0 || packet.address != lastHost || packet.port != lastPort)
+            {
+                lastAddrLen = 0;
+                try
+                {
+                    if (family == AF_UNSPEC)
+                        family = getOption(SOL_SOCKET, SO_DOMAIN);
+                    if (const auto numeric = Endpoint::parse(packet.address, packet.port);
+                        numeric && numeric->getFamily() == family)
+                    {
+                        std::memcpy(&lastAddr, numeric->data(), numeric->size());
+                        lastAddrLen = numeric->size();
+                    }
+                    else
+                    {
+                        const auto ai = internal::resolveAddress(packet.address, packet.port, family, SOCK_DGRAM,
+                                                                 IPPROTO_UDP, family == AF_INET6 ? AI_V4MAPPED : 0);
+                        std::memcpy(&lastAddr, ai->ai_addr, ai->ai_addrlen);
+                        lastAddrLen = static_cast<socklen_t>(ai->ai_addrlen);
+                    }
+                    lastHost = packet.address;
+                    lastPort = packet.port;
+                }
+                catch (const SocketException&)
+                {
+                    // Leave unusual destinations to write(), which tries every candidate and reports errors
+                }
+            }
+
+            const std::size_t cap = lastAddr.ss_family == AF_INET6 ? MaxUdpPayloadIPv6 : MaxUdpPayloadIPv4;
+            if (lastAddrLen == 0 || len > cap)
+            {
+                flush();
+                write(packet);
+                continue;
+            }
+
+            std::memcpy(&names[pending], &lastAddr, lastAddrLen);
+            msg.msg_hdr.msg_name = &names[pending];
+            msg.msg_hdr.msg_namelen = lastAddrLen;
+            sentUnconnected = true;
+        }
+        else
+        {
+            if (!isConnected())
+                throw SocketException(
+                    "DatagramSocket::writeBatch(): no destination specified and socket is not connected.");
+            enforceSendCapConnected(len);
+        }
+
+        iovs[pending].iov_base = const_cast<char*>(packet.buffer.data());
+        iovs[pending].iov_len = len;
+        msg.msg_hdr.msg_iov = &iovs[pending];
+        msg.msg_hdr.msg_iovlen = 1;
+
+        if (++pending == BatchSize)
+            flush();
+    }
+    flush();
+
+    if (sentUnconnected)
+    {
+        if (!_isBound)
+        {
+            cacheLocalEndpoint();
+            _isBound = true;
+        }
+        if (!_isConnected)
+            rememberRemote(lastAddr, lastAddrLen);
+    }
+#else
+    for (const DatagramPacket& packet : packets)
+        write(packet);
+#endif
+
+    return packets.size();
+}
+
+void DatagramSocket::writeSegmented(const std::string_view data, const std::size_t segmentSize) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::writeSegmented(): socket is not open.");
+    if (!isConnected())
+        throw SocketException("DatagramSocket::writeSegmented(): socket is not connected.");
+    if (segmentSize == 0)
+        throw SocketException("DatagramSocket::writeSegmented(): segment size must be non-zero.");
+
+    enforceSendCapConnected((std::min) (segmentSize, data.size()));
+
+    std::size_t offset = 0;
+
+#if defined(__linux__)
+    // One super-packet may hold at most MaxGsoSegments segments and one IPv4 datagram's worth of payload
+    const std::size_t segmentsPerSend = std::clamp(MaxUdpPayloadIPv4 / segmentSize, std::size_t{1}, MaxGsoSegments);
+    const std::size_t perSend = segmentsPerSend * segmentSize;
+    const auto gsoSize = static_cast<std::uint16_t>(segmentSize);
+
+    while (data.size() - offset > segmentSize)
+    {
+        const std::size_t len = (std::min) (perSend, data.size() - offset);
+
+        iovec iov{};
+        iov.iov_base = const_cast<char*>(data.data() + offset);
+        iov.iov_len = len;
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(gsoSize))]{};
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = IPPROTO_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(gsoSize));
+        std::memcpy(CMSG_DATA(cmsg), &gsoSize, sizeof(gsoSize));
+
+        ssize_t n;
+        do
+        {
+            n = ::sendmsg(getSocketFd(), &msg, MSG_NOSIGNAL);
+        } while (n < 0 && GetSocketError() == EINTR);
+
+        if (n < 0)
+        {
+            const int err = GetSocketError();
+            // No GSO support in this kernel, or the route/device cannot segment: send the rest one by one
+            if (err == EINVAL || err == EIO || err == ENOPROTOOPT || err == EOPNOTSUPP)
+                break;
+            throw SocketException(err);
+        }
+        offset += len;
+    }
+#endif
+
+    while (offset < data.size())
+    {
+        const std::size_t len = (std::min) (segmentSize, data.size() - offset);
+        internal::sendExact(getSocketFd(), data.data() + offset, len);
+        offset += len;
+    }
+}
+
 void DatagramSocket::writeFrom(const void* data, const std::size_t len) const
 {
     if (getSocketFd() == INVALID_SOCKET)
@@ -577,39 +771,8 @@ void DatagramSocket::writev(const std::span<const std::string_view> buffers) con
     // Validate against UDP maxima for the connected peer (IPv4/IPv6-aware).
     enforceSendCapConnected(total);
 
-    // Fast path: a single fragment — send it directly with no extra copy.
-    if (buffers.size() == 1)
-    {
-        const auto& b = buffers.front();
-        internal::sendExact(getSocketFd(), b.data(), b.size());
-        return;
-    }
-
-    // General path: coalesce fragments into one contiguous buffer, then send once.
-    // Note: We copy because UDP must be sent in a single syscall; if your platform
-    // path uses sendmsg/WSASend with scatter-gather, you could add an SG path here.
-    std::vector<std::byte> datagram;
-    try
-    {
-        datagram.resize(total);
-    }
-    catch (const std::bad_alloc&)
-    {
-        throw SocketException(0, "DatagramSocket::writev(): allocation failed for datagram buffer of size " +
-                                     std::to_string(total));
-    }
-
-    std::byte* dst = datagram.data();
-    for (const auto& b : buffers)
-    {
-        if (!b.empty())
-        {
-            std::memcpy(dst, b.data(), b.size());
-            dst += b.size();
-        }
-    }
-
-    internal::sendExact(getSocketFd(), datagram.data(), datagram.size());
+    // One sendmsg()/WSASendTo() over the fragments; no intermediate buffer.
+    internal::sendExactv(getSocketFd(), buffers);
 }
 
 void DatagramSocket::writevAll(const std::span<const std::string_view> buffers) const
@@ -634,38 +797,8 @@ void DatagramSocket::writevAll(const std::span<const std::string_view> buffers)
     // (-1 means wait indefinitely; adjust if you want a bounded internal timeout.)
     waitReady(Direction::Write, -1);
 
-    // Fast path: a single fragment — send directly without extra allocation/copy.
-    if (buffers.size() == 1)
-    {
-        const auto& b = buffers.front();
-        internal::sendExact(getSocketFd(), b.data(), b.size());
-        return;
-    }
-
-    // General path: coalesce fragments into one contiguous buffer, then send once.
-    // (If you later add a scatter/gather path (sendmsg/WSASend), you can replace this copy.)
-    std::vector<std::byte> datagram;
-    try
-    {
-        datagram.resize(total);
-    }
-    catch (const std::bad_alloc&)
-    {
-        throw SocketException(0, "DatagramSocket::writevAll(): allocation failed for datagram buffer of size " +
-                                     std::to_string(total));
-    }
-
-    std::byte* dst = datagram.data();
-    for (const auto& b : buffers)
-    {
-        if (!b.empty())
-        {
-            std::memcpy(dst, b.data(), b.size());
-            dst += b.size();
-        }
-    }
-
-    internal::sendExact(getSocketFd(), datagram.data(), datagram.size());
+    // One sendmsg()/WSASendTo() over the fragments; no intermediate buffer.
+    internal::sendExactv(getSocketFd(), buffers);
 }
 
 void DatagramSocket::writeTo(const std::string_view host, const Port port, const std::string_view message)
@@ -692,6 +825,56 @@ void DatagramSocket::writeTo(const std::string_view host, const Port port, const
     sendUnconnectedTo(host, port, data.data(), len);
 }
 
+void DatagramSocket::writeTo(const Endpoint& destination, const std::string_view message)
+{
+    writeTo(destination, std::as_bytes(std::span(message.data(), message.size())));
+}
+
+void DatagramSocket::writeTo(const Endpoint& destination, const std::span<const std::byte> data)
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::writeTo(Endpoint, ...): socket is not open.");
+    if (!destination.isValid())
+        throw SocketException("DatagramSocket::writeTo(Endpoint, ...): endpoint is empty.");
+    if (data.empty())
+        return;
+
+    if (data.size() > (destination.getFamily() == AF_INET6 ? MaxUdpPayloadIPv6 : MaxUdpPayloadIPv4))
+        throw SocketException(0, "DatagramSocket::writeTo(Endpoint, ...): payload exceeds the UDP limit for the "
+                                 "endpoint's address family.");
+
+    sendToEndpoint(destination, data.data(), data.size());
+}
+
+void DatagramSocket::writevTo(const std::string_view host, const Port port,
+                              const std::span<const std::string_view> buffers)
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::writevTo(host, port, ...): socket is not open.");
+
+    sendUnconnectedTo(host, port, buffers);
+}
+
+void DatagramSocket::writevTo(const Endpoint& destination, const std::span<const std::string_view> buffers)
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::writevTo(Endpoint, ...): socket is not open.");
+    if (!destination.isValid())
+        throw SocketException("DatagramSocket::writevTo(Endpoint, ...): endpoint is empty.");
+
+    std::size_t total = 0;
+    for (const auto& b : buffers)
+        total += b.size();
+    if (total == 0)
+        return;
+
+    if (total > (destination.getFamily() == AF_INET6 ? MaxUdpPayloadIPv6 : MaxUdpPayloadIPv4))
+        throw SocketException(0, "DatagramSocket::writevTo(Endpoint, ...): payload exceeds the UDP limit for the "
+                                 "endpoint's address family.");
+
+    sendToEndpoint(destination, buffers);
+}
+
 std::size_t DatagramSocket::readIntoBuffer(char* buf, const std::size_t len, const DatagramReceiveMode mode,
                                            const int recvFlags, sockaddr_storage* outSrc, socklen_t* outSrcLen,
                                            std::size_t* outDatagramSz, bool* outTruncated) const
@@ -737,126 +920,29 @@ std::size_t DatagramSocket::readIntoBuffer(char* buf, const std::size_t len, con
     if (outTruncated)
         *outTruncated = false;
 
-    // EINTR-safe receive loop
-    for (;;)
+    DatagramReadResult info{};
+    const IoResult result = tryReadInto(buf, request, info, recvFlags);
+    if (result.wouldBlock())
     {
-        ssize_t n = SOCKET_ERROR;
-
-#if defined(__unix__) || defined(__APPLE__) || defined(__linux__)
-        // --- POSIX path: use recvmsg to get precise truncation info ---
-        ::msghdr msg{};
-        ::iovec iov{};
-        iov.iov_base = buf;
-        iov.iov_len = request;
-        msg.msg_iov = &iov;
-        msg.msg_iovlen = 1;
-
-        if (outSrc)
-        {
-            msg.msg_name = outSrc;
-            msg.msg_namelen = (outSrcLen ? *outSrcLen : 0);
-        }
-
-        int flags = recvFlags;
-#if defined(__linux__)
-        // On Linux, passing MSG_TRUNC causes recvmsg(...) to return the *full* datagram size,
-        // even if it exceeds iov_len. msg_flags will still indicate MSG_TRUNC when truncated.
-        flags |= MSG_TRUNC;
-#endif
-
-        n = ::recvmsg(getSocketFd(), &msg, flags);
-
-        if (n == SOCKET_ERROR)
-        {
-            const int err = GetSocketError();
-#ifndef _WIN32
-            if (err == EINTR)
-            {
-                continue; // retry
-            }
-            // NOLINTNEXTLINE
-            const bool wouldBlock = (err == EAGAIN || err == EWOULDBLOCK);
-            const bool timedOut = wouldBlock; // SO_RCVTIMEO maps here on POSIX
-#else
-            const bool wouldBlock = (err == WSAEWOULDBLOCK);
-            const bool timedOut = (err == WSAETIMEDOUT);
-#endif
-            if (timedOut)
-                throw SocketTimeoutException();
-            if (wouldBlock)
-                throw SocketTimeoutException(err, SocketErrorMessage(err));
-            throw SocketException(err, SocketErrorMessage(err));
-        }
-
-        // Success: compute copied bytes, truncation, and datagram size.
-        if (outSrcLen)
-            *outSrcLen = msg.msg_namelen;
-
-        const bool msgTrunc = (msg.msg_flags & MSG_TRUNC) != 0;
-
-#if defined(__linux__)
-        // On Linux, n == FULL datagram size when MSG_TRUNC is passed.
-        const auto fullSize = static_cast<std::size_t>(n);
-        const std::size_t copied = (std::min) (request, fullSize);
-
-        if (outTruncated)
-            *outTruncated = msgTrunc && (fullSize > len);
-        if (outDatagramSz && *outDatagramSz == 0)
-            *outDatagramSz = fullSize;
-
-        return copied;
-#else
-        // Other POSIX: n is the *copied* byte count. MSG_TRUNC indicates truncation occurred.
-        const std::size_t copied = static_cast<std::size_t>(n);
-
-        if (outTruncated)
-            *outTruncated = msgTrunc || (copied == len);
-        if (outDatagramSz && *outDatagramSz == 0)
-            *outDatagramSz = copied; // full size unknown here
-
-        return copied;
-#endif
-
-#else
-        // --- Non-POSIX path (e.g., Windows): fallback to existing internal primitive ---
-        n = internal::recvInto(getSocketFd(), std::span(reinterpret_cast<std::byte*>(buf), request), recvFlags, outSrc,
-                               outSrcLen);
-
-        if (n != SOCKET_ERROR)
-        {
-            const auto received = static_cast<std::size_t>(n);
-
-            // Truncation reporting (best effort on this path)
-            if (outTruncated)
-            {
-                if (probed > 0)
-                {
-                    *outTruncated = (probed > len);
-                }
-                else
-                {
-                    *outTruncated = (received == len); // heuristic
-                }
-            }
-
-            if (outDatagramSz && *outDatagramSz == 0)
-                *outDatagramSz = (probed > 0 ? probed : received);
-
-            return received;
-        }
-
-        // Error path (Windows)
-        const int err = GetSocketError();
-        const bool wouldBlock = (err == WSAEWOULDBLOCK);
-        const bool timedOut = (err == WSAETIMEDOUT);
-
-        if (timedOut)
-            throw SocketTimeoutException();
-        if (wouldBlock)
-            throw SocketTimeoutException(err, SocketErrorMessage(err));
-        throw SocketException(err, SocketErrorMessage(err));
+#ifdef _WIN32
+        if (result.error == WSAEWOULDBLOCK)
+            throw SocketTimeoutException(result.error);
 #endif
+        throw SocketTimeoutException(); // SO_RCVTIMEO expired, or nothing queued on a non-blocking socket
     }
+    if (!result.ok())
+        throw SocketException(result.error);
+
+    if (outSrc)
+        *outSrc = info.src;
+    if (outSrcLen)
+        *outSrcLen = outSrc ? info.srcLen : 0;
+    // `request` may be below `len` only when it is clamped to the probed or the largest possible datagram size
+    if (outTruncated)
+        *outTruncated = info.truncated && (info.datagramSize == 0 || info.datagramSize > len);
+    if (outDatagramSz && *outDatagramSz == 0)
+        *outDatagramSz = info.datagramSize != 0 ? info.datagramSize : info.bytes;
+    return info.bytes;
 }
 
 DatagramReadResult DatagramSocket::read(DatagramPacket& packet, const DatagramReadOptions& opts) const
@@ -961,6 +1047,214 @@ DatagramReadResult DatagramSocket::read(DatagramPacket& packet, const DatagramRe
     return result;
 }
 
+std::size_t DatagramSocket::readBatch(const std::span<DatagramPacket> packets, const DatagramReadOptions& opts,
+                                      const std::span<DatagramReadResult> results) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::readBatch(): socket is not open.");
+    if (packets.empty())
+        return 0;
+
+    for (DatagramPacket& packet : packets)
+    {
+        if (packet.size() > 0)
+            continue;
+        if (!opts.allowGrow)
+            throw SocketException(
+                "DatagramSocket::readBatch(): packet buffer is empty; provide capacity or enable growth.");
+        packet.resize((std::min) (DefaultDatagramReceiveSize, MaxDatagramPayloadSafe));
+    }
+
+    std::size_t received = 0;
+    bool anyTruncated = false;
+
+#if defined(__linux__)
+    std::array<mmsghdr, BatchSize> msgs{};
+    std::array<iovec, BatchSize> iovs{};
+    std::array<sockaddr_storage, BatchSize> srcs{};
+
+    while (received < packets.size())
+    {
+        const std::size_t count = (std::min) (packets.size() - received, BatchSize);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            DatagramPacket& packet = packets[received + i];
+            iovs[i].iov_base = packet.buffer.data();
+            iovs[i].iov_len = (std::min) (packet.size(), MaxDatagramPayloadSafe);
+            msgs[i] = mmsghdr{};
+            msgs[i].msg_hdr.msg_name = &srcs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Only the first call may wait; later ones just drain what is already queued. MSG_TRUNC makes msg_len
+        // report the full datagram size.
+        const int flags = opts.recvFlags | MSG_TRUNC | (received == 0 ? MSG_WAITFORONE : MSG_DONTWAIT);
+        int n;
+        do
+        {
+            n = ::recvmmsg(getSocketFd(), msgs.data(), static_cast<unsigned>(count), flags, nullptr);
+        } while (n < 0 && GetSocketError() == EINTR);
+
+        if (n < 0)
+        {
+            const int err = GetSocketError();
+            // NOLINTNEXTLINE
+            const bool wouldBlock = (err == EAGAIN || err == EWOULDBLOCK);
+            if (wouldBlock && received > 0)
+                break;
+            if (wouldBlock)
+                throw SocketTimeoutException(); // SO_RCVTIMEO or non-blocking, as in readIntoBuffer()
+            throw SocketException(err);
+        }
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(n); ++i)
+        {
+            DatagramPacket& packet = packets[received + i];
+            const std::size_t full = msgs[i].msg_len;
+            const std::size_t bytes = (std::min) (full, iovs[i].iov_len);
+            const bool truncated = (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) != 0 && full > bytes;
+            const socklen_t srcLen = msgs[i].msg_hdr.msg_namelen;
+            anyTruncated = anyTruncated || truncated;
+
+            if (received + i < results.size())
+            {
+                DatagramReadResult& result = results[received + i];
+                result.bytes = bytes;
+                result.datagramSize = full;
+                result.truncated = truncated;
+                result.src = srcs[i];
+                result.srcLen = srcLen;
+            }
+            if (opts.resolveNumeric)
+                internal::resolveNumericHostPort(reinterpret_cast<const sockaddr*>(&srcs[i]), srcLen, packet.address,
+                                                 packet.port);
+            if (opts.allowShrink && !truncated && packet.size() != bytes)
+                packet.resize(bytes);
+        }
+
+        const auto got = static_cast<std::size_t>(n);
+        if (opts.updateLastRemote && got > 0)
+            rememberRemote(srcs[got - 1], msgs[got - 1].msg_hdr.msg_namelen);
+
+        received += got;
+        if (got < count)
+            break;
+    }
+#else
+    // Same policy as the recvmmsg() path: no per-datagram preflight, truncation reported after the batch
+    DatagramReadOptions each = opts;
+    each.mode = DatagramReceiveMode::NoPreflight;
+    each.allowGrow = false;
+    each.errorOnTruncate = false;
+
+    do
+    {
+        const DatagramReadResult result = read(packets[received], each);
+        anyTruncated = anyTruncated || result.truncated;
+        if (received < results.size())
+            results[received] = result;
+        ++received;
+    } while (received < packets.size() && hasPendingData(0));
+#endif
+
+    if (opts.errorOnTruncate && anyTruncated)
+        throw SocketException("DatagramSocket::readBatch(): one or more datagrams were truncated.");
+
+    return received;
+}
+
+DatagramReadResult DatagramSocket::readSegments(const std::span<char> buffer,
+                                                std::vector<std::span<const char>>& segments,
+                                                const DatagramReadOptions& opts) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("DatagramSocket::readSegments(): socket is not open.");
+    if (buffer.empty())
+        throw SocketException("DatagramSocket::readSegments(): buffer is empty.");
+
+    segments.clear();
+
+#if defined(__linux__)
+    DatagramReadResult result{};
+
+    iovec iov{};
+    iov.iov_base = buffer.data();
+    iov.iov_len = buffer.size();
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+    msghdr msg{};
+    msg.msg_name = &result.src;
+    msg.msg_namelen = sizeof(result.src);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n;
+    do
+    {
+        n = ::recvmsg(getSocketFd(), &msg, opts.recvFlags | MSG_TRUNC);
+    } while (n < 0 && GetSocketError() == EINTR);
+
+    if (n < 0)
+    {
+        const int err = GetSocketError();
+        // NOLINTNEXTLINE
+        if (err == EAGAIN || err == EWOULDBLOCK)
+            throw SocketTimeoutException(); // SO_RCVTIMEO or non-blocking, as in readIntoBuffer()
+        throw SocketException(err);
+    }
+
+    result.datagramSize = static_cast<std::size_t>(n);
+    result.bytes = (std::min) (result.datagramSize, buffer.size());
+    result.truncated = (msg.msg_flags & MSG_TRUNC) != 0 && result.datagramSize > result.bytes;
+    result.srcLen = msg.msg_namelen;
+
+    std::size_t segmentSize = result.bytes;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO)
+        {
+            int gsoSize = 0;
+            std::memcpy(&gsoSize, CMSG_DATA(cmsg), sizeof(gsoSize));
+            if (gsoSize > 0)
+                segmentSize = static_cast<std::size_t>(gsoSize);
+        }
+    }
+
+    if (result.bytes == 0)
+        segments.emplace_back(buffer.data(), 0);
+    for (std::size_t offset = 0; offset < result.bytes; offset += segmentSize)
+        segments.emplace_back(buffer.data() + offset, (std::min) (segmentSize, result.bytes - offset));
+
+    if (opts.updateLastRemote)
+        rememberRemote(result.src, result.srcLen);
+    if (opts.errorOnTruncate && result.truncated)
+        throw SocketException("DatagramSocket::readSegments(): received data was truncated.");
+    return result;
+#else
+    DatagramReadOptions single = opts;
+    single.mode = DatagramReceiveMode::NoPreflight;
+    const DatagramReadResult result = readInto(buffer, single);
+    segments.emplace_back(buffer.data(), result.bytes);
+    return result;
+#endif
+}
+
+#if defined(__linux__)
+void DatagramSocket::setUdpGro(const bool enable)
+{
+    setOption(IPPROTO_UDP, UDP_GRO, enable ? 1 : 0);
+}
+
+bool DatagramSocket::getUdpGro() const
+{
+    return getOption(IPPROTO_UDP, UDP_GRO) != 0;
+}
+#endif
+
 [[nodiscard]] DatagramReadResult DatagramSocket::readInto(void* buffer, const std::size_t len,
                                                           const DatagramReadOptions& opts) const
 {
@@ -1042,6 +1336,87 @@ DatagramReadResult DatagramSocket::read(DatagramPacket& packet, const DatagramRe
     return readInto(out.data(), out.size(), opts);
 }
 
+IoResult DatagramSocket::tryReadInto(void* buffer, const std::size_t len) const noexcept
+{
+    if (buffer == nullptr || len == 0)
+        return {};
+
+    const auto n = ::recv(getSocketFd(), static_cast<char*>(buffer),
+#ifdef _WIN32
+                          static_cast<int>(len),
+#else
+                          len,
+#endif
+                          0);
+    if (n == SOCKET_ERROR)
+        return IoResult::failure(GetSocketError());
+    return {static_cast<std::size_t>(n)};
+}
+
+IoResult DatagramSocket::tryReadInto(void* buffer, const std::size_t len, DatagramReadResult& info,
+                                     const int recvFlags) const noexcept
+{
+    info = DatagramReadResult{};
+    if (buffer == nullptr || len == 0)
+        return {};
+
+    for (;;)
+    {
+#ifdef _WIN32
+        socklen_t srcLen = sizeof(info.src);
+        const int n = ::recvfrom(getSocketFd(), static_cast<char*>(buffer), static_cast<int>(len), recvFlags,
+                                 reinterpret_cast<sockaddr*>(&info.src), &srcLen);
+        if (n == SOCKET_ERROR)
+        {
+            const int error = GetSocketError();
+            if (error != WSAEMSGSIZE)
+                return IoResult::failure(error);
+            // The buffer holds the first `len` bytes; the rest of the datagram is discarded
+            info.bytes = len;
+            info.truncated = true;
+        }
+        else
+        {
+            info.bytes = static_cast<std::size_t>(n);
+            info.datagramSize = info.bytes;
+        }
+        info.srcLen = srcLen;
+        return {info.bytes};
+#else
+        iovec iov{buffer, len};
+        msghdr msg{};
+        msg.msg_name = &info.src;
+        msg.msg_namelen = sizeof(info.src);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+
+        int flags = recvFlags;
+#if defined(__linux__)
+        flags |= MSG_TRUNC; // recvmsg() then returns the full datagram size, even beyond `len`
+#endif
+        const ssize_t n = ::recvmsg(getSocketFd(), &msg, flags);
+        if (n < 0)
+        {
+            const int error = GetSocketError();
+            if (error == EINTR)
+                continue;
+            return IoResult::failure(error);
+        }
+
+        info.truncated = (msg.msg_flags & MSG_TRUNC) != 0;
+#if defined(__linux__)
+        info.datagramSize = static_cast<std::size_t>(n);
+        info.bytes = (std::min) (len, info.datagramSize);
+#else
+        info.bytes = static_cast<std::size_t>(n);
+        info.datagramSize = info.truncated ? 0 : info.bytes;
+#endif
+        info.srcLen = msg.msg_namelen;
+        return {info.bytes};
+#endif
+    }
+}
+
 DatagramReadResult DatagramSocket::readExact(void* buffer, const std::size_t exactLen,
                                              const ReadExactOptions& opts) const
 {
@@ -1456,10 +1831,10 @@ DatagramReadResult DatagramSocket::readv(const std::span<BufferView> buffers, co
     {
         const int err = GetSocketError();
         if (err == WSAEWOULDBLOCK)
-            throw SocketTimeoutException(err, SocketErrorMessage(err));
+            throw SocketTimeoutException(err);
         if (err == WSAETIMEDOUT)
             throw SocketTimeoutException();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     copied = static_cast<std::size_t>(got);
@@ -1533,13 +1908,13 @@ DatagramReadResult DatagramSocket::readv(const std::span<BufferView> buffers, co
         // NOLINTNEXTLINE
         if (err == EAGAIN || err == EWOULDBLOCK)
         {
-            throw SocketTimeoutException(err, SocketErrorMessage(err));
+            throw SocketTimeoutException(err);
         }
         if (err == ETIMEDOUT)
         {
             throw SocketTimeoutException();
         }
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 #endif
 
@@ -1663,7 +2038,7 @@ std::string DatagramSocket::getLocalIp(const bool convertIPv4Mapped)
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&tmp), &len) == SOCKET_ERROR)
     {
         const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     // Persist only if it looks truly bound (port != 0), avoiding caching placeholder endpoints.
@@ -1691,7 +2066,7 @@ Port DatagramSocket::getLocalPort()
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&tmp), &len) == SOCKET_ERROR)
     {
         const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     const auto port = portFromSockaddr(reinterpret_cast<const sockaddr*>(&tmp));
@@ -1730,7 +2105,7 @@ bool DatagramSocket::tryGetRemoteSockaddr(sockaddr_storage& out, socklen_t& outL
         if (::getpeername(getSocketFd(), reinterpret_cast<sockaddr*>(&out), &len) == SOCKET_ERROR)
         {
             const int err = GetSocketError();
-            throw SocketException(err, SocketErrorMessage(err));
+            throw SocketException(err);
         }
         outLen = len;
         return true;
@@ -1847,12 +2222,12 @@ DatagramReadResult DatagramSocket::peek(DatagramPacket& packet, const bool allow
 
         const int err = GetSocketError();
         if (err == WSAEWOULDBLOCK)
-            throw SocketTimeoutException(err, SocketErrorMessage(err));
+            throw SocketTimeoutException(err);
         if (err == WSAETIMEDOUT)
             throw SocketTimeoutException();
         if (err == WSAEINTR)
             continue; // rare
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 #else
     // ---- POSIX: recvmsg + MSG_PEEK (+ MSG_TRUNC on Linux for exact size) ----
@@ -1895,13 +2270,13 @@ DatagramReadResult DatagramSocket::peek(DatagramPacket& packet, const bool allow
         // NOLINTNEXTLINE
         if (err == EAGAIN || err == EWOULDBLOCK)
         {
-            throw SocketTimeoutException(err, SocketErrorMessage(err));
+            throw SocketTimeoutException(err);
         }
         if (err == ETIMEDOUT)
         {
             throw SocketTimeoutException();
         }
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 #endif
 
@@ -1927,56 +2302,14 @@ bool DatagramSocket::hasPendingData(const int timeoutMillis) const
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("DatagramSocket::hasPendingData(): socket is not open.");
 
-#if defined(_WIN32)
-    WSAPOLLFD pfd{};
-    pfd.fd = getSocketFd();
-    pfd.events = POLLIN | POLLRDNORM;
-
-    const int rc = ::WSAPoll(&pfd, 1, timeoutMillis);
-    if (rc == 0)
-        return false; // timed out
-    if (rc == SOCKET_ERROR)
-    {
-        const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
-    }
+    const short revents = internal::pollUntil(getSocketFd(), POLLIN, internal::Deadline::after(timeoutMillis));
 
     // Treat hard errors as exceptional; don’t silently report “readable”.
-    if (pfd.revents & (POLLERR | POLLNVAL))
-    {
-        // Use a generic error; WSAPoll doesn’t set errno. Keep the call site consistent.
-        throw SocketException(WSAENOTSOCK, SocketErrorMessage(WSAENOTSOCK));
-    }
-
-    return (pfd.revents & (POLLIN | POLLRDNORM)) != 0;
-#else
-    pollfd pfd{};
-    pfd.fd = getSocketFd();
-    pfd.events = POLLIN;
-
-    for (;;)
-    {
-        const int rc = ::poll(&pfd, 1, timeoutMillis);
-        if (rc > 0)
-        {
-            if (pfd.revents & (POLLERR | POLLNVAL))
-            {
-                // Translate to a sensible error code.
-                const int err = errno ? errno : EBADF;
-                throw SocketException(err, SocketErrorMessage(err));
-            }
-            // POLLHUP on UDP is rare; don’t treat as readable.
-            return (pfd.revents & POLLIN) != 0;
-        }
-        if (rc == 0)
-            return false; // timed out
+    if (revents & (POLLERR | POLLNVAL))
+        throw SocketException(pollErrorCode(getSocketFd(), revents));
 
-        const int err = errno;
-        if (err == EINTR)
-            continue; // retry on signal
-        throw SocketException(err, SocketErrorMessage(err));
-    }
-#endif
+    // POLLHUP on UDP is rare; don’t treat as readable.
+    return (revents & POLLIN) != 0;
 }
 
 std::optional<int> DatagramSocket::getMTU() const
@@ -2029,7 +2362,7 @@ std::optional<int> DatagramSocket::getMTU() const
     if (getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&localAddr), &addrLen) != 0)
     {
         const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     // Convert IP to interface name via getnameinfo + getifaddrs
@@ -2089,70 +2422,21 @@ void DatagramSocket::waitReady(const Direction dir, const int timeoutMillis) con
         throw SocketException(0, "DatagramSocket::waitReady(): socket is not open.");
     }
 
-    // Map Direction to platform poll events.
-#if defined(_WIN32)
-    WSAPOLLFD pfd{};
-    pfd.fd = getSocketFd();
-    pfd.events = 0;
-    if (dir == Direction::Read || dir == Direction::ReadWrite)
-        pfd.events |= POLLRDNORM;
-    if (dir == Direction::Write || dir == Direction::ReadWrite)
-        pfd.events |= POLLWRNORM;
-
-    const int timeout = (timeoutMillis < 0) ? -1 : timeoutMillis;
-    const int rc = ::WSAPoll(&pfd, 1, timeout);
-#else
-    pollfd pfd{};
-    pfd.fd = getSocketFd();
-    pfd.events = 0;
-    if (dir == Direction::Read || dir == Direction::ReadWrite)
-        pfd.events |= POLLIN;
-    if (dir == Direction::Write || dir == Direction::ReadWrite)
-        pfd.events |= POLLOUT;
-
-    const int timeout = (timeoutMillis < 0) ? -1 : timeoutMillis;
-    const int rc = ::poll(&pfd, 1, timeout);
-#endif
+    // Map Direction to poll events; POLLIN/POLLOUT are the POLLRDNORM/POLLWRNORM pair on Windows.
+    const short wantRead = (dir == Direction::Read || dir == Direction::ReadWrite) ? POLLIN : 0;
+    const short wantWrite = (dir == Direction::Write || dir == Direction::ReadWrite) ? POLLOUT : 0;
 
-    if (rc == 0)
+    const short re = internal::pollUntil(getSocketFd(), static_cast<short>(wantRead | wantWrite),
+                                         internal::Deadline::after(timeoutMillis));
+    if (re == 0)
     {
         // Timed out before desired readiness was signaled.
         throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "DatagramSocket::waitReady(): operation timed out.");
     }
 
-    if (rc < 0)
-    {
-        const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
-    }
-
-    // rc > 0: some event(s) occurred. Verify that the requested readiness is present,
-    // and handle exceptional conditions by surfacing SO_ERROR when available.
-#if defined(_WIN32)
-    const short wantRead = (dir == Direction::Read || dir == Direction::ReadWrite) ? POLLRDNORM : 0;
-    const short wantWrite = (dir == Direction::Write || dir == Direction::ReadWrite) ? POLLWRNORM : 0;
-    const short re = pfd.revents;
-#else
-    const short wantRead = (dir == Direction::Read || dir == Direction::ReadWrite) ? POLLIN : 0;
-    const short wantWrite = (dir == Direction::Write || dir == Direction::ReadWrite) ? POLLOUT : 0;
-    const short re = pfd.revents;
-#endif
-
     // If an error-ish condition is flagged, promote it to a SocketException with SO_ERROR.
     if (re & (POLLERR | POLLNVAL | POLLHUP))
-    {
-        int soerr = 0;
-#if defined(_WIN32)
-        int optlen = static_cast<int>(sizeof(soerr));
-        (void) ::getsockopt(getSocketFd(), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&soerr), &optlen);
-#else
-        auto optlen = static_cast<socklen_t>(sizeof(soerr));
-        (void) ::getsockopt(getSocketFd(), SOL_SOCKET, SO_ERROR, reinterpret_cast<void*>(&soerr), &optlen);
-#endif
-        if (soerr == 0)
-            soerr = EIO; // fall back if no specific error reported
-        throw SocketException(soerr, SocketErrorMessage(soerr));
-    }
+        throw SocketException(pollErrorCode(getSocketFd(), re));
 
     // If we didn’t get the event we actually asked for, treat it as not-ready.
     if ((wantRead && !(re & wantRead)) && (wantWrite && !(re & wantWrite)))
@@ -2167,12 +2451,47 @@ void DatagramSocket::waitReady(const Direction dir, const int timeoutMillis) con
 
 void DatagramSocket::sendUnconnectedTo(const std::string_view host, const Port port, const void* data,
                                        const std::size_t len)
+{
+    const std::string_view payload(static_cast<const char*>(data), len);
+    sendUnconnectedTo(host, port, std::span(&payload, 1));
+}
+
+void DatagramSocket::sendUnconnectedTo(const std::string_view host, const Port port,
+                                       const std::span<const std::string_view> buffers)
 {
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException(0, "DatagramSocket::sendUnconnectedTo(): socket is not open.");
+
+    std::size_t len = 0;
+    for (const auto& b : buffers)
+        len += b.size();
     if (len == 0)
         return;
 
+    const auto familyCap = [](const int family) { return family == AF_INET6 ? MaxUdpPayloadIPv6 : MaxUdpPayloadIPv4; };
+
+    // Numeric literals: no resolver, no cache
+    if (const auto numeric = Endpoint::parse(host, port))
+    {
+        if (len > familyCap(numeric->getFamily()))
+            throw SocketException(0, len <= MaxUdpPayloadIPv6
+                                         ? "Datagram payload exceeds IPv4 limit and no IPv6 candidates were available."
+                                         : "Datagram payload exceeds the theoretical IPv6 UDP limit.");
+        sendToEndpoint(*numeric, buffers);
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    for (const CachedDestination& entry : _destinationCache)
+    {
+        if (entry.port == port && entry.expiry > now && entry.host == host &&
+            len <= familyCap(entry.endpoint.getFamily()))
+        {
+            sendToEndpoint(entry.endpoint, buffers);
+            return;
+        }
+    }
+
     // Resolve destination(s): AF_UNSPEC + UDP
     const auto addrInfo = internal::resolveAddress(host, port, AF_UNSPEC, SOCK_DGRAM, IPPROTO_UDP);
     const addrinfo* head = addrInfo.get();
@@ -2183,30 +2502,14 @@ void DatagramSocket::sendUnconnectedTo(const std::string_view host, const Port p
     for (const addrinfo* ai = head; ai; ai = ai->ai_next)
     {
         // Skip families that cannot possibly carry this datagram.
-        if (const std::size_t familyCap = (ai->ai_family == AF_INET6) ? MaxUdpPayloadIPv6 : MaxUdpPayloadIPv4;
-            len > familyCap)
+        if (len > familyCap(ai->ai_family))
             continue;
 
         try
         {
-            internal::sendExactTo(
-                getSocketFd(), data, len, ai->ai_addr, static_cast<socklen_t>(ai->ai_addrlen),
-                [](void* p)
-                {
-                    if (auto* self = static_cast<DatagramSocket*>(p); !self->_isBound)
-                    {
-                        self->cacheLocalEndpoint(); // sets _localAddr/_localAddrLen/_haveLocalAddr
-                        self->_isBound = true;
-                    }
-                },
-                this);
-
-            // Cache last destination (without marking the socket "connected").
-            if (!_isConnected)
-            {
-                rememberRemote(*reinterpret_cast<const sockaddr_storage*>(ai->ai_addr),
-                               static_cast<socklen_t>(ai->ai_addrlen));
-            }
+            const Endpoint candidate(ai->ai_addr, static_cast<socklen_t>(ai->ai_addrlen));
+            sendToEndpoint(candidate, buffers);
+            cacheDestination(host, port, candidate, now);
             return; // success
         }
         catch (const SocketException&)
@@ -2227,5 +2530,62 @@ void DatagramSocket::sendUnconnectedTo(const std::string_view host, const Port p
     }
 
     // We attempted at least one send and failed → surface the last OS error.
-    throw SocketException(lastErr, SocketErrorMessage(lastErr));
+    throw SocketException(lastErr);
+}
+
+void DatagramSocket::sendToEndpoint(const Endpoint& destination, const void* data, const std::size_t len)
+{
+    const std::string_view payload(static_cast<const char*>(data), len);
+    sendToEndpoint(destination, std::span(&payload, 1));
+}
+
+void DatagramSocket::sendToEndpoint(const Endpoint& destination, const std::span<const std::string_view> buffers)
+{
+    internal::sendExactv(getSocketFd(), buffers, destination.data(), destination.size());
+
+    if (!_isBound)
+    {
+        cacheLocalEndpoint(); // sets _localAddr/_localAddrLen/_haveLocalAddr
+        _isBound = true;
+    }
+
+    // Cache last destination (without marking the socket "connected").
+    if (!_isConnected)
+        rememberRemote(destination.storage(), destination.size());
+}
+
+void DatagramSocket::cacheDestination(const std::string_view host, const Port port, const Endpoint& endpoint,
+                                      const std::chrono::steady_clock::time_point now)
+{
+    if (_destinationCacheCapacity == 0)
+        return;
+
+    CachedDestination entry{std::string(host), port, endpoint, now + _destinationCacheTtl};
+
+    // Reuse the slot of this destination or of an expired one; when full, evict the entry closest to expiry
+    auto slot = _destinationCache.end();
+    for (auto it = _destinationCache.begin(); it != _destinationCache.end(); ++it)
+    {
+        if ((it->port == port && it->host == host) || it->expiry <= now)
+        {
+            slot = it;
+            break;
+        }
+        if (_destinationCache.size() >= _destinationCacheCapacity &&
+            (slot == _destinationCache.end() || it->expiry < slot->expiry))
+            slot = it;
+    }
+
+    if (slot != _destinationCache.end())
+        *slot = std::move(entry);
+    else
+        _destinationCache.push_back(std::move(entry));
+}
+
+void DatagramSocket::setDestinationCache(const std::size_t capacity, const std::chrono::milliseconds ttl)
+{
+    _destinationCacheCapacity = capacity;
+    _destinationCacheTtl = ttl;
+    if (_destinationCache.size() > capacity)
+        _destinationCache.resize(capacity);
 }
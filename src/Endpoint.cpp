@@ -0,0 +1,52 @@
+#include "jsocketpp/Endpoint.hpp"
+
+#include <cstring>
+
+using namespace jsocketpp;
+
+Endpoint::Endpoint(const sockaddr* addr, const socklen_t len)
+{
+    if (addr == nullptr || len <= 0 || static_cast<std::size_t>(len) > sizeof(_addr))
+        throw SocketException("Endpoint: invalid socket address.");
+
+    std::memcpy(&_addr, addr, static_cast<std::size_t>(len));
+    _len = len;
+}
+
+std::optional<Endpoint> Endpoint::parse(const std::string_view host, const Port port) noexcept
+{
+    Endpoint endpoint;
+    if (!internal::parseNumericAddress(host, port, endpoint._addr, endpoint._len))
+        return std::nullopt;
+    return endpoint;
+}
+
+Endpoint Endpoint::resolve(const std::string_view host, const Port port, const int family)
+{
+    if (auto numeric = parse(host, port); numeric && (family == AF_UNSPEC || numeric->getFamily() == family))
+        return *numeric;
+
+    const auto addrInfo = internal::resolveAddress(host, port, family, SOCK_DGRAM, IPPROTO_UDP);
+    return {addrInfo->ai_addr, static_cast<socklen_t>(addrInfo->ai_addrlen)};
+}
+
+std::string Endpoint::getIp(const bool convertIPv4Mapped) const
+{
+    if (!isValid())
+        throw SocketException("Endpoint::getIp(): endpoint is empty.");
+    return ipFromSockaddr(data(), convertIPv4Mapped);
+}
+
+Port Endpoint::getPort() const
+{
+    if (!isValid())
+        throw SocketException("Endpoint::getPort(): endpoint is empty.");
+    return portFromSockaddr(data());
+}
+
+std::string Endpoint::toString() const
+{
+    const std::string ip = getIp(false);
+    const std::string port = std::to_string(getPort());
+    return getFamily() == AF_INET6 ? "[" + ip + "]:" + port : ip + ":" + port;
+}
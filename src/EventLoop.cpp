@@ -0,0 +1,461 @@
+#include "jsocketpp/EventLoop.hpp"
+
+#include "jsocketpp/internal/IoVecCursor.hpp"
+
+#include <algorithm>
+#include <optional>
+
+using namespace jsocketpp;
+
+namespace
+{
+
+using Clock = EventLoop::Clock;
+
+void ensureNonBlocking(SocketOptions& socket)
+{
+    if (!socket.getNonBlocking())
+        socket.setNonBlocking(true);
+}
+
+std::optional<Clock::time_point> deadlineFor(const int timeoutMillis)
+{
+    if (timeoutMillis < 0)
+        return std::nullopt;
+    return Clock::now() + std::chrono::milliseconds(timeoutMillis);
+}
+
+// Whole-operation deadline to per-wait timeout, rounded up so that a wait never ends early
+int remainingMillis(const std::optional<Clock::time_point>& deadline)
+{
+    if (!deadline)
+        return -1;
+    const auto left = *deadline - Clock::now();
+    if (left <= Clock::duration::zero())
+        return 0;
+    return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(left).count());
+}
+
+} // namespace
+
+EventLoop::EventLoop(ErrorHandler onError) : _onError(std::move(onError))
+{
+}
+
+EventLoop::~EventLoop() noexcept
+{
+    // Destroying a suspended frame runs its awaiters' destructors, which withdraw them from the maps
+    for (void* address : std::exchange(_tasks, {}))
+        std::coroutine_handle<>::from_address(address).destroy();
+}
+
+void EventLoop::spawn(Task<void> task)
+{
+    const auto handle = task.release();
+    if (!handle)
+        throw SocketException("EventLoop::spawn(): task is empty.");
+
+    handle.promise().onDetachedDone = &EventLoop::onTaskDone;
+    handle.promise().detachedContext = this;
+    _tasks.insert(handle.address());
+    _ready.push_back(handle);
+}
+
+void EventLoop::run()
+{
+    // The flag is cleared only by the run() it ends, so a stop() issued before run() is not lost
+    while (!_tasks.empty())
+    {
+        if (_stopped.exchange(false, std::memory_order_acq_rel))
+            return;
+        runOnce(-1);
+    }
+}
+
+void EventLoop::stop() noexcept
+{
+    _stopped.store(true, std::memory_order_release);
+    try
+    {
+        _selector.wakeup();
+    }
+    catch (...)
+    {
+        // run() re-checks the flag after every iteration anyway
+    }
+}
+
+std::size_t EventLoop::runOnce(const int timeoutMillis)
+{
+    std::size_t resumed = 0;
+
+    for (const auto handle : std::exchange(_ready, {}))
+    {
+        handle.resume();
+        ++resumed;
+    }
+    reapFinished();
+
+    _selector.select(resumed > 0 ? 0 : nextTimeout(timeoutMillis));
+
+    for (const SelectionKey& key : _selector.selectedKeys())
+    {
+        // Look the descriptor up again each time: a resumed coroutine may have started or withdrawn waits
+        auto it = _waiters.find(key.fd);
+        const bool failed = key.error || key.hangup;
+        if (it != _waiters.end() && it->second.reader != nullptr && (key.isReadable() || key.isAcceptable() || failed))
+        {
+            resume(*it->second.reader, false);
+            ++resumed;
+        }
+        it = _waiters.find(key.fd);
+        if (it != _waiters.end() && it->second.writer != nullptr && (key.isWritable() || failed))
+        {
+            resume(*it->second.writer, false);
+            ++resumed;
+        }
+    }
+
+    resumed += _timers.advance(Clock::now());
+
+    reapFinished();
+    if (_pendingError)
+        std::rethrow_exception(std::exchange(_pendingError, nullptr));
+    return resumed;
+}
+
+int EventLoop::nextTimeout(const int timeoutMillis) const
+{
+    const auto expiry = _timers.nextExpiry();
+    if (!expiry)
+        return timeoutMillis;
+
+    const auto left = *expiry - Clock::now();
+    const int timerMillis =
+        left <= Clock::duration::zero()
+            ? 0
+            : static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(left).count());
+    return timeoutMillis < 0 ? timerMillis : (std::min) (timeoutMillis, timerMillis);
+}
+
+EventLoop::ReadinessAwaiter EventLoop::readable(const SocketOptions& socket, const int timeoutMillis)
+{
+    return {*this, socket.getSocketFd(), false, timeoutMillis};
+}
+
+EventLoop::ReadinessAwaiter EventLoop::writable(const SocketOptions& socket, const int timeoutMillis)
+{
+    return {*this, socket.getSocketFd(), true, timeoutMillis};
+}
+
+EventLoop::ReadinessAwaiter EventLoop::sleepFor(const std::chrono::milliseconds duration)
+{
+    return {*this, INVALID_SOCKET, false, duration.count() < 0 ? 0 : static_cast<int>(duration.count())};
+}
+
+void EventLoop::onTaskDone(void* context, const std::coroutine_handle<> handle) noexcept
+{
+    // Runs inside final_suspend; an allocation failure here terminates, as any exception from it would
+    static_cast<EventLoop*>(context)->_finished.push_back(handle);
+}
+
+void EventLoop::reapFinished()
+{
+    for (const auto handle : std::exchange(_finished, {}))
+    {
+        auto typed = Task<void>::Handle::from_address(handle.address());
+        std::exception_ptr error = typed.promise().error;
+        _tasks.erase(handle.address());
+        typed.destroy();
+
+        if (!error)
+            continue;
+        if (_onError)
+            _onError(std::move(error));
+        else if (!_pendingError)
+            _pendingError = std::move(error);
+    }
+}
+
+void EventLoop::addWaiter(ReadinessAwaiter& awaiter)
+{
+    if (awaiter._fd != INVALID_SOCKET)
+    {
+        Waiters& waiters = _waiters[awaiter._fd];
+        ReadinessAwaiter*& slot = awaiter._forWrite ? waiters.writer : waiters.reader;
+        if (slot != nullptr)
+            throw SocketException(awaiter._forWrite
+                                      ? "EventLoop: another coroutine is already waiting to write on this socket."
+                                      : "EventLoop: another coroutine is already waiting to read on this socket.");
+        slot = &awaiter;
+        try
+        {
+            updateInterest(awaiter._fd);
+        }
+        catch (...)
+        {
+            slot = nullptr;
+            updateInterest(awaiter._fd);
+            throw;
+        }
+    }
+
+    if (awaiter._timeoutMillis >= 0)
+    {
+        if (!awaiter._timer.callback)
+            awaiter._timer.callback = [this, &awaiter] { resume(awaiter, true); };
+        _timers.scheduleAfter(awaiter._timer, std::chrono::milliseconds(awaiter._timeoutMillis));
+    }
+    awaiter._waiting = true;
+}
+
+void EventLoop::removeWaiter(ReadinessAwaiter& awaiter) noexcept
+{
+    awaiter._waiting = false;
+    awaiter._timer.cancel();
+
+    if (awaiter._fd == INVALID_SOCKET)
+        return;
+
+    if (const auto it = _waiters.find(awaiter._fd); it != _waiters.end())
+    {
+        (awaiter._forWrite ? it->second.writer : it->second.reader) = nullptr;
+        try
+        {
+            updateInterest(awaiter._fd);
+        }
+        catch (...)
+        {
+            // The descriptor was closed or is gone; the kernel has already dropped it from the selector
+        }
+    }
+}
+
+void EventLoop::updateInterest(const SOCKET fd)
+{
+    const auto it = _waiters.find(fd);
+    Interest interest = Interest::None;
+    if (it != _waiters.end())
+    {
+        if (it->second.reader != nullptr)
+            interest = interest | Interest::Read;
+        if (it->second.writer != nullptr)
+            interest = interest | Interest::Write;
+    }
+
+    if (interest == Interest::None)
+    {
+        if (it != _waiters.end())
+            _waiters.erase(it);
+        _selector.unregisterSocket(fd);
+    }
+    else
+    {
+        _selector.registerSocket(fd, interest);
+    }
+}
+
+void EventLoop::resume(ReadinessAwaiter& awaiter, const bool timedOut)
+{
+    removeWaiter(awaiter);
+    awaiter._timedOut = timedOut;
+    std::exchange(awaiter._handle, {}).resume();
+}
+
+EventLoop::ReadinessAwaiter::~ReadinessAwaiter()
+{
+    if (_waiting)
+        _loop->removeWaiter(*this);
+}
+
+void EventLoop::ReadinessAwaiter::await_suspend(const std::coroutine_handle<> handle)
+{
+    _handle = handle;
+    _loop->addWaiter(*this);
+}
+
+void EventLoop::ReadinessAwaiter::await_resume() const
+{
+    if (_timedOut && _fd != INVALID_SOCKET)
+        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "EventLoop: operation timed out");
+}
+
+// GCC reports these for the switch and null pointers it generates when lowering the coroutines below
+DIAGNOSTIC_PUSH()
+DIAGNOSTIC_IGNORE("-Wswitch-default")
+DIAGNOSTIC_IGNORE("-Wzero-as-null-pointer-constant")
+
+Task<std::size_t> jsocketpp::asyncReadInto(EventLoop& loop, Socket& socket, void* buffer, const std::size_t len,
+                                           const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (true)
+    {
+        if (const IoResult result = socket.tryReadInto(buffer, len); !result.wouldBlock())
+            co_return result.valueOrThrow();
+        co_await loop.readable(socket, remainingMillis(deadline));
+    }
+}
+
+Task<std::string> jsocketpp::asyncReadExact(EventLoop& loop, Socket& socket, const std::size_t n,
+                                            const int timeoutMillis)
+{
+    std::string result(n, '\0');
+    std::size_t got = 0;
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (got < n)
+    {
+        const std::size_t chunk = co_await asyncReadInto(loop, socket, result.data() + got, n - got,
+                                                         deadline ? (std::max) (remainingMillis(deadline), 0) : -1);
+        if (chunk == 0)
+            throw SocketException("Connection closed before full read completed.");
+        got += chunk;
+    }
+    co_return result;
+}
+
+Task<std::string> jsocketpp::asyncReadUntil(EventLoop& loop, Socket& socket, const std::string_view delimiter,
+                                            const std::size_t maxLen, const bool includeDelimiter,
+                                            const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (true)
+    {
+        // readUntil() leaves everything it received in the internal buffer when recv() would block
+        try
+        {
+            co_return socket.readUntil(delimiter, maxLen, includeDelimiter);
+        }
+        catch (const SocketException& e)
+        {
+            if (!internal::isWouldBlock(e.getErrorCode()))
+                throw;
+        }
+        co_await loop.readable(socket, remainingMillis(deadline));
+    }
+}
+
+Task<std::size_t> jsocketpp::asyncWriteAll(EventLoop& loop, Socket& socket, const std::string_view message,
+                                           const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    std::size_t sent = 0;
+    while (sent < message.size())
+    {
+        if (const IoResult result = socket.tryWrite(message.substr(sent)); !result.wouldBlock())
+        {
+            sent += result.valueOrThrow();
+            continue;
+        }
+        co_await loop.writable(socket, remainingMillis(deadline));
+    }
+    co_return sent;
+}
+
+Task<std::size_t> jsocketpp::asyncWritevAll(EventLoop& loop, Socket& socket,
+                                            const std::span<const std::string_view> buffers, const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    // Lives in the coroutine frame, so partial writes are tracked across suspensions without copying `buffers`
+    internal::IoVecCursor cursor(buffers);
+    std::size_t total = 0;
+    while (!cursor.done())
+    {
+        try
+        {
+            const std::size_t n = internal::sendIoVecs(socket.getSocketFd(), cursor.data(), cursor.size());
+            total += n;
+            cursor.advance(n);
+            continue;
+        }
+        catch (const SocketException& e)
+        {
+            if (!internal::isWouldBlock(e.getErrorCode()))
+                throw;
+        }
+        co_await loop.writable(socket, remainingMillis(deadline));
+    }
+    co_return total;
+}
+
+Task<Socket> jsocketpp::asyncAccept(EventLoop& loop, ServerSocket& server, const int timeoutMillis)
+{
+    ensureNonBlocking(server);
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (true)
+    {
+        std::optional<Socket> client;
+        try
+        {
+            client = server.acceptNonBlocking(std::nullopt, std::nullopt, std::nullopt, -1, -1, true, false, true);
+        }
+        catch (const SocketException& e)
+        {
+            if (!internal::isTransientAcceptError(e.getErrorCode()))
+                throw;
+            continue;
+        }
+        if (client)
+            co_return std::move(*client);
+        co_await loop.readable(server, remainingMillis(deadline));
+    }
+}
+
+Task<void> jsocketpp::asyncConnect(EventLoop& loop, Socket& socket, const int timeoutMillis)
+{
+    if (socket.beginConnect())
+        co_return;
+    co_await loop.writable(socket, timeoutMillis);
+    socket.finishConnect();
+}
+
+Task<DatagramReadResult> jsocketpp::asyncRead(EventLoop& loop, DatagramSocket& socket, const std::span<char> buffer,
+                                              const DatagramReadOptions options, const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (true)
+    {
+        try
+        {
+            co_return socket.readInto(buffer, options);
+        }
+        catch (const SocketTimeoutException&)
+        {
+            // DatagramSocket reports EAGAIN on a non-blocking socket as a timeout
+        }
+        catch (const SocketException& e)
+        {
+            if (!internal::isWouldBlock(e.getErrorCode()))
+                throw;
+        }
+        co_await loop.readable(socket, remainingMillis(deadline));
+    }
+}
+
+Task<void> jsocketpp::asyncWriteTo(EventLoop& loop, DatagramSocket& socket, const std::string_view host,
+                                   const Port port, const std::string_view message, const int timeoutMillis)
+{
+    ensureNonBlocking(socket);
+    const auto deadline = deadlineFor(timeoutMillis);
+    while (true)
+    {
+        try
+        {
+            socket.writeTo(host, port, message);
+            co_return;
+        }
+        catch (const SocketException& e)
+        {
+            if (!internal::isWouldBlock(e.getErrorCode()))
+                throw;
+        }
+        co_await loop.writable(socket, remainingMillis(deadline));
+    }
+}
+
+DIAGNOSTIC_POP()
@@ -0,0 +1,1281 @@
+#include "jsocketpp/IoService.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+// Not yet in every distribution's kernel headers; the bit has been stable since Linux 6.3
+#ifndef IORING_FEAT_REG_REG_RING
+#define IORING_FEAT_REG_REG_RING (1U << 13)
+#endif
+#endif
+
+using namespace jsocketpp;
+
+namespace
+{
+
+enum class OpKind : std::uint8_t
+{
+    Accept,
+    Receive,
+    ReceiveFrom,
+    Send
+};
+
+#ifdef _WIN32
+constexpr int SendFlags = 0;
+#else
+constexpr int SendFlags = MSG_NOSIGNAL;
+#endif
+
+// Upper bound on system calls per readiness notification, so one busy socket cannot starve the others
+constexpr int ReactorBurst = 16;
+
+std::exception_ptr makeError(const int error)
+{
+    return std::make_exception_ptr(SocketException(error));
+}
+
+bool isPowerOfTwo(const std::size_t n) noexcept
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+} // namespace
+
+struct IoService::Operation
+{
+    OperationId id = 0;                    ///< Key in `_operations`.
+    OpKind kind = OpKind::Accept;          ///< What the operation does.
+    SOCKET fd = INVALID_SOCKET;            ///< Target descriptor.
+    bool cancelled = false;                ///< No more callbacks; finish once the kernel lets go.
+    bool stream = true;                    ///< Send: resume short writes (stream) or not (datagram).
+    unsigned inFlight = 0;                 ///< io_uring requests not yet completed.
+    const ServerSocket* server = nullptr;  ///< Accept: listener whose defaults configure new sockets.
+    AcceptHandler onAccept{};              ///< Accept callback.
+    ReceiveHandler onReceive{};            ///< Receive callback.
+    DatagramHandler onDatagram{};          ///< ReceiveFrom callback.
+    SendHandler onSend{};                  ///< Send callback.
+    std::string preload{};                 ///< Receive: bytes taken from the socket's internal buffer.
+    std::vector<std::string> buffers{};    ///< Send: payloads.
+    std::size_t index = 0;                 ///< Send: first buffer of the current chain.
+    std::size_t offset = 0;                ///< Send: bytes of `buffers[index]` already written.
+    std::size_t chain = 0;                 ///< Send: buffers in the current io_uring chain.
+    std::size_t resumeIndex = 0;           ///< Send: where to restart after a short write.
+    std::size_t resumeOffset = 0;          ///< Send: offset within `buffers[resumeIndex]`.
+    bool shortWrite = false;               ///< Send: the current chain was cut by a short write.
+    std::size_t total = 0;                 ///< Send: bytes written so far.
+    int error = 0;                         ///< Send: first error reported by the current chain.
+#if defined(JSOCKETPP_HAS_IO_URING)
+    msghdr msg{}; ///< ReceiveFrom: layout template for multishot `RECVMSG`.
+#endif
+};
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+
+namespace
+{
+
+// liburing is deliberately not required: the handful of ring operations used here map to three system calls
+
+int sysSetup(const unsigned entries, io_uring_params* params) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sysEnter(const int fd, const unsigned toSubmit, const unsigned minComplete, const unsigned flags,
+             const void* arg, const std::size_t argSize) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+int sysRegister(const int fd, const unsigned opcode, const void* arg, const unsigned nrArgs) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+[[noreturn]] void throwUringError(const char* what, const int error)
+{
+    throw SocketException(error, std::string("IoService: ") + what + ": " + SocketErrorMessage(error));
+}
+
+// user_data layout: operation id in the upper 48 bits, position within a send chain in the lower 16
+constexpr unsigned SeqBits = 16;
+constexpr std::size_t MaxChain = (1U << SeqBits) - 1;
+
+constexpr std::uint64_t tag(const std::uint64_t id, const std::size_t seq) noexcept
+{
+    return (id << SeqBits) | static_cast<std::uint64_t>(seq);
+}
+
+constexpr std::uint16_t BufferGroup = 0;
+
+} // namespace
+
+struct IoService::Uring
+{
+    int fd = -1;
+
+    void* ringMap = MAP_FAILED;
+    std::size_t ringMapSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    std::size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqFlags = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned sqLocalTail = 0;
+    unsigned pending = 0;
+
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    io_uring_buf_ring* bufRing = nullptr;
+    std::size_t bufRingSize = 0;
+    unsigned bufCount = 0;
+    std::size_t bufSize = 0;
+    std::vector<char> bufMemory{};
+
+    std::vector<unsigned> freeSlots{};
+    std::unordered_map<SOCKET, unsigned> slots{};
+
+    explicit Uring(const IoServiceOptions& options);
+    ~Uring() noexcept { release(); }
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    void release() noexcept;
+    io_uring_sqe* next();
+    void reserve(unsigned count);
+    void enter(unsigned minComplete, int timeoutMillis);
+    void prepare(io_uring_sqe* sqe, std::uint8_t opcode, SOCKET target) const noexcept;
+    [[nodiscard]] char* buffer(const std::uint16_t bid) noexcept { return bufMemory.data() + bid * bufSize; }
+
+    // Older UAPI headers declare `bufs` through __DECLARE_FLEX_ARRAY, whose empty struct has size 1 in C++ and
+    // shifts the array by 8 bytes. The kernel layout has entry 0 at offset 0 (its last field aliases `tail`).
+    [[nodiscard]] io_uring_buf& entry(const unsigned index) const noexcept
+    {
+        return reinterpret_cast<io_uring_buf*>(bufRing)[index & (bufCount - 1)];
+    }
+    void recycle(std::uint16_t bid) noexcept;
+};
+
+IoService::Uring::Uring(const IoServiceOptions& options)
+{
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+    params.cq_entries = std::max(options.queueDepth * 4, options.bufferCount * 2);
+    fd = sysSetup(options.queueDepth, &params);
+    if (fd < 0 && errno == EINVAL)
+    {
+        // SUBMIT_ALL (5.18) and COOP_TASKRUN (5.19) are optimizations; retry without them
+        params = {};
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = std::max(options.queueDepth * 4, options.bufferCount * 2);
+        fd = sysSetup(options.queueDepth, &params);
+    }
+    if (fd < 0)
+        throwUringError("io_uring_setup", errno);
+
+    try
+    {
+        constexpr unsigned required =
+            IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG | IORING_FEAT_REG_REG_RING;
+        if ((params.features & required) != required)
+            throw SocketException(ENOSYS, "IoService: io_uring backend requires Linux 6.3 or newer.");
+
+        const std::size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        const std::size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        ringMapSize = std::max(sqSize, cqSize);
+        ringMap = ::mmap(nullptr, ringMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                         IORING_OFF_SQ_RING);
+        if (ringMap == MAP_FAILED)
+            throwUringError("mmap(SQ/CQ ring)", errno);
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqeMap =
+            ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqeMap == MAP_FAILED)
+            throwUringError("mmap(SQEs)", errno);
+        sqes = static_cast<io_uring_sqe*>(sqeMap);
+
+        auto* base = static_cast<char*>(ringMap);
+        sqHead = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+        sqFlags = reinterpret_cast<unsigned*>(base + params.sq_off.flags);
+        sqMask = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+        sqEntries = params.sq_entries;
+        cqHead = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+        // Identity mapping: SQE i always sits in array slot i
+        auto* array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+        for (unsigned i = 0; i < sqEntries; ++i)
+            array[i] = i;
+        sqLocalTail = *sqTail;
+
+        // Provided-buffer ring: receives pick a buffer only when data arrives, so idle sockets pin no memory
+        bufCount = options.bufferCount;
+        bufSize = options.bufferSize;
+        bufMemory.resize(bufCount * bufSize);
+        bufRingSize = bufCount * sizeof(io_uring_buf);
+        void* ringMem = ::mmap(nullptr, bufRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ringMem == MAP_FAILED)
+            throwUringError("mmap(buffer ring)", errno);
+        bufRing = static_cast<io_uring_buf_ring*>(ringMem);
+
+        io_uring_buf_reg reg{};
+        reg.ring_addr = reinterpret_cast<std::uint64_t>(bufRing);
+        reg.ring_entries = bufCount;
+        reg.bgid = BufferGroup;
+        if (sysRegister(fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+            throwUringError("IORING_REGISTER_PBUF_RING", errno);
+
+        for (unsigned i = 0; i < bufCount; ++i)
+        {
+            io_uring_buf& b = entry(i);
+            b.addr = reinterpret_cast<std::uint64_t>(buffer(static_cast<std::uint16_t>(i)));
+            b.len = static_cast<std::uint32_t>(bufSize);
+            b.bid = static_cast<std::uint16_t>(i);
+        }
+        __atomic_store_n(&bufRing->tail, static_cast<std::uint16_t>(bufCount), __ATOMIC_RELEASE);
+
+        if (options.fixedFileSlots > 0)
+        {
+            io_uring_rsrc_register files{};
+            files.nr = options.fixedFileSlots;
+            files.flags = IORING_RSRC_REGISTER_SPARSE;
+            if (sysRegister(fd, IORING_REGISTER_FILES2, &files, sizeof(files)) < 0)
+                throwUringError("IORING_REGISTER_FILES2", errno);
+
+            freeSlots.reserve(options.fixedFileSlots);
+            for (unsigned i = options.fixedFileSlots; i-- > 0;)
+                freeSlots.push_back(i);
+        }
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+void IoService::Uring::release() noexcept
+{
+    // Closing the ring also drops the registered buffer ring and file table
+    if (fd >= 0)
+        ::close(fd);
+    fd = -1;
+    if (bufRing != nullptr)
+        ::munmap(bufRing, bufRingSize);
+    bufRing = nullptr;
+    if (sqes != nullptr)
+        ::munmap(sqes, sqesSize);
+    sqes = nullptr;
+    if (ringMap != MAP_FAILED)
+        ::munmap(ringMap, ringMapSize);
+    ringMap = MAP_FAILED;
+}
+
+io_uring_sqe* IoService::Uring::next()
+{
+    reserve(1);
+    io_uring_sqe* sqe = &sqes[sqLocalTail & sqMask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ++sqLocalTail;
+    ++pending;
+    return sqe;
+}
+
+void IoService::Uring::reserve(const unsigned count)
+{
+    if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) + count <= sqEntries)
+        return;
+
+    enter(0, 0);
+    if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) + count > sqEntries)
+        throw SocketException(EBUSY, "IoService: submission queue is full.");
+}
+
+void IoService::Uring::enter(const unsigned minComplete, const int timeoutMillis)
+{
+    __atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+
+    unsigned flags = 0;
+    __kernel_timespec ts{};
+    io_uring_getevents_arg arg{};
+    const void* argPtr = nullptr;
+    std::size_t argSize = 0;
+
+    // Completions that did not fit the CQ wait in an overflow list until the next GETEVENTS
+    if (minComplete > 0 || (__atomic_load_n(sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW) != 0)
+        flags |= IORING_ENTER_GETEVENTS;
+    if (minComplete > 0 && timeoutMillis >= 0)
+    {
+        ts.tv_sec = timeoutMillis / 1000;
+        ts.tv_nsec = static_cast<long long>(timeoutMillis % 1000) * 1000000;
+        arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+        flags |= IORING_ENTER_EXT_ARG;
+        argPtr = &arg;
+        argSize = sizeof(arg);
+    }
+
+    const int rc = sysEnter(fd, pending, minComplete, flags, argPtr, argSize);
+    if (rc >= 0)
+    {
+        pending -= std::min(pending, static_cast<unsigned>(rc));
+        return;
+    }
+
+    // Timeout, signal, or CQ temporarily full: the caller reaps whatever is there
+    if (errno == ETIME || errno == EINTR || errno == EAGAIN || errno == EBUSY)
+        return;
+    throwUringError("io_uring_enter", errno);
+}
+
+void IoService::Uring::prepare(io_uring_sqe* sqe, const std::uint8_t opcode, const SOCKET target) const noexcept
+{
+    sqe->opcode = opcode;
+    if (const auto it = slots.find(target); it != slots.end())
+    {
+        sqe->fd = static_cast<std::int32_t>(it->second);
+        sqe->flags |= IOSQE_FIXED_FILE;
+    }
+    else
+    {
+        sqe->fd = target;
+    }
+}
+
+void IoService::Uring::recycle(const std::uint16_t bid) noexcept
+{
+    // Single producer: only this thread writes the tail
+    const std::uint16_t tail = bufRing->tail;
+    io_uring_buf& b = entry(tail);
+    b.addr = reinterpret_cast<std::uint64_t>(buffer(bid));
+    b.len = static_cast<std::uint32_t>(bufSize);
+    b.bid = bid;
+    __atomic_store_n(&bufRing->tail, static_cast<std::uint16_t>(tail + 1), __ATOMIC_RELEASE);
+}
+
+#else
+
+struct IoService::Uring
+{
+};
+
+#endif
+
+IoService::IoService(IoServiceOptions options) : _options(options), _operations(), _retired()
+{
+    if (_options.queueDepth == 0 || _options.queueDepth > 32768)
+        throw SocketException("IoService: queueDepth must be between 1 and 32768.");
+    _options.queueDepth = std::bit_ceil(_options.queueDepth);
+    if (!isPowerOfTwo(_options.bufferCount) || _options.bufferCount > 32768)
+        throw SocketException("IoService: bufferCount must be a power of two no greater than 32768.");
+    if (_options.bufferSize == 0 || _options.bufferSize > 0x7fffffff)
+        throw SocketException("IoService: bufferSize must be between 1 and 2^31 - 1.");
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+    if (!_options.forceReactor)
+    {
+        try
+        {
+            _uring = std::make_unique<Uring>(_options);
+        }
+        catch (const SocketException&)
+        {
+            // Old kernel, io_uring disabled by sysctl or seccomp, or RLIMIT_MEMLOCK: serve the API with the reactor
+            _uring.reset();
+        }
+    }
+#endif
+
+    if (!_uring)
+    {
+        _selector = std::make_unique<Selector>();
+        _scratch.resize(_options.bufferSize);
+    }
+}
+
+IoService::~IoService() noexcept
+{
+#if defined(JSOCKETPP_HAS_IO_URING)
+    if (_uring)
+        uringShutdown();
+#endif
+}
+
+IoService::OperationId IoService::addOperation(std::unique_ptr<Operation> op)
+{
+    const OperationId id = _nextId++;
+    op->id = id;
+    Operation& ref = *op;
+    _operations.emplace(id, std::move(op));
+
+    auto& fdOps = _fdOperations[ref.fd];
+    bool start = true;
+    if (ref.kind == OpKind::Send)
+    {
+        fdOps.writers.push_back(id);
+        start = fdOps.writers.size() == 1;
+    }
+    else
+    {
+        fdOps.reader = id;
+    }
+
+    try
+    {
+        if (start && !(ref.kind == OpKind::Send && ref.buffers.empty()))
+        {
+#if defined(JSOCKETPP_HAS_IO_URING)
+            if (_uring)
+                ref.kind == OpKind::Send ? uringArmSend(ref) : uringArm(ref);
+            else
+#endif
+                reactorUpdate(ref.fd);
+        }
+    }
+    catch (...)
+    {
+        ref.cancelled = true;
+        ref.inFlight = 0;
+        finish(id);
+        throw;
+    }
+
+    if (start && ref.kind == OpKind::Send && ref.buffers.empty())
+        _deferred.push_back(id);
+    return id;
+}
+
+void IoService::finish(const OperationId id)
+{
+    const auto it = _operations.find(id);
+    if (it == _operations.end())
+        return;
+
+    std::unique_ptr<Operation> op = std::move(it->second);
+    _operations.erase(it);
+    const SOCKET fd = op->fd;
+
+    // Callbacks may still reference the operation; free it after they return
+    _retired.push_back(std::move(op));
+
+    OperationId nextWriter = 0;
+    if (const auto f = _fdOperations.find(fd); f != _fdOperations.end())
+    {
+        auto& [reader, writers] = f->second;
+        if (reader == id)
+            reader = 0;
+        else if (const auto w = std::find(writers.begin(), writers.end(), id); w != writers.end())
+        {
+            const bool wasActive = w == writers.begin();
+            writers.erase(w);
+            if (wasActive && !writers.empty())
+                nextWriter = writers.front();
+        }
+        if (reader == 0 && writers.empty())
+            _fdOperations.erase(f);
+    }
+
+    if (nextWriter != 0)
+    {
+        Operation& next = *_operations.at(nextWriter);
+        if (next.buffers.empty())
+            _deferred.push_back(nextWriter);
+#if defined(JSOCKETPP_HAS_IO_URING)
+        else if (_uring)
+            uringArmSend(next);
+#endif
+    }
+
+    if (_selector)
+        reactorUpdate(fd);
+}
+
+std::size_t IoService::runDeferred()
+{
+    std::size_t invoked = 0;
+    for (const OperationId id : std::exchange(_deferred, {}))
+    {
+        const auto it = _operations.find(id);
+        if (it == _operations.end() || it->second->cancelled)
+            continue;
+
+        Operation& op = *it->second;
+        if (op.kind == OpKind::Receive)
+        {
+            const std::string data = std::exchange(op.preload, {});
+            op.onReceive(std::span<const char>(data.data(), data.size()), nullptr);
+            ++invoked;
+        }
+        else if (op.kind == OpKind::Send && op.buffers.empty())
+        {
+            finish(id);
+            if (op.onSend)
+            {
+                op.onSend(0, nullptr);
+                ++invoked;
+            }
+        }
+    }
+    return invoked;
+}
+
+Socket IoService::adoptAccepted(const ServerSocket& server, const SOCKET fd) const
+{
+    sockaddr_storage addr{};
+    socklen_t addrLen = sizeof(addr);
+    if (::getpeername(fd, reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
+    {
+        const int err = GetSocketError();
+        CloseSocket(fd);
+        throw SocketException(err);
+    }
+
+    const auto [recvResolved, sendResolved, internalResolved] =
+        server.resolveBuffers(std::nullopt, std::nullopt, std::nullopt);
+    // The io_uring accept already produced a blocking descriptor
+    return server.wrapAccepted(fd, addr, addrLen, recvResolved, sendResolved, internalResolved, -1, -1, true, false,
+                               false, true);
+}
+
+IoService::OperationId IoService::asyncAcceptMultishot(ServerSocket& server, AcceptHandler handler)
+{
+    if (!server.isListening())
+        throw SocketException("IoService::asyncAcceptMultishot(): server socket is not listening.");
+    if (!handler)
+        throw SocketException("IoService::asyncAcceptMultishot(): handler must not be empty.");
+    if (const auto f = _fdOperations.find(server.getSocketFd()); f != _fdOperations.end() && f->second.reader != 0)
+        throw SocketException("IoService::asyncAcceptMultishot(): an accept operation is already active.");
+
+    server.setNonBlocking(true);
+
+    auto op = std::make_unique<Operation>();
+    op->kind = OpKind::Accept;
+    op->fd = server.getSocketFd();
+    op->server = &server;
+    op->onAccept = std::move(handler);
+    return addOperation(std::move(op));
+}
+
+IoService::OperationId IoService::asyncReceive(Socket& socket, ReceiveHandler handler)
+{
+    if (socket.getSocketFd() == INVALID_SOCKET)
+        throw SocketException("IoService::asyncReceive(): socket is not open.");
+    if (!handler)
+        throw SocketException("IoService::asyncReceive(): handler must not be empty.");
+    if (const auto f = _fdOperations.find(socket.getSocketFd()); f != _fdOperations.end() && f->second.reader != 0)
+        throw SocketException("IoService::asyncReceive(): a receive operation is already active on this socket.");
+
+    auto op = std::make_unique<Operation>();
+    op->kind = OpKind::Receive;
+    op->fd = socket.getSocketFd();
+    op->onReceive = std::move(handler);
+    if (const std::size_t buffered = socket.bufferedBytes(); buffered > 0)
+    {
+        op->preload.resize(buffered);
+        socket.consumeBuffered(op->preload.data(), buffered);
+    }
+
+    const bool preloaded = !op->preload.empty();
+    const OperationId id = addOperation(std::move(op));
+    if (preloaded)
+        _deferred.push_back(id);
+    return id;
+}
+
+IoService::OperationId IoService::asyncReceiveFrom(const DatagramSocket& socket, DatagramHandler handler)
+{
+    if (socket.getSocketFd() == INVALID_SOCKET)
+        throw SocketException("IoService::asyncReceiveFrom(): socket is not open.");
+    if (!handler)
+        throw SocketException("IoService::asyncReceiveFrom(): handler must not be empty.");
+    if (const auto f = _fdOperations.find(socket.getSocketFd()); f != _fdOperations.end() && f->second.reader != 0)
+        throw SocketException("IoService::asyncReceiveFrom(): a receive operation is already active on this socket.");
+
+    auto op = std::make_unique<Operation>();
+    op->kind = OpKind::ReceiveFrom;
+    op->fd = socket.getSocketFd();
+    op->onDatagram = std::move(handler);
+#if defined(JSOCKETPP_HAS_IO_URING)
+    op->msg.msg_namelen = sizeof(sockaddr_storage);
+#endif
+    return addOperation(std::move(op));
+}
+
+IoService::OperationId IoService::asyncSendChain(const SocketOptions& socket, std::vector<std::string> buffers,
+                                                 SendHandler handler)
+{
+    if (socket.getSocketFd() == INVALID_SOCKET)
+        throw SocketException("IoService::asyncSendChain(): socket is not open.");
+
+    auto op = std::make_unique<Operation>();
+    op->kind = OpKind::Send;
+    op->fd = socket.getSocketFd();
+    op->stream = socket.getOption(SOL_SOCKET, SO_TYPE) == SOCK_STREAM;
+    op->buffers = std::move(buffers);
+    op->onSend = std::move(handler);
+    return addOperation(std::move(op));
+}
+
+bool IoService::cancel(const OperationId id)
+{
+    const auto it = _operations.find(id);
+    if (it == _operations.end() || it->second->cancelled)
+        return false;
+
+    Operation& op = *it->second;
+    op.cancelled = true;
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+    // The kernel may still write into operation state; keep it until the last completion arrives
+    if (_uring && op.inFlight > 0)
+    {
+        uringCancel(op);
+        if (op.kind != OpKind::Send)
+        {
+            // Let a new receive start on the socket right away; stale completions are discarded
+            if (const auto f = _fdOperations.find(op.fd); f != _fdOperations.end() && f->second.reader == id)
+                f->second.reader = 0;
+        }
+        return true;
+    }
+#endif
+
+    finish(id);
+    return true;
+}
+
+bool IoService::registerFixedFile(const SocketOptions& socket)
+{
+#if defined(JSOCKETPP_HAS_IO_URING)
+    if (!_uring)
+        return false;
+
+    const SOCKET fd = socket.getSocketFd();
+    if (fd == INVALID_SOCKET)
+        throw SocketException("IoService::registerFixedFile(): socket is not open.");
+    if (_uring->slots.contains(fd))
+        return true;
+    if (_uring->freeSlots.empty())
+        return false;
+
+    const unsigned slot = _uring->freeSlots.back();
+    io_uring_files_update update{};
+    update.offset = slot;
+    update.fds = reinterpret_cast<std::uint64_t>(&fd);
+    if (sysRegister(_uring->fd, IORING_REGISTER_FILES_UPDATE, &update, 1) < 0)
+        throwUringError("IORING_REGISTER_FILES_UPDATE", errno);
+
+    _uring->freeSlots.pop_back();
+    _uring->slots.emplace(fd, slot);
+    return true;
+#else
+    (void) socket;
+    return false;
+#endif
+}
+
+bool IoService::unregisterFixedFile(const SocketOptions& socket)
+{
+#if defined(JSOCKETPP_HAS_IO_URING)
+    if (!_uring)
+        return false;
+
+    const auto it = _uring->slots.find(socket.getSocketFd());
+    if (it == _uring->slots.end())
+        return false;
+
+    // Requests already submitted hold their own file reference and are unaffected
+    constexpr int empty = -1;
+    io_uring_files_update update{};
+    update.offset = it->second;
+    update.fds = reinterpret_cast<std::uint64_t>(&empty);
+    if (sysRegister(_uring->fd, IORING_REGISTER_FILES_UPDATE, &update, 1) < 0)
+        throwUringError("IORING_REGISTER_FILES_UPDATE", errno);
+
+    _uring->freeSlots.push_back(it->second);
+    _uring->slots.erase(it);
+    return true;
+#else
+    (void) socket;
+    return false;
+#endif
+}
+
+std::size_t IoService::runOnce(const int timeoutMillis)
+{
+    std::size_t invoked = runDeferred();
+    const int timeout = invoked > 0 ? 0 : timeoutMillis;
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+    if (_uring)
+        invoked += uringRun(timeout);
+    else
+#endif
+        invoked += reactorRun(timeout);
+
+    _retired.clear();
+    return invoked;
+}
+
+#if defined(JSOCKETPP_HAS_IO_URING)
+
+void IoService::uringArm(Operation& op)
+{
+    io_uring_sqe* sqe = _uring->next();
+    switch (op.kind)
+    {
+        case OpKind::Accept:
+            _uring->prepare(sqe, IORING_OP_ACCEPT, op.fd);
+            sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+            sqe->accept_flags = SOCK_CLOEXEC;
+            break;
+        case OpKind::Receive:
+            _uring->prepare(sqe, IORING_OP_RECV, op.fd);
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags |= IOSQE_BUFFER_SELECT;
+            sqe->buf_group = BufferGroup;
+            break;
+        case OpKind::ReceiveFrom:
+            _uring->prepare(sqe, IORING_OP_RECVMSG, op.fd);
+            sqe->addr = reinterpret_cast<std::uint64_t>(&op.msg);
+            sqe->len = 1;
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags |= IOSQE_BUFFER_SELECT;
+            sqe->buf_group = BufferGroup;
+            sqe->msg_flags = MSG_TRUNC; // report the full datagram length in payloadlen
+            break;
+        case OpKind::Send:
+        default:
+            break; // sends are prepared by uringArmSend()
+    }
+    sqe->user_data = tag(op.id, 0);
+    ++op.inFlight;
+}
+
+void IoService::uringArmSend(Operation& op)
+{
+    const std::size_t chain =
+        std::min({op.buffers.size() - op.index, std::max<std::size_t>(1, _uring->sqEntries / 2), MaxChain});
+    _uring->reserve(static_cast<unsigned>(chain)); // a link chain must not straddle two submissions
+
+    const int flags = SendFlags | (op.stream ? MSG_WAITALL : 0);
+    for (std::size_t i = 0; i < chain; ++i)
+    {
+        const std::string& buf = op.buffers[op.index + i];
+        const std::size_t skip = i == 0 ? op.offset : 0;
+
+        io_uring_sqe* sqe = _uring->next();
+        _uring->prepare(sqe, IORING_OP_SEND, op.fd);
+        sqe->addr = reinterpret_cast<std::uint64_t>(buf.data() + skip);
+        sqe->len = static_cast<std::uint32_t>(buf.size() - skip);
+        sqe->msg_flags = static_cast<std::uint32_t>(flags);
+        if (i + 1 < chain)
+            sqe->flags |= IOSQE_IO_LINK;
+        sqe->user_data = tag(op.id, i);
+    }
+
+    op.chain = chain;
+    op.inFlight = static_cast<unsigned>(chain);
+    op.shortWrite = false;
+    op.error = 0;
+}
+
+void IoService::uringCancel(const Operation& op)
+{
+    const std::size_t targets = op.kind == OpKind::Send ? op.chain : 1;
+    _uring->reserve(static_cast<unsigned>(targets));
+    for (std::size_t i = 0; i < targets; ++i)
+    {
+        io_uring_sqe* sqe = _uring->next();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = tag(op.id, i);
+        sqe->user_data = 0;
+    }
+}
+
+std::size_t IoService::uringRun(const int timeoutMillis)
+{
+    Uring& ring = *_uring;
+    const bool ready = __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE) != *ring.cqHead;
+    if (ring.pending > 0 || !ready)
+        ring.enter(ready || timeoutMillis == 0 ? 0 : 1, timeoutMillis);
+
+    std::size_t invoked = 0;
+    unsigned head = *ring.cqHead;
+    while (head != __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE))
+    {
+        const io_uring_cqe cqe = ring.cqes[head & ring.cqMask];
+        // Release the slot before running user code, which may throw or submit more work
+        __atomic_store_n(ring.cqHead, ++head, __ATOMIC_RELEASE);
+        invoked += uringComplete(cqe.user_data, cqe.res, cqe.flags);
+    }
+
+    // Start work queued by the callbacks now rather than on the next call
+    if (ring.pending > 0)
+        ring.enter(0, 0);
+    return invoked;
+}
+
+std::size_t IoService::uringComplete(const std::uint64_t userData, const int res, const std::uint32_t flags)
+{
+    // Hand the buffer back to the kernel however this function exits
+    struct BufferGuard
+    {
+        Uring& ring;
+        std::uint32_t flags;
+        ~BufferGuard()
+        {
+            if ((flags & IORING_CQE_F_BUFFER) != 0)
+                ring.recycle(static_cast<std::uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+        }
+    } guard{*_uring, flags};
+
+    if (userData == 0)
+        return 0; // completion of a cancel request
+
+    const OperationId id = userData >> SeqBits;
+    const auto it = _operations.find(id);
+    if (it == _operations.end())
+        return 0;
+
+    Operation& op = *it->second;
+    if ((flags & IORING_CQE_F_MORE) == 0)
+        --op.inFlight;
+
+    std::size_t invoked = 0;
+    switch (op.kind)
+    {
+        case OpKind::Accept:
+            if (res >= 0)
+            {
+                if (op.cancelled)
+                {
+                    CloseSocket(res);
+                    break;
+                }
+                std::optional<Socket> client;
+                try
+                {
+                    client.emplace(adoptAccepted(*op.server, res));
+                }
+                catch (const SocketException&)
+                {
+                    break; // the peer reset before we could query it; nothing to deliver
+                }
+                op.onAccept(std::move(client), nullptr);
+                ++invoked;
+            }
+            else if (!op.cancelled && -res != ECANCELED && !internal::isTransientAcceptError(-res))
+            {
+                op.cancelled = true;
+                op.onAccept(std::nullopt, makeError(-res));
+                ++invoked;
+            }
+            break;
+
+        case OpKind::Receive:
+            if (op.cancelled)
+                break;
+            if (res > 0)
+            {
+                const char* data = _uring->buffer(static_cast<std::uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+                op.onReceive(std::span<const char>(data, static_cast<std::size_t>(res)), nullptr);
+                ++invoked;
+            }
+            else if (res == 0)
+            {
+                op.cancelled = true;
+                op.onReceive({}, nullptr);
+                ++invoked;
+            }
+            else if (-res != ENOBUFS && -res != EINTR && -res != EAGAIN)
+            {
+                op.cancelled = true;
+                op.onReceive({}, makeError(-res));
+                ++invoked;
+            }
+            break;
+
+        case OpKind::ReceiveFrom:
+            if (op.cancelled)
+                break;
+            if (res >= 0)
+            {
+                char* buf = _uring->buffer(static_cast<std::uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+                io_uring_recvmsg_out out{};
+                std::memcpy(&out, buf, sizeof(out));
+
+                DatagramReadResult result;
+                result.srcLen = static_cast<socklen_t>(std::min<std::size_t>(out.namelen, sizeof(result.src)));
+                std::memcpy(&result.src, buf + sizeof(out), result.srcLen);
+
+                const std::size_t header = sizeof(out) + op.msg.msg_namelen + op.msg.msg_controllen;
+                const std::size_t received = static_cast<std::size_t>(res) - header;
+                result.datagramSize = out.payloadlen;
+                result.bytes = std::min<std::size_t>(received, out.payloadlen);
+                result.truncated = (out.flags & MSG_TRUNC) != 0 || result.bytes < result.datagramSize;
+
+                op.onDatagram(std::span<const char>(buf + header, result.bytes), result, nullptr);
+                ++invoked;
+            }
+            else if (-res != ENOBUFS && -res != EINTR && -res != EAGAIN)
+            {
+                op.cancelled = true;
+                op.onDatagram({}, DatagramReadResult{}, makeError(-res));
+                ++invoked;
+            }
+            break;
+
+        case OpKind::Send:
+        {
+            const std::size_t seq = userData & MaxChain;
+            const std::size_t index = op.index + seq;
+            if (res >= 0)
+            {
+                op.total += static_cast<std::size_t>(res);
+                const std::size_t expected = op.buffers[index].size() - (seq == 0 ? op.offset : 0);
+                if (static_cast<std::size_t>(res) < expected && op.stream)
+                {
+                    op.shortWrite = true;
+                    op.resumeIndex = index;
+                    op.resumeOffset = op.buffers[index].size() - expected + static_cast<std::size_t>(res);
+                }
+            }
+            else if (-res != ECANCELED && op.error == 0)
+            {
+                op.error = -res;
+            }
+
+            if (op.inFlight > 0 || op.cancelled)
+                break;
+
+            if (op.error == 0 && op.shortWrite)
+            {
+                op.index = op.resumeIndex;
+                op.offset = op.resumeOffset;
+                uringArmSend(op);
+                break;
+            }
+
+            op.index += op.chain;
+            op.offset = 0;
+            if (op.error == 0 && op.index < op.buffers.size())
+            {
+                uringArmSend(op);
+                break;
+            }
+
+            finish(id);
+            if (op.onSend)
+            {
+                op.onSend(op.total, op.error != 0 ? makeError(op.error) : nullptr);
+                ++invoked;
+            }
+            return invoked;
+        }
+
+        default:
+            break;
+    }
+
+    if (op.inFlight == 0)
+    {
+        // A multishot request ended (buffer exhaustion, transient error) but the caller still wants data
+        if (op.cancelled)
+            finish(id);
+        else if (_operations.contains(id))
+            uringArm(op);
+    }
+    return invoked;
+}
+
+void IoService::uringShutdown() noexcept
+{
+    // Cancel everything and wait for the kernel to release our buffers and msghdr templates
+    try
+    {
+        for (auto& [id, op] : _operations)
+            op->cancelled = true;
+
+        io_uring_sqe* sqe = _uring->next();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+        sqe->user_data = 0;
+
+        const auto busy = [this]
+        {
+            return std::any_of(_operations.begin(), _operations.end(),
+                               [](const auto& entry) { return entry.second->inFlight > 0; });
+        };
+
+        for (int attempt = 0; attempt < 50 && busy(); ++attempt)
+        {
+            _uring->enter(1, 20);
+            unsigned head = *_uring->cqHead;
+            while (head != __atomic_load_n(_uring->cqTail, __ATOMIC_ACQUIRE))
+            {
+                const io_uring_cqe cqe = _uring->cqes[head & _uring->cqMask];
+                __atomic_store_n(_uring->cqHead, ++head, __ATOMIC_RELEASE);
+                if (cqe.user_data == 0)
+                    continue;
+
+                const auto it = _operations.find(cqe.user_data >> SeqBits);
+                if (it == _operations.end())
+                    continue;
+                if (it->second->kind == OpKind::Accept && cqe.res >= 0)
+                    CloseSocket(cqe.res);
+                if ((cqe.flags & IORING_CQE_F_MORE) == 0 && it->second->inFlight > 0)
+                    --it->second->inFlight;
+            }
+        }
+    }
+    catch (...)
+    {
+        // Closing the ring below still cancels whatever is left
+    }
+    _uring.reset();
+}
+
+#endif
+
+void IoService::reactorUpdate(const SOCKET fd)
+{
+    Interest interest = Interest::None;
+    if (const auto f = _fdOperations.find(fd); f != _fdOperations.end())
+    {
+        if (f->second.reader != 0)
+            interest = _operations.at(f->second.reader)->kind == OpKind::Accept ? Interest::Accept : Interest::Read;
+        if (!f->second.writers.empty() && !_operations.at(f->second.writers.front())->buffers.empty())
+            interest = interest | Interest::Write;
+    }
+
+    if (interest == Interest::None)
+        _selector->unregisterSocket(fd);
+    else
+        _selector->registerSocket(fd, interest);
+}
+
+std::size_t IoService::reactorRun(const int timeoutMillis)
+{
+    if (_selector->select(timeoutMillis) == 0)
+        return 0;
+
+    std::size_t invoked = 0;
+    for (const SelectionKey& key : _selector->selectedKeys())
+    {
+        // Look the descriptor up again before each step: callbacks may have finished or replaced operations
+        if (key.isReadable() || key.isAcceptable())
+        {
+            if (const auto f = _fdOperations.find(key.fd); f != _fdOperations.end() && f->second.reader != 0)
+                invoked += reactorRead(*_operations.at(f->second.reader));
+        }
+        if (key.isWritable())
+        {
+            if (const auto f = _fdOperations.find(key.fd); f != _fdOperations.end() && !f->second.writers.empty())
+                invoked += reactorWrite(*_operations.at(f->second.writers.front()));
+        }
+    }
+    return invoked;
+}
+
+std::size_t IoService::reactorRead(Operation& op)
+{
+    const OperationId id = op.id;
+    const auto alive = [this, id] { return _operations.contains(id) && !_operations.at(id)->cancelled; };
+
+    std::size_t invoked = 0;
+    for (int burst = 0; burst < ReactorBurst && alive(); ++burst)
+    {
+        if (op.kind == OpKind::Accept)
+        {
+            std::optional<Socket> client;
+            try
+            {
+                client = op.server->acceptNonBlocking();
+            }
+            catch (const SocketException& e)
+            {
+                if (internal::isTransientAcceptError(e.getErrorCode()))
+                    continue;
+                finish(id);
+                op.onAccept(std::nullopt, std::current_exception());
+                return invoked + 1;
+            }
+            if (!client)
+                break;
+            op.onAccept(std::move(client), nullptr);
+            ++invoked;
+            continue;
+        }
+
+#ifdef _WIN32
+        constexpr int flags = 0;
+        const int capacity = static_cast<int>(_scratch.size());
+#else
+        constexpr int flags = MSG_DONTWAIT;
+        const std::size_t capacity = _scratch.size();
+#endif
+        if (op.kind == OpKind::Receive)
+        {
+            const auto n = ::recv(op.fd, _scratch.data(), capacity, flags);
+            if (n > 0)
+            {
+                op.onReceive(std::span<const char>(_scratch.data(), static_cast<std::size_t>(n)), nullptr);
+                ++invoked;
+            }
+            else if (n == 0)
+            {
+                finish(id);
+                op.onReceive({}, nullptr);
+                return invoked + 1;
+            }
+            else
+            {
+                const int err = GetSocketError();
+                if (internal::isWouldBlock(err))
+                    break;
+                finish(id);
+                op.onReceive({}, makeError(err));
+                return invoked + 1;
+            }
+        }
+        else
+        {
+            DatagramReadResult result;
+            socklen_t srcLen = sizeof(result.src);
+#ifdef __linux__
+            const auto n = ::recvfrom(op.fd, _scratch.data(), capacity, flags | MSG_TRUNC,
+                                      reinterpret_cast<sockaddr*>(&result.src), &srcLen);
+#else
+            const auto n = ::recvfrom(op.fd, _scratch.data(), capacity, flags,
+                                      reinterpret_cast<sockaddr*>(&result.src), &srcLen);
+#endif
+            if (n < 0)
+            {
+                const int err = GetSocketError();
+                if (internal::isWouldBlock(err))
+                    break;
+#ifdef _WIN32
+                if (err == WSAEMSGSIZE)
+                {
+                    result.datagramSize = _scratch.size();
+                    result.bytes = _scratch.size();
+                    result.truncated = true;
+                    result.srcLen = srcLen;
+                    op.onDatagram(std::span<const char>(_scratch.data(), result.bytes), result, nullptr);
+                    ++invoked;
+                    continue;
+                }
+#endif
+                finish(id);
+                op.onDatagram({}, DatagramReadResult{}, makeError(err));
+                return invoked + 1;
+            }
+
+            result.datagramSize = static_cast<std::size_t>(n);
+            result.bytes = std::min(result.datagramSize, _scratch.size());
+            result.truncated = result.bytes < result.datagramSize;
+            result.srcLen = srcLen;
+            op.onDatagram(std::span<const char>(_scratch.data(), result.bytes), result, nullptr);
+            ++invoked;
+        }
+
+#ifdef _WIN32
+        break; // no MSG_DONTWAIT: a second recv() could block
+#endif
+    }
+    return invoked;
+}
+
+std::size_t IoService::reactorWrite(Operation& op)
+{
+    while (op.index < op.buffers.size())
+    {
+        const std::string& buf = op.buffers[op.index];
+#ifdef _WIN32
+        const auto n =
+            ::send(op.fd, buf.data() + op.offset, static_cast<int>(buf.size() - op.offset), SendFlags);
+#else
+        const auto n = ::send(op.fd, buf.data() + op.offset, buf.size() - op.offset, SendFlags | MSG_DONTWAIT);
+#endif
+        if (n < 0)
+        {
+            const int err = GetSocketError();
+            if (internal::isWouldBlock(err))
+                return 0;
+
+            finish(op.id);
+            if (!op.onSend)
+                return 0;
+            op.onSend(op.total, makeError(err));
+            return 1;
+        }
+
+        op.total += static_cast<std::size_t>(n);
+        op.offset += static_cast<std::size_t>(n);
+        if (!op.stream || op.offset == buf.size())
+        {
+            ++op.index;
+            op.offset = 0;
+        }
+    }
+
+    finish(op.id);
+    if (!op.onSend)
+        return 0;
+    op.onSend(op.total, nullptr);
+    return 1;
+}
+
+// Socket-class entry points. Defined here so that the socket translation units do not depend on IoService.
+
+std::uint64_t Socket::asyncReceive(IoService& io,
+                                   std::function<void(std::span<const char>, std::exception_ptr)> handler)
+{
+    return io.asyncReceive(*this, std::move(handler));
+}
+
+std::uint64_t Socket::asyncSendChain(IoService& io, std::vector<std::string> buffers,
+                                     std::function<void(std::size_t, std::exception_ptr)> handler) const
+{
+    return io.asyncSendChain(*this, std::move(buffers), std::move(handler));
+}
+
+std::uint64_t ServerSocket::asyncAcceptMultishot(IoService& io,
+                                                 std::function<void(std::optional<Socket>, std::exception_ptr)> handler)
+{
+    return io.asyncAcceptMultishot(*this, std::move(handler));
+}
+
+std::uint64_t DatagramSocket::asyncReceiveFrom(
+    IoService& io,
+    std::function<void(std::span<const char>, const DatagramReadResult&, std::exception_ptr)> handler) const
+{
+    return io.asyncReceiveFrom(*this, std::move(handler));
+}
+
+std::uint64_t DatagramSocket::asyncSendChain(IoService& io, std::vector<std::string> buffers,
+                                             std::function<void(std::size_t, std::exception_ptr)> handler) const
+{
+    return io.asyncSendChain(*this, std::move(buffers), std::move(handler));
+}
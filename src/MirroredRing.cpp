@@ -0,0 +1,85 @@
+#include "jsocketpp/internal/MirroredRing.hpp"
+#include "jsocketpp/common.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <initializer_list>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace jsocketpp;
+
+#if defined(__linux__)
+
+namespace
+{
+
+[[noreturn]] void throwRingError(const int error, const char* what)
+{
+    throw SocketException(error, std::string("MirroredRing: ") + what + ": " + SocketErrorMessage(error));
+}
+
+} // namespace
+
+internal::MirroredRing::MirroredRing(const std::size_t minCapacity)
+{
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t capacity = (minCapacity == 0 ? 1 : (minCapacity + page - 1) / page) * page;
+
+    const int fd = ::memfd_create("jsocketpp-ring", MFD_CLOEXEC);
+    if (fd < 0)
+        throwRingError(errno, "memfd_create() failed");
+    if (::ftruncate(fd, static_cast<off_t>(capacity)) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throwRingError(error, "ftruncate() failed");
+    }
+
+    // Reserve both halves in one range first, so nothing else can be mapped between them
+    void* reserved = ::mmap(nullptr, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED)
+    {
+        const int error = errno;
+        ::close(fd);
+        throwRingError(error, "mmap() failed");
+    }
+
+    auto* base = static_cast<char*>(reserved);
+    for (char* half : {base, base + capacity})
+    {
+        if (::mmap(half, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+        {
+            const int error = errno;
+            ::munmap(reserved, 2 * capacity);
+            ::close(fd);
+            throwRingError(error, "mmap() failed");
+        }
+    }
+
+    // The mappings keep the memory file alive
+    ::close(fd);
+    _data = base;
+    _capacity = capacity;
+}
+
+void internal::MirroredRing::unmap() noexcept
+{
+    if (_data != nullptr)
+        ::munmap(std::exchange(_data, nullptr), 2 * std::exchange(_capacity, 0));
+}
+
+#else
+
+internal::MirroredRing::MirroredRing(std::size_t)
+{
+    throw SocketException("MirroredRing: double-mapped ring buffers are only supported on Linux.");
+}
+
+void internal::MirroredRing::unmap() noexcept
+{
+}
+
+#endif
@@ -0,0 +1,319 @@
+#include "jsocketpp/Relay.hpp"
+
+#include "jsocketpp/internal/PollWait.hpp"
+#include "jsocketpp/internal/ScopedBlockingMode.hpp"
+#include "jsocketpp/internal/SigpipeGuard.hpp"
+#include "jsocketpp/Socket.hpp"
+#include "jsocketpp/UnixSocket.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace jsocketpp;
+
+namespace
+{
+
+/// User-space buffer per direction where splice() is unavailable.
+constexpr std::size_t RelayBufferSize = 64 * 1024;
+
+[[noreturn]] void throwLastError()
+{
+    const int error = GetSocketError();
+    throw SocketException(error);
+}
+
+/// One direction of the relay: bytes read from `from` and not yet written to `to` are held in a pipe or buffer.
+class Direction
+{
+  public:
+    Direction(const SOCKET from, const SOCKET to, [[maybe_unused]] const std::size_t pipeSize)
+        : _from(from), _to(to)
+    {
+#if defined(__linux__)
+        if (::pipe2(_pipe.data(), O_NONBLOCK | O_CLOEXEC) != 0)
+            throwLastError();
+        if (pipeSize > 0)
+            (void) ::fcntl(_pipe[1], F_SETPIPE_SZ, static_cast<int>(pipeSize)); // best effort
+        const int size = ::fcntl(_pipe[1], F_GETPIPE_SZ);
+        _capacity = size > 0 ? static_cast<std::size_t>(size) : RelayBufferSize;
+#else
+        _buffer.resize(RelayBufferSize);
+        _capacity = _buffer.size();
+#endif
+    }
+
+    ~Direction()
+    {
+#if defined(__linux__)
+        ::close(_pipe[0]);
+        ::close(_pipe[1]);
+#endif
+    }
+
+    Direction(const Direction&) = delete;
+    Direction& operator=(const Direction&) = delete;
+
+    [[nodiscard]] bool wantsRead() const noexcept { return !_eof && _pending < _capacity; }
+    [[nodiscard]] bool wantsWrite() const noexcept { return _pending > 0; }
+    [[nodiscard]] bool finished() const noexcept { return _shutdownSent; }
+    [[nodiscard]] SOCKET from() const noexcept { return _from; }
+    [[nodiscard]] SOCKET to() const noexcept { return _to; }
+
+    /// Moves available input into the pipe/buffer. Returns `true` on progress (including EOF).
+    bool fill()
+    {
+#if defined(__linux__)
+        const auto n =
+            ::splice(_from, nullptr, _pipe[1], nullptr, _capacity - _pending, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+#else
+        // wantsRead() only checks the total held, so move it to the front once it reaches the end of the buffer
+        if (_pending == 0 || _head + _pending == _buffer.size())
+        {
+            std::memmove(_buffer.data(), _buffer.data() + _head, _pending);
+            _head = 0;
+        }
+        const std::size_t tail = _head + _pending;
+        const auto n = ::recv(_from, _buffer.data() + tail,
+#ifdef _WIN32
+                              static_cast<int>(_buffer.size() - tail),
+#else
+                              _buffer.size() - tail,
+#endif
+                              0);
+#endif
+        if (n < 0)
+        {
+            if (internal::isWouldBlock(GetSocketError()))
+                return false;
+            throwLastError();
+        }
+        if (n == 0)
+            _eof = true;
+        _pending += static_cast<std::size_t>(n);
+        return true;
+    }
+
+    /// Writes held bytes to the destination. Returns the number of bytes written.
+    std::size_t drain()
+    {
+#if defined(__linux__)
+        const auto n = ::splice(_pipe[0], nullptr, _to, nullptr, _pending, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+#else
+        int flags = 0;
+#ifndef _WIN32
+        flags = MSG_NOSIGNAL;
+#endif
+        const auto n = ::send(_to, _buffer.data() + _head,
+#ifdef _WIN32
+                              static_cast<int>(_pending),
+#else
+                              _pending,
+#endif
+                              flags);
+#endif
+        if (n < 0)
+        {
+            if (internal::isWouldBlock(GetSocketError()))
+                return 0;
+            throwLastError();
+        }
+        _pending -= static_cast<std::size_t>(n);
+#if !defined(__linux__)
+        _head += static_cast<std::size_t>(n);
+#endif
+        return static_cast<std::size_t>(n);
+    }
+
+    /// Propagates EOF once everything read has been forwarded.
+    void maybeShutdown()
+    {
+        if (!_eof || _pending > 0 || _shutdownSent)
+            return;
+#ifdef _WIN32
+        ::shutdown(_to, SD_SEND);
+#else
+        ::shutdown(_to, SHUT_WR); // ENOTCONN if the peer is already gone: nothing left to tell it
+#endif
+        _shutdownSent = true;
+    }
+
+  private:
+    SOCKET _from;
+    SOCKET _to;
+    std::size_t _capacity = 0;
+    std::size_t _pending = 0;
+    bool _eof = false;
+    bool _shutdownSent = false;
+#if defined(__linux__)
+    std::array<int, 2> _pipe{-1, -1};
+#else
+    std::vector<char> _buffer;
+    std::size_t _head = 0;
+#endif
+};
+
+/// Writes bytes a `Socket` read ahead before the relay started; the socket is non-blocking at this point.
+/// Sets @p idleTimedOut and gives up if @p to stays unwritable for @p idleTimeoutMillis.
+std::uint64_t flushReadAhead(Socket& source, const SOCKET to, const int idleTimeoutMillis, bool& idleTimedOut)
+{
+    if (source.bufferedBytes() == 0)
+        return 0;
+
+    const std::string data = source.readAtMost(source.bufferedBytes());
+    std::size_t sent = 0;
+    auto idle = internal::Deadline::after(idleTimeoutMillis);
+    while (sent < data.size())
+    {
+        int flags = 0;
+#ifndef _WIN32
+        flags = MSG_NOSIGNAL;
+#endif
+        const auto n = ::send(to, data.data() + sent,
+#ifdef _WIN32
+                              static_cast<int>(data.size() - sent),
+#else
+                              data.size() - sent,
+#endif
+                              flags);
+        if (n < 0)
+        {
+            if (!internal::isWouldBlock(GetSocketError()))
+                throwLastError();
+            if (internal::pollUntil(to, POLLOUT, idle) == 0)
+            {
+                idleTimedOut = true;
+                break;
+            }
+            continue;
+        }
+        sent += static_cast<std::size_t>(n);
+        idle = internal::Deadline::after(idleTimeoutMillis);
+    }
+    return sent;
+}
+
+} // namespace
+
+RelayEndpoint::RelayEndpoint(Socket& socket) noexcept : _fd(socket.getSocketFd()), _socket(&socket) {}
+
+RelayEndpoint::RelayEndpoint(UnixSocket& socket) noexcept : _fd(socket.getSocketFd()), _socket(nullptr) {}
+
+RelayStats jsocketpp::relay(const RelayEndpoint a, const RelayEndpoint b, const RelayOptions& options)
+{
+    if (a._fd == INVALID_SOCKET || b._fd == INVALID_SOCKET)
+        throw SocketException("relay(): both endpoints must be open.");
+
+    const internal::SigpipeGuard noSigpipe;
+    const internal::ScopedBlockingMode nonBlockingA(a._fd, true);
+    const internal::ScopedBlockingMode nonBlockingB(b._fd, true);
+
+    RelayStats stats;
+    if (a._socket)
+        stats.bytesAToB += flushReadAhead(*a._socket, b._fd, options.idleTimeoutMillis, stats.idleTimedOut);
+    if (b._socket && !stats.idleTimedOut)
+        stats.bytesBToA += flushReadAhead(*b._socket, a._fd, options.idleTimeoutMillis, stats.idleTimedOut);
+    if (stats.idleTimedOut)
+        return stats;
+
+    Direction aToB(a._fd, b._fd, options.pipeSize);
+    Direction bToA(b._fd, a._fd, options.pipeSize);
+    const std::array<Direction*, 2> directions{&aToB, &bToA};
+    const std::array<std::uint64_t*, 2> counters{&stats.bytesAToB, &stats.bytesBToA};
+
+    using Clock = std::chrono::steady_clock;
+    auto lastActivity = Clock::now();
+
+    while (!aToB.finished() || !bToA.finished())
+    {
+        // Side 0 is `a`, side 1 is `b`. Sides with nothing to wait for are left out, so that a hung-up
+        // descriptor whose direction is finished cannot make poll() spin.
+        const SOCKET sockets[2] = {a._fd, b._fd};
+        short events[2] = {0, 0};
+        const auto side = [&](const SOCKET fd) { return fd == a._fd ? 0 : 1; };
+        for (const Direction* d : directions)
+        {
+            if (d->finished())
+                continue;
+            if (d->wantsRead())
+                events[side(d->from())] |= POLLIN;
+            if (d->wantsWrite())
+                events[side(d->to())] |= POLLOUT;
+        }
+
+        std::array<pollfd, 2> fds{};
+        int slot[2] = {-1, -1};
+        std::size_t count = 0;
+        for (int k = 0; k < 2; ++k)
+        {
+            if (events[k] == 0)
+                continue;
+            slot[k] = static_cast<int>(count);
+            fds[count++] = pollfd{sockets[k], events[k], 0};
+        }
+        if (count == 0)
+            break;
+
+        int wait = -1;
+        if (options.idleTimeoutMillis >= 0)
+        {
+            const auto idle = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - lastActivity);
+            wait = static_cast<int>(
+                (std::max) (std::chrono::milliseconds::rep{0}, options.idleTimeoutMillis - idle.count()));
+        }
+
+#ifdef _WIN32
+        const int ready = ::WSAPoll(fds.data(), static_cast<ULONG>(count), wait);
+#else
+        const int ready = ::poll(fds.data(), static_cast<nfds_t>(count), wait);
+#endif
+        if (ready < 0)
+        {
+#ifndef _WIN32
+            if (errno == EINTR)
+                continue;
+#endif
+            throwLastError();
+        }
+        if (ready == 0)
+        {
+            stats.idleTimedOut = true;
+            break;
+        }
+
+        const auto revents = [&](const SOCKET fd)
+        {
+            const int k = slot[side(fd)];
+            return k < 0 ? 0 : fds[static_cast<std::size_t>(k)].revents;
+        };
+
+        bool progressed = false;
+        for (std::size_t i = 0; i < directions.size(); ++i)
+        {
+            Direction& d = *directions[i];
+            if (d.finished())
+                continue;
+
+            bool filled = false;
+            if (d.wantsRead() && (revents(d.from()) & (POLLIN | POLLHUP | POLLERR)) != 0)
+                filled = d.fill();
+            // Try to forward fresh input at once: the destination is usually writable
+            if (d.wantsWrite() && (filled || (revents(d.to()) & (POLLOUT | POLLHUP | POLLERR)) != 0))
+            {
+                const std::size_t written = d.drain();
+                *counters[i] += written;
+                filled |= written > 0;
+            }
+            d.maybeShutdown();
+            progressed |= filled;
+        }
+
+        if (progressed)
+            lastActivity = Clock::now();
+    }
+
+    return stats;
+}
@@ -0,0 +1,376 @@
+#include "jsocketpp/Selector.hpp"
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+using namespace jsocketpp;
+
+namespace
+{
+
+constexpr Interest ReadLike = Interest::Read | Interest::Accept;
+
+Interest& operator|=(Interest& a, const Interest b) noexcept
+{
+    a = a | b;
+    return a;
+}
+
+[[noreturn]] void throwSelectorError()
+{
+    const int err = GetSocketError();
+    throw SocketException(err);
+}
+
+#ifdef __linux__
+
+std::uint32_t toEpollEvents(const Interest interest, const TriggerMode mode) noexcept
+{
+    std::uint32_t events = 0;
+    if (hasInterest(interest, ReadLike))
+        events |= static_cast<std::uint32_t>(EPOLLIN);
+    if (hasInterest(interest, Interest::Read))
+        events |= static_cast<std::uint32_t>(EPOLLRDHUP);
+    if (hasInterest(interest, Interest::Write))
+        events |= static_cast<std::uint32_t>(EPOLLOUT);
+    if (mode == TriggerMode::Edge)
+        events |= static_cast<std::uint32_t>(EPOLLET);
+    return events;
+}
+
+#else
+
+short toPollEvents(const Interest interest) noexcept
+{
+    int events = 0;
+    if (hasInterest(interest, ReadLike))
+        events |= POLLIN;
+    if (hasInterest(interest, Interest::Write))
+        events |= POLLOUT;
+    return static_cast<short>(events);
+}
+#endif
+
+} // namespace
+
+Selector::Selector(const std::size_t maxEvents) : _maxEvents(maxEvents)
+{
+    if (_maxEvents == 0)
+        throw SocketException("Selector: maxEvents must be greater than 0.");
+
+#ifdef __linux__
+    _epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (_epollFd < 0)
+        throwSelectorError();
+
+    _wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_wakeFd < 0)
+    {
+        const int err = errno;
+        ::close(_epollFd);
+        throw SocketException(err);
+    }
+
+    epoll_event ev{};
+    ev.events = static_cast<std::uint32_t>(EPOLLIN);
+    ev.data.fd = _wakeFd;
+    if (::epoll_ctl(_epollFd, EPOLL_CTL_ADD, _wakeFd, &ev) != 0)
+    {
+        const int err = errno;
+        ::close(_wakeFd);
+        ::close(_epollFd);
+        throw SocketException(err);
+    }
+
+    _events.resize(_maxEvents);
+#elif defined(_WIN32)
+    // Winsock has no pipes: use a loopback UDP socket connected to itself as the wakeup channel
+    _wakeRecv = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (_wakeRecv == INVALID_SOCKET)
+        throwSelectorError();
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int addrLen = sizeof(addr);
+    u_long nonBlocking = 1;
+    if (::bind(_wakeRecv, reinterpret_cast<const sockaddr*>(&addr), addrLen) == SOCKET_ERROR ||
+        ::getsockname(_wakeRecv, reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR ||
+        ::connect(_wakeRecv, reinterpret_cast<const sockaddr*>(&addr), addrLen) == SOCKET_ERROR ||
+        ::ioctlsocket(_wakeRecv, FIONBIO, &nonBlocking) == SOCKET_ERROR)
+    {
+        const int err = GetSocketError();
+        CloseSocket(_wakeRecv);
+        throw SocketException(err);
+    }
+    _wakeSend = _wakeRecv;
+#else
+    int fds[2];
+    if (::pipe(fds) != 0)
+        throwSelectorError();
+
+    for (const int fd : fds)
+    {
+        if (::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK) == -1 || ::fcntl(fd, F_SETFD, FD_CLOEXEC) == -1)
+        {
+            const int err = errno;
+            ::close(fds[0]);
+            ::close(fds[1]);
+            throw SocketException(err);
+        }
+    }
+    _wakeRecv = fds[0];
+    _wakeSend = fds[1];
+#endif
+
+    _selected.reserve(_maxEvents);
+}
+
+Selector::~Selector() noexcept
+{
+#ifdef __linux__
+    ::close(_wakeFd);
+    ::close(_epollFd);
+#elif defined(_WIN32)
+    CloseSocket(_wakeRecv);
+#else
+    ::close(_wakeRecv);
+    ::close(_wakeSend);
+#endif
+}
+
+void Selector::registerSocket(const SocketOptions& socket, const Interest interest, void* attachment,
+                              const TriggerMode mode)
+{
+    if (socket.getSocketFd() == INVALID_SOCKET)
+        throw SocketException("Selector::registerSocket(): socket is not open.");
+
+    if (mode == TriggerMode::Edge && !socket.getNonBlocking())
+        throw SocketException("Selector::registerSocket(): edge-triggered registration requires a non-blocking socket.");
+
+    registerSocket(socket.getSocketFd(), interest, attachment, mode);
+}
+
+void Selector::registerSocket(const SOCKET fd, const Interest interest, void* attachment, const TriggerMode mode)
+{
+    if (fd == INVALID_SOCKET)
+        throw SocketException("Selector::registerSocket(): invalid socket descriptor.");
+
+    const std::lock_guard lock(_mutex);
+
+#ifdef __linux__
+    epoll_event ev{};
+    ev.events = toEpollEvents(interest, mode);
+    ev.data.fd = fd;
+
+    const bool known = _registrations.contains(fd);
+    int rc = ::epoll_ctl(_epollFd, known ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev);
+
+    // A stale entry means the descriptor was closed (dropping it from epoll) and its number reused
+    if (rc != 0 && known && errno == ENOENT)
+        rc = ::epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &ev);
+    if (rc != 0)
+        throwSelectorError();
+#endif
+
+    _registrations[fd] = Registration{interest, mode, attachment};
+}
+
+void Selector::modify(const SOCKET fd, const Interest interest)
+{
+    const std::lock_guard lock(_mutex);
+
+    const auto it = _registrations.find(fd);
+    if (it == _registrations.end())
+        throw SocketException("Selector::modify(): socket is not registered.");
+
+#ifdef __linux__
+    epoll_event ev{};
+    ev.events = toEpollEvents(interest, it->second.mode);
+    ev.data.fd = fd;
+    if (::epoll_ctl(_epollFd, EPOLL_CTL_MOD, fd, &ev) != 0)
+        throwSelectorError();
+#endif
+
+    it->second.interest = interest;
+}
+
+bool Selector::unregisterSocket(const SOCKET fd)
+{
+    const std::lock_guard lock(_mutex);
+
+    if (_registrations.erase(fd) == 0)
+        return false;
+
+#ifdef __linux__
+    // ENOENT/EBADF: the descriptor was already closed, which removed it from the epoll set
+    if (::epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr) != 0 && errno != ENOENT && errno != EBADF)
+        throwSelectorError();
+#endif
+
+    return true;
+}
+
+bool Selector::isRegistered(const SOCKET fd) const
+{
+    const std::lock_guard lock(_mutex);
+    return _registrations.contains(fd);
+}
+
+std::size_t Selector::size() const
+{
+    const std::lock_guard lock(_mutex);
+    return _registrations.size();
+}
+
+std::size_t Selector::select(const int timeoutMillis)
+{
+    _selected.clear();
+
+#ifdef __linux__
+    const int n = ::epoll_wait(_epollFd, _events.data(), static_cast<int>(_events.size()), timeoutMillis);
+    if (n < 0)
+    {
+        if (errno == EINTR)
+            return 0;
+        throwSelectorError();
+    }
+
+    const std::lock_guard lock(_mutex);
+    for (int i = 0; i < n; ++i)
+    {
+        const epoll_event& ev = _events[static_cast<std::size_t>(i)];
+        if (ev.data.fd == _wakeFd)
+        {
+            drainWakeup();
+            continue;
+        }
+
+        // Unregistered by another thread after epoll_wait() returned
+        const auto it = _registrations.find(ev.data.fd);
+        if (it == _registrations.end())
+            continue;
+
+        SelectionKey key;
+        key.fd = ev.data.fd;
+        key.interest = it->second.interest;
+        key.attachment = it->second.attachment;
+        key.error = (ev.events & EPOLLERR) != 0;
+        key.hangup = (ev.events & (EPOLLHUP | EPOLLRDHUP)) != 0;
+
+        if (key.error || (ev.events & EPOLLHUP) != 0)
+            key.ready = key.interest;
+        else
+        {
+            if ((ev.events & (EPOLLIN | EPOLLRDHUP)) != 0)
+                key.ready |= key.interest & ReadLike;
+            if ((ev.events & EPOLLOUT) != 0)
+                key.ready |= key.interest & Interest::Write;
+        }
+
+        _selected.push_back(key);
+    }
+#else
+    {
+        const std::lock_guard lock(_mutex);
+        _pollFds.clear();
+        _pollFds.push_back({_wakeRecv, POLLIN, 0});
+        for (const auto& [fd, reg] : _registrations)
+            _pollFds.push_back({fd, toPollEvents(reg.interest), 0});
+    }
+
+#ifdef _WIN32
+    const int n = ::WSAPoll(_pollFds.data(), static_cast<ULONG>(_pollFds.size()), timeoutMillis);
+    if (n == SOCKET_ERROR)
+        throwSelectorError();
+#else
+    const int n = ::poll(_pollFds.data(), static_cast<nfds_t>(_pollFds.size()), timeoutMillis);
+    if (n < 0)
+    {
+        if (errno == EINTR)
+            return 0;
+        throwSelectorError();
+    }
+#endif
+
+    if (n == 0)
+        return 0;
+
+    if (_pollFds.front().revents != 0)
+        drainWakeup();
+
+    const std::lock_guard lock(_mutex);
+    for (std::size_t i = 1; i < _pollFds.size() && _selected.size() < _maxEvents; ++i)
+    {
+        const auto& pfd = _pollFds[i];
+        if (pfd.revents == 0)
+            continue;
+
+        const auto it = _registrations.find(pfd.fd);
+        if (it == _registrations.end())
+            continue;
+
+        SelectionKey key;
+        key.fd = pfd.fd;
+        key.interest = it->second.interest;
+        key.attachment = it->second.attachment;
+        key.error = (pfd.revents & (POLLERR | POLLNVAL)) != 0;
+        key.hangup = (pfd.revents & POLLHUP) != 0;
+
+        if (key.error || key.hangup)
+            key.ready = key.interest;
+        else
+        {
+            if ((pfd.revents & POLLIN) != 0)
+                key.ready |= key.interest & ReadLike;
+            if ((pfd.revents & POLLOUT) != 0)
+                key.ready |= key.interest & Interest::Write;
+        }
+
+        _selected.push_back(key);
+    }
+#endif
+
+    return _selected.size();
+}
+
+void Selector::wakeup()
+{
+    if (_wakePending.exchange(true, std::memory_order_acq_rel))
+        return; // a wakeup is already in flight
+
+#ifdef __linux__
+    constexpr std::uint64_t one = 1;
+    if (::write(_wakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+#elif defined(_WIN32)
+    constexpr char one = 1;
+    if (::send(_wakeSend, &one, 1, 0) == SOCKET_ERROR && GetSocketError() != WSAEWOULDBLOCK)
+#else
+    constexpr char one = 1;
+    if (::write(_wakeSend, &one, 1) < 0 && errno != EAGAIN)
+#endif
+    {
+        _wakePending.store(false, std::memory_order_release);
+        throwSelectorError();
+    }
+}
+
+void Selector::drainWakeup() noexcept
+{
+#ifdef __linux__
+    std::uint64_t value = 0;
+    [[maybe_unused]] const auto n = ::read(_wakeFd, &value, sizeof(value));
+#elif defined(_WIN32)
+    char scratch[64];
+    while (::recv(_wakeRecv, scratch, static_cast<int>(sizeof(scratch)), 0) > 0)
+    {
+    }
+#else
+    char scratch[64];
+    while (::read(_wakeRecv, scratch, sizeof(scratch)) > 0)
+    {
+    }
+#endif
+    _wakePending.store(false, std::memory_order_release);
+}
@@ -1,10 +1,204 @@
 #include "jsocketpp/ServerSocket.hpp"
+#include "jsocketpp/Selector.hpp"
 #include "jsocketpp/SocketTimeoutException.hpp"
+#include "jsocketpp/internal/PollWait.hpp"
+#include "jsocketpp/internal/ScopedBlockingMode.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <thread>
 
 using namespace jsocketpp;
 
+namespace jsocketpp::internal
+{
+
+/**
+ * @brief The one thread per `ServerSocket` that serves `acceptAsync()` calls, in the order they were made.
+ * @ingroup internal
+ *
+ * Waits on a `Selector`, so `stop()` can interrupt a wait at once. The thread holds a reference to the acceptor,
+ * which therefore lives until the thread exits even when `stop()` is called from a callback.
+ *
+ * The listener is non-blocking from construction until `stop()`, like with `AcceptLoop`: a connection reported
+ * ready may be gone by the time it is accepted, and only a non-blocking listener then lets the thread go back to
+ * waiting instead of blocking in `accept()` where `stop()` cannot reach it.
+ */
+class AsyncAcceptor : public std::enable_shared_from_this<AsyncAcceptor>
+{
+  public:
+    /// @brief Receives the accepted socket, or the exception that ended the call.
+    using Completion = std::function<void(std::optional<Socket>, std::exception_ptr)>;
+
+    /// @brief One queued `acceptAsync()` call: the `accept()` tuning parameters and its completion.
+    struct Request
+    {
+        Completion done;
+        std::optional<std::size_t> recvBufferSize;
+        std::optional<std::size_t> sendBufferSize;
+        std::optional<std::size_t> internalBufferSize;
+        int soRecvTimeoutMillis;
+        int soSendTimeoutMillis;
+        bool tcpNoDelay;
+        bool keepAlive;
+        bool nonBlocking;
+    };
+
+    explicit AsyncAcceptor(const ServerSocket& server) : _server(server)
+    {
+        _selector.registerSocket(server, Interest::Accept);
+        _nonBlocking.emplace(server.getSocketFd(), true);
+    }
+
+    /// @brief Starts the thread; separate from the constructor because it needs `shared_from_this()`.
+    void start()
+    {
+        _thread = std::thread([self = shared_from_this()] { self->run(); });
+    }
+
+    /// @brief The acceptor whose thread is the calling thread, if any (i.e. when called from a callback).
+    [[nodiscard]] static AsyncAcceptor* current() noexcept { return _current; }
+
+    [[nodiscard]] const ServerSocket& server() const noexcept { return _server; }
+
+    void submit(Request request)
+    {
+        {
+            const std::lock_guard lock(_mutex);
+            _queue.push_back(std::move(request));
+        }
+        _queued.notify_one();
+    }
+
+    void stop() noexcept
+    {
+        {
+            const std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _queued.notify_one();
+        try
+        {
+            _selector.wakeup();
+        }
+        catch (...)
+        {
+            // The thread also re-checks _stopping after every bounded wait
+        }
+
+        if (_thread.joinable())
+        {
+            if (_thread.get_id() == std::this_thread::get_id())
+                _thread.detach(); // called from a callback; the thread exits when it returns
+            else
+                _thread.join();
+        }
+
+        // The thread accepts nothing more, so the listener gets its previous mode back
+        _nonBlocking.reset();
+    }
+
+  private:
+    void run()
+    {
+        _current = this;
+        while (true)
+        {
+            std::unique_lock lock(_mutex);
+            _queued.wait(lock, [this] { return _stopping || !_queue.empty(); });
+            if (_stopping)
+                break;
+            Request request = std::move(_queue.front());
+            _queue.pop_front();
+            lock.unlock();
+
+            std::optional<Socket> client;
+            std::exception_ptr error;
+            try
+            {
+                client = acceptOne(request);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            complete(request, std::move(client), error);
+        }
+
+        // Fail whatever is still queued; callbacks may queue more, so take them one at a time
+        while (true)
+        {
+            std::unique_lock lock(_mutex);
+            if (_queue.empty())
+                break;
+            Request request = std::move(_queue.front());
+            _queue.pop_front();
+            lock.unlock();
+            complete(request, std::nullopt, std::make_exception_ptr(cancelled()));
+        }
+    }
+
+    Socket acceptOne(const Request& request)
+    {
+        const Deadline deadline = Deadline::after(_server.getSoTimeout());
+        while (true)
+        {
+            {
+                const std::lock_guard lock(_mutex);
+                if (_stopping)
+                    throw cancelled();
+            }
+            if (deadline.expired())
+                throw SocketTimeoutException{};
+
+            // A bounded wait keeps cancellation prompt even if a wakeup is lost
+            const int slice = deadline.isInfinite() ? 1000 : (std::min) (deadline.remainingMillis(), 1000);
+            if (_selector.select(slice) == 0)
+                continue;
+
+            // Another thread may have taken the connection (or the peer reset it); then keep waiting
+            if (auto client = _server.acceptNonBlocking(request.recvBufferSize, request.sendBufferSize,
+                                                        request.internalBufferSize, request.soRecvTimeoutMillis,
+                                                        request.soSendTimeoutMillis, request.tcpNoDelay,
+                                                        request.keepAlive, request.nonBlocking))
+                return std::move(*client);
+        }
+    }
+
+    static SocketException cancelled()
+    {
+        return SocketException("acceptAsync(): cancelled, the ServerSocket was closed.");
+    }
+
+    static void complete(Request& request, std::optional<Socket> client, std::exception_ptr error) noexcept
+    {
+        try
+        {
+            request.done(std::move(client), std::move(error));
+        }
+        catch (...)
+        {
+            // A callback that throws has nowhere to report to; the next call is still served
+        }
+    }
+
+    const ServerSocket& _server;                      ///< Listener; outlives the thread's use of it (see `stop()`).
+    Selector _selector{2};                            ///< Waits for the listener and `stop()` wakeups.
+    std::mutex _mutex{};                              ///< Guards `_queue` and `_stopping`.
+    std::condition_variable _queued{};                ///< Signalled when a call is queued or on stop.
+    std::deque<Request> _queue{};                     ///< Calls not yet started.
+    bool _stopping = false;                           ///< Set once by `stop()`.
+    std::thread _thread{};                            ///< Runs `run()`.
+    std::optional<ScopedBlockingMode> _nonBlocking{}; ///< Keeps the listener non-blocking until `stop()`.
+
+    static thread_local AsyncAcceptor* _current; ///< Set on each acceptor's own thread.
+};
+
+thread_local AsyncAcceptor* AsyncAcceptor::_current = nullptr;
+
+} // namespace jsocketpp::internal
+
 ServerSocket::ServerSocket(const Port port, const std::string_view localAddress, const bool autoBindListen,
                            const bool reuseAddress, const int soTimeoutMillis, const bool dualStack)
     : SocketOptions(INVALID_SOCKET), _port(port)
@@ -129,7 +323,7 @@ void ServerSocket::cleanup()
 void ServerSocket::cleanupAndThrow(const int errorCode)
 {
     cleanup();
-    throw SocketException(errorCode, SocketErrorMessage(errorCode));
+    throw SocketException(errorCode);
 }
 
 void ServerSocket::cleanupAndRethrow()
@@ -149,7 +343,7 @@ std::string ServerSocket::getLocalIp(const bool convertIPv4Mapped) const
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return ipFromSockaddr(reinterpret_cast<const sockaddr*>(&addr), convertIPv4Mapped);
@@ -166,7 +360,7 @@ Port ServerSocket::getLocalPort() const
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return portFromSockaddr(reinterpret_cast<const sockaddr*>(&addr));
@@ -182,7 +376,7 @@ std::string ServerSocket::getLocalSocketAddress() const
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&addr), &len) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     char host[INET6_ADDRSTRLEN]{};
@@ -210,6 +404,7 @@ ServerSocket::~ServerSocket() noexcept
 
 void ServerSocket::close()
 {
+    stopAsyncAccepts();
     internal::closeOrThrow(getSocketFd());
     setSocketFd(INVALID_SOCKET);
     _srvAddrInfo.reset();
@@ -242,7 +437,7 @@ void ServerSocket::bind()
     if (res == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     _isBound = true;
@@ -253,7 +448,7 @@ void ServerSocket::listen(const int backlog /* = 128 */)
     if (::listen(getSocketFd(), backlog) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     _isListening = true;
@@ -346,18 +541,26 @@ Socket ServerSocket::acceptBlocking(const std::optional<std::size_t> recvBufferS
     sockaddr_storage clientAddr{};
     socklen_t clientAddrLen = sizeof(clientAddr);
 
+#ifdef __linux__
+    const SOCKET clientSocket = ::accept4(getSocketFd(), reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen,
+                                          SOCK_CLOEXEC | (nonBlocking ? SOCK_NONBLOCK : 0));
+    constexpr bool nonBlockingApplied = true;
+#else
     const SOCKET clientSocket = ::accept(getSocketFd(), reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
+    constexpr bool nonBlockingApplied = false;
+#endif
     if (clientSocket == INVALID_SOCKET)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     const auto [recvResolved, sendResolved, internalResolved] =
         resolveBuffers(recvBufferSize, sendBufferSize, internalBufferSize);
 
-    return {clientSocket,        clientAddr,          clientAddrLen, recvResolved, sendResolved, internalResolved,
-            soRecvTimeoutMillis, soSendTimeoutMillis, tcpNoDelay,    keepAlive,    nonBlocking};
+    return wrapAccepted(clientSocket, clientAddr, clientAddrLen, recvResolved, sendResolved, internalResolved,
+                        soRecvTimeoutMillis, soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking,
+                        nonBlockingApplied);
 }
 
 std::optional<Socket> ServerSocket::acceptNonBlocking(const std::optional<std::size_t> recvBufferSize,
@@ -373,7 +576,15 @@ std::optional<Socket> ServerSocket::acceptNonBlocking(const std::optional<std::s
     sockaddr_storage clientAddr{};
     socklen_t addrLen = sizeof(clientAddr);
 
+#ifdef __linux__
+    // accept4() applies O_NONBLOCK and FD_CLOEXEC atomically with the accept, avoiding extra fcntl() round trips
+    const SOCKET clientSocket = ::accept4(getSocketFd(), reinterpret_cast<sockaddr*>(&clientAddr), &addrLen,
+                                          SOCK_CLOEXEC | (nonBlocking ? SOCK_NONBLOCK : 0));
+    constexpr bool nonBlockingApplied = true;
+#else
     const SOCKET clientSocket = ::accept(getSocketFd(), reinterpret_cast<sockaddr*>(&clientAddr), &addrLen);
+    constexpr bool nonBlockingApplied = false;
+#endif
     if (clientSocket == INVALID_SOCKET)
     {
         const int err = GetSocketError();
@@ -392,8 +603,70 @@ std::optional<Socket> ServerSocket::acceptNonBlocking(const std::optional<std::s
     const auto [recvResolved, sendResolved, internalResolved] =
         resolveBuffers(recvBufferSize, sendBufferSize, internalBufferSize);
 
-    return Socket(clientSocket, clientAddr, addrLen, recvResolved, sendResolved, internalResolved, soRecvTimeoutMillis,
-                  soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking);
+    return wrapAccepted(clientSocket, clientAddr, addrLen, recvResolved, sendResolved, internalResolved,
+                        soRecvTimeoutMillis, soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking,
+                        nonBlockingApplied);
+}
+
+Socket ServerSocket::wrapAccepted(const SOCKET client, const sockaddr_storage& addr, const socklen_t len,
+                                  const std::size_t recvBufferSize, const std::size_t sendBufferSize,
+                                  const std::size_t internalBufferSize, const int soRecvTimeoutMillis,
+                                  const int soSendTimeoutMillis, const bool tcpNoDelay, const bool keepAlive,
+                                  const bool nonBlocking, const bool nonBlockingApplied) const
+{
+    std::optional<std::size_t> recv = recvBufferSize;
+    std::optional<std::size_t> send = sendBufferSize;
+    int recvTimeout = soRecvTimeoutMillis;
+    int sendTimeout = soSendTimeoutMillis;
+    std::optional<bool> noDelay = tcpNoDelay;
+    std::optional<bool> alive = keepAlive;
+
+#ifdef __linux__
+    // Linux copies these from the listener into the accepted socket; only values that differ need a setsockopt()
+    if (_inherited)
+    {
+        if (_inherited->recvBufferSize == recvBufferSize)
+            recv.reset();
+        if (_inherited->sendBufferSize == sendBufferSize)
+            send.reset();
+        if (_inherited->soRecvTimeoutMillis == soRecvTimeoutMillis)
+            recvTimeout = -1;
+        if (_inherited->soSendTimeoutMillis == soSendTimeoutMillis)
+            sendTimeout = -1;
+        if (_inherited->tcpNoDelay == tcpNoDelay)
+            noDelay.reset();
+        if (_inherited->keepAlive == keepAlive)
+            alive.reset();
+    }
+#endif
+
+    return {client,  addr,  len, recv, send, internalBufferSize, recvTimeout, sendTimeout,
+            noDelay, alive, nonBlockingApplied ? std::nullopt : std::optional<bool>(nonBlocking)};
+}
+
+void ServerSocket::setInheritedOptions(const InheritedSocketOptions& options)
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("ServerSocket::setInheritedOptions(): socket is not open.");
+
+    if (options.recvBufferSize)
+    {
+        setReceiveBufferSize(*options.recvBufferSize);
+        _defaultReceiveBufferSize = *options.recvBufferSize;
+    }
+    if (options.sendBufferSize)
+    {
+        setSendBufferSize(*options.sendBufferSize);
+        _defaultSendBufferSize = *options.sendBufferSize;
+    }
+    if (options.soRecvTimeoutMillis >= 0)
+        setSoRecvTimeout(options.soRecvTimeoutMillis);
+    if (options.soSendTimeoutMillis >= 0)
+        setSoSendTimeout(options.soSendTimeoutMillis);
+    setTcpNoDelay(options.tcpNoDelay);
+    setKeepAlive(options.keepAlive);
+
+    _inherited = options;
 }
 
 std::future<Socket> ServerSocket::acceptAsync(std::optional<std::size_t> recvBufferSize,
@@ -402,15 +675,19 @@ std::future<Socket> ServerSocket::acceptAsync(std::optional<std::size_t> recvBuf
                                               const int soRecvTimeoutMillis, const int soSendTimeoutMillis,
                                               const bool tcpNoDelay, const bool keepAlive, const bool nonBlocking) const
 {
-    // Note: capturing `this` is safe as long as the ServerSocket outlives the future.
-    // Document this in your thread-safety notes!
-    return std::async(std::launch::async,
-                      [this, recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis,
-                       soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking]() -> Socket
-                      {
-                          return this->accept(recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis,
-                                              soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking);
-                      });
+    auto promise = std::make_shared<std::promise<Socket>>();
+    std::future<Socket> future = promise->get_future();
+    acceptAsync(
+        [promise](std::optional<Socket> client, const std::exception_ptr& error)
+        {
+            if (error)
+                promise->set_exception(error);
+            else
+                promise->set_value(std::move(*client));
+        },
+        recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis, soSendTimeoutMillis, tcpNoDelay,
+        keepAlive, nonBlocking);
+    return future;
 }
 
 void ServerSocket::acceptAsync(std::function<void(std::optional<Socket>, std::exception_ptr)> callback,
@@ -419,25 +696,37 @@ void ServerSocket::acceptAsync(std::function<void(std::optional<Socket>, std::ex
                                const int soSendTimeoutMillis, const bool tcpNoDelay, const bool keepAlive,
                                const bool nonBlocking) const
 {
-    // Start a background thread to perform the blocking accept
-    std::thread(
-        [this, callback = std::move(callback), recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis,
-         soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking]()
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("Server socket is not initialized or already closed.");
+
+    // From a callback, queue on the running acceptor even if close() has already detached it from this socket;
+    // the call is then cancelled instead of starting a new thread on a listener that is going away
+    internal::AsyncAcceptor* acceptor = internal::AsyncAcceptor::current();
+    if (acceptor == nullptr || &acceptor->server() != this)
+        acceptor = _asyncAcceptor.get();
+
+    if (acceptor == nullptr)
+    {
+        auto started = std::make_shared<internal::AsyncAcceptor>(*this);
+        try
         {
-            try
-            {
-                // Try to accept a client (may throw on error)
-                Socket client = this->accept(recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis,
-                                             soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking);
-                callback(std::move(client), nullptr); // Success: call callback with client and null exception
-            }
-            catch (...)
-            {
-                // Failure: pass the exception to the callback
-                callback(std::nullopt, std::current_exception());
-            }
-        })
-        .detach(); // Detach so thread runs independently; lifetime is managed by the OS
+            started->start();
+        }
+        catch (const std::system_error& e)
+        {
+            throw SocketException(e.code().value(), std::string("acceptAsync(): failed to start thread: ") + e.what());
+        }
+        _asyncAcceptor = std::move(started);
+        acceptor = _asyncAcceptor.get();
+    }
+    acceptor->submit({std::move(callback), recvBufferSize, sendBufferSize, internalBufferSize, soRecvTimeoutMillis,
+                      soSendTimeoutMillis, tcpNoDelay, keepAlive, nonBlocking});
+}
+
+void ServerSocket::stopAsyncAccepts() const noexcept
+{
+    if (const auto acceptor = std::exchange(_asyncAcceptor, nullptr))
+        acceptor->stop();
 }
 
 bool ServerSocket::waitReady(const std::optional<int> timeoutMillis) const
@@ -450,65 +739,6 @@ bool ServerSocket::waitReady(const std::optional<int> timeoutMillis) const
     // Determine the effective timeout to use: user-provided or socket's configured default
     const int millis = timeoutMillis.value_or(_soTimeoutMillis);
 
-#ifndef _WIN32
-    // --- POSIX: Use poll() for readiness notification ---
-    pollfd pfd{};
-    pfd.fd = getSocketFd();
-    pfd.events = POLLIN; // Monitor for readability (incoming connection)
-    pfd.revents = 0;
-
-    // poll() timeout: <0 = infinite, 0 = poll, >0 = wait up to millis
-    const int timeout = (millis < 0) ? -1 : millis;
-    int result = poll(&pfd, 1, timeout);
-    if (result < 0)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-    // poll() returns the number of fds with events. Check for POLLIN.
-    return result > 0 && (pfd.revents & POLLIN);
-#else
-    // --- Windows: Use select() for readiness notification ---
-    if (getSocketFd() >= FD_SETSIZE)
-    {
-        throw SocketException("waitReady() failed: socket descriptor exceeds FD_SETSIZE (" +
-                              std::to_string(FD_SETSIZE) + "), select() cannot be used");
-    }
-    // Prepare the file descriptor set for select().
-    // We want to monitor this server socket for readability (i.e., incoming connection).
-    fd_set readFds;
-    FD_ZERO(&readFds);               // Clear the set of file descriptors
-    FD_SET(getSocketFd(), &readFds); // Add our server socket to the set
-
-    // Prepare the timeout structure for select()
-    timeval tv{};
-    const timeval* tvPtr = nullptr; // Null pointer means select() will wait indefinitely
-
-    if (millis > 0)
-    {
-        // Convert milliseconds to seconds + microseconds for struct timeval
-        tv.tv_sec = millis / 1000;
-        tv.tv_usec = (millis % 1000) * 1000;
-        tvPtr = &tv; // Use this timeout in select()
-    }
-    else if (millis == 0)
-    {
-        // Zero timeout means select() returns immediately (polling)
-        tv.tv_sec = 0;
-        tv.tv_usec = 0;
-        tvPtr = &tv;
-    }
-    // If millis is negative, we leave tvPtr as nullptr — meaning select() will block indefinitely.
-
-    // Call select() to wait for the server socket to become readable (i.e., a client is attempting to connect).
-    int result = select(static_cast<int>(getSocketFd()) + 1, &readFds, nullptr, nullptr, tvPtr);
-    if (result < 0)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-    // select() returns the number of sockets that are ready.
-    // If it's greater than 0, our server socket is ready to accept a connection.
-    return result > 0;
-#endif
+    // poll()/ppoll()/WSAPoll() work for any descriptor value; a negative timeout waits indefinitely
+    return (internal::pollUntil(getSocketFd(), POLLIN, internal::Deadline::after(millis)) & POLLIN) != 0;
 }
@@ -0,0 +1,161 @@
+#include "jsocketpp/ShardedDatagramServer.hpp"
+
+#include "jsocketpp/internal/CpuSteering.hpp"
+#include "jsocketpp/SocketTimeoutException.hpp"
+
+#include <algorithm>
+
+using namespace jsocketpp;
+
+ShardedDatagramServer::ShardedDatagramServer(const Port port, Handler handler, ShardedDatagramServerOptions options,
+                                             ErrorHandler onError)
+    : _handler(std::move(handler)), _onError(std::move(onError)), _options(std::move(options)), _port(port)
+{
+    if (!_handler)
+        throw SocketException("ShardedDatagramServer: handler must not be empty.");
+    if (_options.batchSize == 0 || _options.maxDatagramSize == 0)
+        throw SocketException("ShardedDatagramServer: batchSize and maxDatagramSize must be greater than 0.");
+    if (_options.shards == 0)
+        _options.shards = (std::max) (1u, std::thread::hardware_concurrency());
+#if !defined(SO_REUSEPORT)
+    _options.shards = 1; // no way to bind several sockets to one port
+#endif
+
+    _shards.reserve(_options.shards);
+    for (std::size_t i = 0; i < _options.shards; ++i)
+    {
+        auto shard = std::make_unique<Shard>();
+        // The receive timeout bounds how long an idle shard takes to notice stop()
+        shard->socket = std::make_unique<DatagramSocket>(_port, _options.localAddress, _options.recvBufferSize,
+                                                         std::nullopt, std::nullopt, true, _options.stopCheckMillis,
+                                                         -1, false, true, false);
+#if defined(SO_REUSEPORT)
+        // Members of the reuseport group are numbered in bind order, which the steering program relies on
+        shard->socket->setReusePort(true);
+#endif
+#if defined(SO_INCOMING_CPU)
+        if (_options.pinThreads)
+        {
+            try
+            {
+                shard->socket->setIncomingCpu(static_cast<int>(i));
+            }
+            catch (const SocketException&)
+            {
+                // Kernels before 4.4 only report SO_INCOMING_CPU; placement then relies on the program alone
+            }
+        }
+#endif
+        shard->socket->bind(_options.localAddress, _port);
+        if (i == 0)
+            _port = shard->socket->getLocalPort();
+        _shards.push_back(std::move(shard));
+    }
+
+    // The program belongs to the whole reuseport group, so attaching it to one socket is enough
+    _cpuSteering = _options.cpuSteering &&
+                   internal::attachReuseportCpuProgram(_shards.front()->socket->getSocketFd(), _shards.size());
+
+    try
+    {
+        for (std::size_t i = 0; i < _shards.size(); ++i)
+            _shards[i]->thread = std::thread(&ShardedDatagramServer::shardMain, this, std::ref(*_shards[i]), i);
+    }
+    catch (const std::system_error& e)
+    {
+        stop();
+        throw SocketException(e.code().value(),
+                              std::string("ShardedDatagramServer: failed to start threads: ") + e.what());
+    }
+}
+
+ShardedDatagramServer::~ShardedDatagramServer() noexcept
+{
+    stop();
+}
+
+void ShardedDatagramServer::stop() noexcept
+{
+    _stopping.store(true, std::memory_order_release);
+    for (const auto& shard : _shards)
+    {
+        if (shard->thread.joinable())
+            shard->thread.join();
+    }
+    for (const auto& shard : _shards)
+        shard->socket.reset();
+}
+
+std::uint64_t ShardedDatagramServer::receivedCount(const std::size_t index) const
+{
+    return _shards.at(index)->received.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ShardedDatagramServer::receivedCount() const noexcept
+{
+    std::uint64_t total = 0;
+    for (const auto& shard : _shards)
+        total += shard->received.load(std::memory_order_relaxed);
+    return total;
+}
+
+int ShardedDatagramServer::incomingCpu(const std::size_t index) const
+{
+    const Shard& shard = *_shards.at(index);
+#if defined(SO_INCOMING_CPU)
+    if (shard.socket)
+        return shard.socket->getIncomingCpu();
+#endif
+    (void) shard;
+    return -1;
+}
+
+void ShardedDatagramServer::shardMain(Shard& shard, const std::size_t index)
+{
+    if (_options.pinThreads)
+        internal::pinCurrentThreadToCpu(index);
+
+    // Buffers keep their capacity across batches; only the handler's view is trimmed to each datagram's size
+    std::vector<DatagramPacket> packets(_options.batchSize, DatagramPacket(_options.maxDatagramSize));
+    std::vector<DatagramReadResult> results(_options.batchSize);
+    DatagramReadOptions readOptions{};
+    readOptions.allowGrow = false;
+    readOptions.allowShrink = false;
+    readOptions.errorOnTruncate = false;
+    readOptions.resolveNumeric = _options.resolveSenders;
+    readOptions.updateLastRemote = false;
+
+    while (!_stopping.load(std::memory_order_acquire))
+    {
+        try
+        {
+            const std::size_t n = shard.socket->readBatch(packets, readOptions, results);
+            shard.received.fetch_add(n, std::memory_order_relaxed);
+            _handler(DatagramBatch{*shard.socket, index, std::span(packets).first(n),
+                                   std::span<const DatagramReadResult>(results).first(n)});
+        }
+        catch (const SocketTimeoutException&)
+        {
+            // Idle: re-check the stop flag
+        }
+        catch (...)
+        {
+            reportError(std::current_exception());
+        }
+    }
+}
+
+void ShardedDatagramServer::reportError(std::exception_ptr error) noexcept
+{
+    if (!_onError)
+        return;
+
+    try
+    {
+        _onError(std::move(error));
+    }
+    catch (...)
+    {
+        // An error handler that throws has nowhere left to report to
+    }
+}
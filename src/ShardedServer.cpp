@@ -0,0 +1,205 @@
+#include "jsocketpp/ShardedServer.hpp"
+
+#include "jsocketpp/internal/CpuSteering.hpp"
+
+#include <algorithm>
+
+using namespace jsocketpp;
+
+namespace
+{
+
+/// Server whose shard runs on the current thread, so that `stop()` can tell when a session calls it.
+thread_local const ShardedServer* currentServer = nullptr;
+
+} // namespace
+
+ShardedServer::ShardedServer(const Port port, SessionFactory factory, ShardedServerOptions options,
+                             ErrorHandler onError)
+    : _factory(std::move(factory)), _onError(std::move(onError)), _options(std::move(options)), _port(port)
+{
+    if (!_factory)
+        throw SocketException("ShardedServer: session factory must not be empty.");
+    if (_options.shards == 0)
+        _options.shards = (std::max) (1u, std::thread::hardware_concurrency());
+
+    _shards.reserve(_options.shards);
+    for (std::size_t i = 0; i < _options.shards; ++i)
+    {
+        auto shard = std::make_unique<Shard>();
+#if defined(SO_REUSEPORT)
+        // Join the reuseport group in index order: the kernel numbers listeners in the order they start listening,
+        // which is what the steering program's return value refers to
+        shard->listener = std::make_shared<ServerSocket>(_port, _options.localAddress, false, true);
+        shard->listener->setReusePort(true);
+        shard->listener->bind();
+        shard->listener->listen(_options.backlog);
+#else
+        if (i == 0)
+        {
+            shard->listener = std::make_shared<ServerSocket>(_port, _options.localAddress, false, true);
+            shard->listener->bind();
+            shard->listener->listen(_options.backlog);
+        }
+        else
+        {
+            shard->listener = _shards.front()->listener;
+        }
+#endif
+        // Set once here: with a shared listener, concurrent asyncAccept() calls must not race on the flags
+        shard->listener->setNonBlocking(true);
+        if (i == 0)
+            _port = shard->listener->getLocalPort();
+
+        shard->loop = std::make_unique<EventLoop>([this](std::exception_ptr error) { reportError(std::move(error)); });
+        shard->loop->spawn(acceptLoop(*shard));
+        _shards.push_back(std::move(shard));
+    }
+
+    // The program belongs to the whole reuseport group, so attaching it to one listener is enough
+    _cpuSteering = _options.cpuSteering &&
+                   internal::attachReuseportCpuProgram(_shards.front()->listener->getSocketFd(), _shards.size());
+
+    try
+    {
+        for (std::size_t i = 0; i < _shards.size(); ++i)
+            _shards[i]->thread = std::thread(&ShardedServer::shardMain, this, std::ref(*_shards[i]), i);
+    }
+    catch (const std::system_error& e)
+    {
+        stop();
+        throw SocketException(e.code().value(), std::string("ShardedServer: failed to start threads: ") + e.what());
+    }
+}
+
+ShardedServer::~ShardedServer() noexcept
+{
+    stop();
+}
+
+void ShardedServer::stop() noexcept
+{
+    _stopping.store(true, std::memory_order_release);
+
+    // A session whose shard is being joined by a concurrent stop() must not wait for that stop() to finish
+    std::unique_lock lock(_stopMutex, std::defer_lock);
+    if (currentServer == this)
+    {
+        if (!lock.try_lock())
+            return;
+    }
+    else
+        lock.lock();
+
+    for (const auto& shard : _shards)
+    {
+        if (shard->loop)
+            shard->loop->stop();
+    }
+
+    const auto self = std::this_thread::get_id();
+    for (const auto& shard : _shards)
+    {
+        if (shard->thread.joinable() && shard->thread.get_id() != self)
+            shard->thread.join();
+    }
+
+    for (const auto& shard : _shards)
+    {
+        // Destroying the loop destroys its suspended sessions, whose sockets close with their frames. A session
+        // calling stop() runs inside its own shard's loop; that shard is left to the next stop() or destructor.
+        if (!shard->thread.joinable())
+            shard->loop.reset();
+        try
+        {
+            if (shard->listener)
+                shard->listener->close();
+        }
+        catch (...)
+        {
+            // Nothing useful to do about a failed close() during shutdown
+        }
+    }
+}
+
+std::uint64_t ShardedServer::acceptedCount(const std::size_t index) const
+{
+    return _shards.at(index)->accepted.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ShardedServer::acceptedCount() const noexcept
+{
+    std::uint64_t total = 0;
+    for (const auto& shard : _shards)
+        total += shard->accepted.load(std::memory_order_relaxed);
+    return total;
+}
+
+void ShardedServer::shardMain(Shard& shard, const std::size_t index)
+{
+    if (_options.pinThreads)
+        internal::pinCurrentThreadToCpu(index);
+    currentServer = this;
+
+    while (!_stopping.load(std::memory_order_acquire))
+    {
+        try
+        {
+            // stop() wakes the selector; the wakeup stays pending if it arrives before the wait starts
+            shard.loop->runOnce(-1);
+        }
+        catch (...)
+        {
+            reportError(std::current_exception());
+        }
+    }
+}
+
+// GCC reports these for the switch and null pointers it generates when lowering the coroutine below
+DIAGNOSTIC_PUSH()
+DIAGNOSTIC_IGNORE("-Wswitch-default")
+DIAGNOSTIC_IGNORE("-Wzero-as-null-pointer-constant")
+
+Task<void> ShardedServer::acceptLoop(Shard& shard)
+{
+    EventLoop& loop = *shard.loop;
+    while (!_stopping.load(std::memory_order_acquire))
+    {
+        bool backOff = false;
+        try
+        {
+            Socket client = co_await asyncAccept(loop, *shard.listener);
+            shard.accepted.fetch_add(1, std::memory_order_relaxed);
+            loop.spawn(_factory(loop, std::move(client)));
+        }
+        catch (const SocketException& e)
+        {
+            backOff = internal::isResourceExhaustion(e.getErrorCode());
+            reportError(std::current_exception());
+        }
+        catch (...)
+        {
+            reportError(std::current_exception());
+        }
+
+        if (backOff)
+            co_await loop.sleepFor(internal::ResourceBackoff);
+    }
+}
+
+DIAGNOSTIC_POP()
+
+void ShardedServer::reportError(std::exception_ptr error) noexcept
+{
+    if (!_onError)
+        return;
+
+    try
+    {
+        _onError(std::move(error));
+    }
+    catch (...)
+    {
+        // An error handler that throws has nowhere left to report to
+    }
+}
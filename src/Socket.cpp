@@ -1,17 +1,137 @@
 #include "jsocketpp/Socket.hpp"
 
+#include "jsocketpp/internal/ByteScan.hpp"
+#include "jsocketpp/internal/IoVecCursor.hpp"
 #include "jsocketpp/internal/ScopedBlockingMode.hpp"
+#include "jsocketpp/internal/SigpipeGuard.hpp"
 #include "jsocketpp/SocketTimeoutException.hpp"
 
 #include <chrono>
 #include <cstring> // std::memcpy
 #include <span>
+#include <system_error>
+
+#ifdef _WIN32
+#include <fcntl.h>    // _O_RDONLY, _O_BINARY
+#include <io.h>       // _open, _read, _lseeki64, _close
+#include <sys/stat.h> // _fstat64
+#else
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // pread
+#endif
+
+#if defined(__linux__)
+#include <linux/errqueue.h> // sock_extended_err, SO_EE_ORIGIN_ZEROCOPY
+#include <sys/sendfile.h>   // sendfile
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#endif
 
 using namespace jsocketpp;
 
-Socket::Socket(const SOCKET client, const sockaddr_storage& addr, const socklen_t len, const std::size_t recvBufferSize,
-               const std::size_t sendBufferSize, const std::size_t internalBufferSize, const int soRecvTimeoutMillis,
-               const int soSendTimeoutMillis, const bool tcpNoDelay, const bool keepAlive, const bool nonBlocking)
+namespace
+{
+
+/// Chunk size for the read-and-send fallback of `Socket::sendFile()`.
+constexpr std::size_t SendFileChunk = 64 * 1024;
+
+/// Builds a SocketException from the current `errno` of a file operation.
+SocketException fileError(const char* what)
+{
+    const int error = errno;
+    return SocketException(error, std::string(what) + ": " + std::generic_category().message(error));
+}
+
+/// Closes a file descriptor opened by `Socket::sendFile(const std::string&, ...)`.
+class ScopedFile
+{
+  public:
+    explicit ScopedFile(const std::string& path)
+    {
+#ifdef _WIN32
+        _fd = ::_open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+        _fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+        if (_fd < 0)
+            throw fileError(("sendFile(): cannot open '" + path + "'").c_str());
+    }
+
+    ~ScopedFile()
+    {
+#ifdef _WIN32
+        ::_close(_fd);
+#else
+        ::close(_fd);
+#endif
+    }
+
+    ScopedFile(const ScopedFile&) = delete;
+    ScopedFile& operator=(const ScopedFile&) = delete;
+
+    [[nodiscard]] int get() const noexcept { return _fd; }
+
+  private:
+    int _fd = -1;
+};
+
+/// One `readv()`/`WSARecv()` over @p count entries; throws if the peer has closed the connection.
+std::size_t recvIoVecs(const SOCKET fd, internal::IoVec* vec, const std::size_t count)
+{
+#ifdef _WIN32
+    DWORD bytesReceived = 0;
+    DWORD flags = 0;
+    if (WSARecv(fd, vec, static_cast<DWORD>(count), &bytesReceived, &flags, nullptr, nullptr) == SOCKET_ERROR)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+#else
+    const ssize_t bytesReceived = ::readv(fd, vec, static_cast<int>(count));
+    if (bytesReceived < 0)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+#endif
+    if (bytesReceived == 0)
+        throw SocketException("Connection closed during readv().");
+
+    return static_cast<std::size_t>(bytesReceived);
+}
+
+} // namespace
+
+std::size_t internal::sendIoVecs(const SOCKET fd, internal::IoVec* vec, const std::size_t count)
+{
+#ifdef _WIN32
+    DWORD bytesSent = 0;
+    if (WSASend(fd, vec, static_cast<DWORD>(count), &bytesSent, 0, nullptr, nullptr) == SOCKET_ERROR)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+    return static_cast<std::size_t>(bytesSent);
+#else
+    const ssize_t bytesSent = ::writev(fd, vec, static_cast<int>(count));
+    if (bytesSent < 0)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+    return static_cast<std::size_t>(bytesSent);
+#endif
+}
+
+Socket::Socket(const SOCKET client, const sockaddr_storage& addr, const socklen_t len,
+               const std::optional<std::size_t> recvBufferSize, const std::optional<std::size_t> sendBufferSize,
+               const std::size_t internalBufferSize, const int soRecvTimeoutMillis, const int soSendTimeoutMillis,
+               const std::optional<bool> tcpNoDelay, const std::optional<bool> keepAlive,
+               const std::optional<bool> nonBlocking)
     : SocketOptions(client), _remoteAddr(addr), _remoteAddrLen(len), _internalBuffer(internalBufferSize)
 {
     if (getSocketFd() == INVALID_SOCKET)
@@ -19,12 +139,18 @@ Socket::Socket(const SOCKET client, const sockaddr_storage& addr, const socklen_
 
     try
     {
-        setReceiveBufferSize(recvBufferSize);
-        setSendBufferSize(sendBufferSize);
+        // Unset options were inherited from the listener (or applied by accept4()): each one skipped saves a syscall
+        if (recvBufferSize)
+            setReceiveBufferSize(*recvBufferSize);
+        if (sendBufferSize)
+            setSendBufferSize(*sendBufferSize);
         setInternalBufferSize(internalBufferSize);
-        setTcpNoDelay(tcpNoDelay);
-        setKeepAlive(keepAlive);
-        setNonBlocking(nonBlocking);
+        if (tcpNoDelay)
+            setTcpNoDelay(*tcpNoDelay);
+        if (keepAlive)
+            setKeepAlive(*keepAlive);
+        if (nonBlocking)
+            setNonBlocking(*nonBlocking);
 
         if (soRecvTimeoutMillis >= 0)
             setSoRecvTimeout(soRecvTimeoutMillis);
@@ -63,7 +189,7 @@ Socket::Socket(const std::string_view host, const Port port, const std::optional
 
     // --- Configure socket options before connect ---
     setReuseAddress(reuseAddress);
-    setInternalBufferSize(_internalBuffer.size());
+    setInternalBufferSize(_internalBuffer.capacity());
     setReceiveBufferSize(recvBufferSize.value_or(DefaultBufferSize));
     setSendBufferSize(sendBufferSize.value_or(DefaultBufferSize));
     setTcpNoDelay(tcpNoDelay);
@@ -103,13 +229,14 @@ void Socket::cleanup()
     _selectedAddrInfo = nullptr;
     _isBound = false;
     _isConnected = false;
+    _internalBuffer.clear();
     resetShutdownFlags();
 }
 
 void Socket::cleanupAndThrow(const int errorCode)
 {
     cleanup();
-    throw SocketException(errorCode, SocketErrorMessage(errorCode));
+    throw SocketException(errorCode);
 }
 
 void Socket::cleanupAndRethrow()
@@ -149,7 +276,7 @@ void Socket::bind(const std::string_view localHost, const Port port)
     }
 
     const int error = GetSocketError();
-    throw SocketException(error, SocketErrorMessage(error));
+    throw SocketException(error);
 }
 
 void Socket::bind(const Port port)
@@ -208,52 +335,21 @@ void Socket::connect(const int timeoutMillis)
 
         if (!useNonBlocking || !wouldBlock)
         {
-            throw SocketException(error, SocketErrorMessage(error));
-        }
-
-        // Check FD_SETSIZE limit before using select()
-        if (getSocketFd() >= FD_SETSIZE)
-        {
-            throw SocketException("connect(): socket descriptor exceeds FD_SETSIZE (" + std::to_string(FD_SETSIZE) +
-                                  "), select() cannot be used");
+            throw SocketException(error);
         }
 
         // Wait until socket becomes writable (connection ready or failed)
-        timeval tv{};
-        tv.tv_sec = timeoutMillis / 1000;
-        tv.tv_usec = (timeoutMillis % 1000) * 1000;
-
-        fd_set writeFds;
-        FD_ZERO(&writeFds);
-        FD_SET(getSocketFd(), &writeFds);
-
-#ifdef _WIN32
-        const int selectResult = ::select(0, nullptr, &writeFds, nullptr, &tv);
-#else
-        int selectResult;
-        do
-        {
-            selectResult = ::select(getSocketFd() + 1, nullptr, &writeFds, nullptr, &tv);
-        } while (selectResult < 0 && errno == EINTR);
-#endif
-
-        if (selectResult == 0)
-            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                         "Connection timed out after " + std::to_string(timeoutMillis) + " ms");
-        if (selectResult < 0)
-        {
-            const int selectError = GetSocketError();
-            throw SocketException(selectError, SocketErrorMessage(selectError));
-        }
+        if (!internal::waitFor(getSocketFd(), true, internal::Deadline::after(timeoutMillis)))
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Connection timed out");
 
-        // Even if select() reports writable, we must check if the connection actually succeeded
+        // Even if the socket reports writable, we must check if the connection actually succeeded
         int so_error = 0;
         socklen_t len = sizeof(so_error);
         // SO_ERROR is always retrieved as int (POSIX & Windows agree on semantics)
         if (::getsockopt(getSocketFd(), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&so_error), &len) < 0 ||
             so_error != 0)
         {
-            throw SocketException(so_error, SocketErrorMessage(so_error));
+            throw SocketException(so_error);
         }
     }
 
@@ -261,6 +357,54 @@ void Socket::connect(const int timeoutMillis)
     // Socket mode will be restored automatically via ScopedBlockingMode destructor
 }
 
+bool Socket::beginConnect()
+{
+    if (_isConnected)
+        throw SocketException("beginConnect() called on an already-connected socket");
+    if (_selectedAddrInfo == nullptr)
+        throw SocketException("beginConnect() failed: no valid addrinfo found");
+
+    setNonBlocking(true);
+
+    const auto res = ::connect(getSocketFd(), _selectedAddrInfo->ai_addr,
+#ifdef _WIN32
+                               static_cast<int>(_selectedAddrInfo->ai_addrlen)
+#else
+                               _selectedAddrInfo->ai_addrlen
+#endif
+    );
+
+    if (res == SOCKET_ERROR)
+    {
+        const int error = GetSocketError();
+#ifdef _WIN32
+        if (error == WSAEINPROGRESS || error == WSAEWOULDBLOCK)
+#else
+        if (error == EINPROGRESS || error == EWOULDBLOCK)
+#endif
+            return false;
+        throw SocketException(error);
+    }
+
+    _isConnected = true;
+    return true;
+}
+
+void Socket::finishConnect()
+{
+    int so_error = 0;
+    socklen_t len = sizeof(so_error);
+    if (::getsockopt(getSocketFd(), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&so_error), &len) < 0)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+    if (so_error != 0)
+        throw SocketException(so_error);
+
+    _isConnected = true;
+}
+
 Socket::~Socket() noexcept
 {
     try
@@ -287,6 +431,8 @@ void Socket::close()
     _selectedAddrInfo = nullptr;
     _isBound = false;
     _isConnected = false;
+    _internalBuffer.clear();
+    _zeroCopy = {};
     resetShutdownFlags();
 }
 
@@ -332,7 +478,7 @@ void Socket::shutdown(const ShutdownMode how) const
         if (::shutdown(getSocketFd(), shutdownType))
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
     }
 }
@@ -348,7 +494,7 @@ std::string Socket::getLocalIp(const bool convertIPv4Mapped) const
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return ipFromSockaddr(reinterpret_cast<const sockaddr*>(&addr), convertIPv4Mapped);
@@ -365,7 +511,7 @@ Port Socket::getLocalPort() const
     if (::getsockname(getSocketFd(), reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return portFromSockaddr(reinterpret_cast<const sockaddr*>(&addr));
@@ -387,7 +533,7 @@ std::string Socket::getRemoteIp(const bool convertIPv4Mapped) const
     if (::getpeername(getSocketFd(), reinterpret_cast<sockaddr*>(&remoteAddr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return ipFromSockaddr(reinterpret_cast<const sockaddr*>(&remoteAddr), convertIPv4Mapped);
@@ -404,7 +550,7 @@ Port Socket::getRemotePort() const
     if (::getpeername(getSocketFd(), reinterpret_cast<sockaddr*>(&remoteAddr), &addrLen) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return portFromSockaddr(reinterpret_cast<const sockaddr*>(&remoteAddr));
@@ -416,6 +562,13 @@ std::string Socket::getRemoteSocketAddress(const bool convertIPv4Mapped) const
 }
 
 size_t Socket::write(const std::string_view message) const
+{
+    // send() may send fewer bytes than requested (partial write), especially on non-blocking sockets.
+    // It is the caller's responsibility to check the return value and handle partial sends if needed.
+    return tryWrite(message).valueOrThrow();
+}
+
+IoResult Socket::tryWrite(const std::string_view message) const noexcept
 {
     int flags = 0;
 #ifndef _WIN32
@@ -429,13 +582,8 @@ size_t Socket::write(const std::string_view message) const
 #endif
                           flags);
     if (len == SOCKET_ERROR)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-    // send() may send fewer bytes than requested (partial write), especially on non-blocking sockets.
-    // It is the caller's responsibility to check the return value and handle partial sends if needed.
-    return static_cast<size_t>(len);
+        return IoResult::failure(GetSocketError());
+    return {static_cast<size_t>(len)};
 }
 
 // Write all data, retrying as needed until all bytes are sent or an error occurs.
@@ -455,52 +603,76 @@ size_t Socket::writeAll(const std::string_view message) const
 
 void Socket::setInternalBufferSize(const std::size_t newLen)
 {
-    _internalBuffer.resize(newLen);
-    _internalBuffer.shrink_to_fit();
+    if (newLen == 0)
+        throw SocketException("setInternalBufferSize(): buffer size must be greater than zero.");
+
+    // Only the configured size changes unless bytes are buffered; those are kept, so it never shrinks below them
+    _internalBuffer.setCapacity(newLen);
 }
 
-bool Socket::waitReady(const bool forWrite, const int timeoutMillis) const
+void Socket::setReceiveBufferPool(BufferPool& pool)
 {
-    if (getSocketFd() == INVALID_SOCKET)
-        throw SocketException("Invalid socket");
-
-    // Guard against file descriptors exceeding FD_SETSIZE, which causes UB in FD_SET()
-    if (getSocketFd() >= FD_SETSIZE)
-    {
-        throw SocketException("Socket descriptor exceeds FD_SETSIZE (" + std::to_string(FD_SETSIZE) +
-                              "), cannot use select()");
-    }
-
-    fd_set fds;
-    FD_ZERO(&fds);
-    FD_SET(getSocketFd(), &fds);
+    _internalBuffer.setPool(pool);
+}
 
-    // Default to zero-timeout for non-blocking poll
-    timeval tv{0, 0};
-    if (timeoutMillis >= 0)
-    {
-        tv.tv_sec = timeoutMillis / 1000;
-        tv.tv_usec = (timeoutMillis % 1000) * 1000;
-    }
+#if defined(__linux__)
+void Socket::setMirroredReceiveBuffer(const bool enable)
+{
+    _internalBuffer.setMirrored(enable);
+}
+#endif
 
-    int result;
+std::size_t Socket::fillInternalBuffer() const
+{
+    const std::span<char> space = _internalBuffer.prepare();
+    if (space.empty())
+        throw SocketException("fillInternalBuffer(): internal buffer is full.");
 
+    const auto len = recv(getSocketFd(), space.data(),
 #ifdef _WIN32
-    // On Windows, the first argument to select() is ignored but must be >= 0.
-    result = select(0, forWrite ? nullptr : &fds, forWrite ? &fds : nullptr, nullptr, &tv);
+                          static_cast<int>(space.size()),
 #else
-    // On POSIX, first argument must be the highest fd + 1
-    result =
-        select(static_cast<int>(getSocketFd()) + 1, forWrite ? nullptr : &fds, forWrite ? &fds : nullptr, nullptr, &tv);
+                          space.size(),
 #endif
+                          0);
 
-    if (result < 0)
+    if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        _internalBuffer.commit(0); // gives the storage back if the buffer is still empty
+        throw SocketException(error);
     }
 
-    return result > 0;
+    _internalBuffer.commit(static_cast<std::size_t>(len));
+    return static_cast<std::size_t>(len);
+}
+
+std::size_t Socket::consumeBuffered(void* dst, const std::size_t n) const noexcept
+{
+    const std::size_t count = (std::min) (n, bufferedBytes());
+    if (count == 0)
+        return 0;
+
+    std::memcpy(dst, _internalBuffer.data(), count);
+    _internalBuffer.consume(count);
+    return count;
+}
+
+bool Socket::waitReady(const bool forWrite, const int timeoutMillis) const
+{
+    return waitReady(forWrite, internal::Deadline::after(timeoutMillis));
+}
+
+bool Socket::waitReady(const bool forWrite, const internal::Deadline& deadline) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("Invalid socket");
+
+    // Bytes already held in the internal buffer can be read without touching the kernel
+    if (!forWrite && bufferedBytes() > 0)
+        return true;
+
+    return internal::waitFor(getSocketFd(), forWrite, deadline);
 }
 
 std::string Socket::readExact(const std::size_t n) const
@@ -511,100 +683,93 @@ std::string Socket::readExact(const std::size_t n) const
     std::string result;
     result.resize(n); // pre-allocate for performance
 
-    std::size_t totalRead = 0;
-    while (totalRead < n)
-    {
-        const auto remaining = n - totalRead;
-
-        const auto len = recv(getSocketFd(), result.data() + totalRead,
-#ifdef _WIN32
-                              static_cast<int>(remaining),
-#else
-                              remaining,
-#endif
-                              0);
-
-        if (len == SOCKET_ERROR)
-        {
-            const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
-        }
-
-        if (len == 0)
-            throw SocketException("Connection closed before reading all data.");
+    readIntoInternal(result.data(), n, true);
+    return result;
+}
 
-        totalRead += static_cast<std::size_t>(len);
-    }
+std::pmr::string Socket::readExact(const std::size_t n, std::pmr::memory_resource* resource) const
+{
+    std::pmr::string result(resourceOr(resource));
+    if (n == 0)
+        return result;
 
+    result.resize(n);
+    readIntoInternal(result.data(), n, true);
     return result;
 }
 
 std::string Socket::readUntil(const char delimiter, const std::size_t maxLen, const bool includeDelimiter)
 {
-    if (maxLen == 0)
+    return readUntil(std::string_view(&delimiter, 1), maxLen, includeDelimiter);
+}
+
+std::size_t Socket::bufferUntil(const std::string_view delimiter, const std::size_t maxLen, const char* caller) const
+{
+    if (delimiter.empty())
     {
-        throw SocketException("readUntil: maxLen must be greater than 0.");
+        throw SocketException(std::string(caller) + ": delimiter must not be empty.");
     }
 
-    std::string result;
-    result.reserve(std::min<std::size_t>(128, maxLen)); // Preallocate small buffer
+    if (maxLen < delimiter.size())
+    {
+        throw SocketException(std::string(caller) + ": maxLen must be at least the delimiter length.");
+    }
 
-    std::size_t totalRead = 0;
+    const std::size_t m = delimiter.size();
+
+    // Number of start positions (relative to the first unread byte) already known not to begin a delimiter match.
+    // A partial match at the end of the window is rescanned only for its last m - 1 bytes.
+    std::size_t scanned = 0;
 
-    while (totalRead < maxLen)
+    while (true)
     {
-        const std::size_t toRead = (std::min) (_internalBuffer.size(), maxLen - totalRead);
-        const auto len = recv(getSocketFd(), _internalBuffer.data(),
-#ifdef _WIN32
-                              static_cast<int>(toRead),
-#else
-                              toRead,
-#endif
-                              0);
+        const char* begin = _internalBuffer.data();
+        const std::size_t window = (std::min) (bufferedBytes(), maxLen);
 
-        if (len == SOCKET_ERROR)
+        if (window >= m)
         {
-            const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            const char* hit = m == 1 ? internal::findByte(begin + scanned, window - scanned, delimiter.front())
+                                     : internal::findPattern(begin + scanned, window - scanned, delimiter);
+            if (hit != nullptr)
+                return static_cast<std::size_t>(hit - begin) + m;
+            scanned = window - m + 1;
         }
 
-        if (len == 0)
-            throw SocketException("readUntil: connection closed before delimiter was found.");
-
-        for (std::size_t i = 0; i < static_cast<std::size_t>(len); ++i)
-        {
-            const char ch = _internalBuffer[i];
-            if (totalRead >= maxLen)
-            {
-                throw SocketException("readUntil: exceeded maximum read limit without finding delimiter.");
-            }
+        if (window == maxLen)
+            throw SocketException(std::string(caller) + ": maximum length reached without finding delimiter.");
 
-            result.push_back(ch);
-            ++totalRead;
+        // The pending line fills the whole buffer: grow it (bounded by maxLen) instead of dropping bytes
+        if (_internalBuffer.full())
+            _internalBuffer.setCapacity((std::min) (maxLen, _internalBuffer.capacity() * 2));
 
-            if (ch == delimiter)
-            {
-                if (!includeDelimiter)
-                {
-                    result.pop_back();
-                }
-                return result;
-            }
-        }
+        if (fillInternalBuffer() == 0)
+            throw SocketException(std::string(caller) + ": connection closed before delimiter was found.");
     }
+}
 
-    throw SocketException("readUntil: maximum length reached without finding delimiter.");
+std::string Socket::readUntil(const std::string_view delimiter, const std::size_t maxLen, const bool includeDelimiter)
+{
+    const std::size_t lineLen = bufferUntil(delimiter, maxLen, "readUntil");
+    std::string result(_internalBuffer.data(), includeDelimiter ? lineLen : lineLen - delimiter.size());
+    _internalBuffer.consume(lineLen);
+    return result;
 }
 
-std::string Socket::readAtMost(std::size_t n) const
+template <typename String> String Socket::readAtMostAs(const std::size_t n, String result) const
 {
     if (n == 0)
     {
         // Nothing to read, return empty string immediately
-        return {};
+        return result;
     }
 
-    std::string result(n, '\0'); // Preallocate n bytes initialized to null
+    result.resize(n); // Preallocate n bytes initialized to null
+
+    if (const std::size_t buffered = consumeBuffered(result.data(), n); buffered > 0)
+    {
+        result.resize(buffered);
+        return result;
+    }
 
     const auto len = recv(getSocketFd(), result.data(),
 #ifdef _WIN32
@@ -617,7 +782,7 @@ std::string Socket::readAtMost(std::size_t n) const
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (len == 0)
@@ -629,7 +794,17 @@ std::string Socket::readAtMost(std::size_t n) const
     return result;
 }
 
-std::size_t Socket::readIntoInternal(void* buffer, std::size_t len, const bool exact) const
+std::string Socket::readAtMost(const std::size_t n) const
+{
+    return readAtMostAs(n, std::string{});
+}
+
+std::pmr::string Socket::readAtMost(const std::size_t n, std::pmr::memory_resource* resource) const
+{
+    return readAtMostAs(n, std::pmr::string(resourceOr(resource)));
+}
+
+std::size_t Socket::readIntoInternal(void* buffer, const std::size_t len, const bool exact) const
 {
     if (buffer == nullptr || len == 0)
         return 0;
@@ -639,45 +814,93 @@ std::size_t Socket::readIntoInternal(void* buffer, std::size_t len, const bool e
 
     do
     {
-        const auto bytesRead = recv(getSocketFd(), out + totalRead,
-#ifdef _WIN32
-                                    static_cast<int>(len - totalRead),
-#else
-                                    len - totalRead,
-#endif
-                                    0);
-
-        if (bytesRead == SOCKET_ERROR)
-        {
-            const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
-        }
-
-        if (bytesRead == 0)
+        const IoResult result = tryReadInto(out + totalRead, len - totalRead);
+        if (result.closed())
         {
             if (exact)
                 throw SocketException("Connection closed before full read completed.");
             break; // return what we got so far
         }
-
-        totalRead += static_cast<std::size_t>(bytesRead);
+        totalRead += result.valueOrThrow();
     } while (exact && totalRead < len);
 
     return totalRead;
 }
 
+IoResult Socket::tryReadInto(void* buffer, const std::size_t len) const noexcept
+{
+    if (buffer == nullptr || len == 0)
+        return {};
+
+    const auto out = static_cast<char*>(buffer);
+
+    // Buffered bytes satisfy the call without another syscall
+    if (const std::size_t buffered = consumeBuffered(out, len); buffered > 0)
+        return {buffered};
+
+    if (len >= _internalBuffer.capacity())
+    {
+        // Large request: receive straight into the caller's memory to avoid a second copy
+        const auto bytesRead = recv(getSocketFd(), out,
+#ifdef _WIN32
+                                    static_cast<int>(len),
+#else
+                                    len,
+#endif
+                                    0);
+        if (bytesRead == SOCKET_ERROR)
+            return IoResult::failure(GetSocketError());
+        if (bytesRead == 0)
+            return IoResult::endOfStream();
+        return {static_cast<std::size_t>(bytesRead)};
+    }
+
+    // Small request: one recv() into the (now empty) internal buffer may satisfy several subsequent reads
+    std::span<char> space;
+    try
+    {
+        space = _internalBuffer.prepare();
+    }
+    catch (const std::bad_alloc&)
+    {
+        return IoResult::failure(ENOMEM);
+    }
+    const auto bytesRead = recv(getSocketFd(), space.data(),
+#ifdef _WIN32
+                                static_cast<int>(space.size()),
+#else
+                                space.size(),
+#endif
+                                0);
+    if (bytesRead == SOCKET_ERROR)
+    {
+        const int error = GetSocketError();
+        _internalBuffer.commit(0);
+        return IoResult::failure(error);
+    }
+    _internalBuffer.commit(static_cast<std::size_t>(bytesRead));
+    if (bytesRead == 0)
+        return IoResult::endOfStream();
+    return {consumeBuffered(out, len)};
+}
+
 std::string Socket::readAtMostWithTimeout(std::size_t n, const int timeoutMillis) const
 {
     if (n == 0)
         return {};
 
     if (!waitReady(false /* forRead */, timeoutMillis))
-        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                     "Read timed out after waiting " + std::to_string(timeoutMillis) + " ms");
+        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Read timed out");
 
     std::string result;
     result.resize(n); // max allocation
 
+    if (const std::size_t buffered = consumeBuffered(result.data(), n); buffered > 0)
+    {
+        result.resize(buffered);
+        return result;
+    }
+
     const auto len = recv(getSocketFd(), result.data(),
 #ifdef _WIN32
                           static_cast<int>(n),
@@ -689,7 +912,7 @@ std::string Socket::readAtMostWithTimeout(std::size_t n, const int timeoutMillis
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (len == 0)
@@ -699,7 +922,7 @@ std::string Socket::readAtMostWithTimeout(std::size_t n, const int timeoutMillis
     return result;
 }
 
-std::string Socket::readAvailable() const
+template <typename String> String Socket::readAvailableAs(String result) const
 {
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("readAvailable() called on invalid socket");
@@ -709,44 +932,60 @@ std::string Socket::readAvailable() const
     if (ioctlsocket(getSocketFd(), FIONREAD, &bytesAvailable) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #else
     int bytesAvailable = 0;
     if (ioctl(getSocketFd(), FIONREAD, &bytesAvailable) < 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #endif
 
-    if (bytesAvailable <= 0)
-        return {};
+    const std::size_t buffered = bufferedBytes();
+    const std::size_t pending = bytesAvailable > 0 ? static_cast<std::size_t>(bytesAvailable) : 0;
 
-    std::string result;
-    result.resize(static_cast<std::size_t>(bytesAvailable));
+    if (buffered + pending == 0)
+        return result;
 
-    const auto len = recv(getSocketFd(), result.data(),
+    result.resize(buffered + pending);
+    consumeBuffered(result.data(), buffered);
+
+    if (pending == 0)
+        return result;
+
+    const auto len = recv(getSocketFd(), result.data() + buffered,
 #ifdef _WIN32
-                          static_cast<int>(bytesAvailable),
+                          static_cast<int>(pending),
 #else
-                          static_cast<std::size_t>(bytesAvailable),
+                          pending,
 #endif
                           0);
 
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
-    if (len == 0)
+    if (len == 0 && buffered == 0)
         throw SocketException("Connection closed while attempting to read available data.");
 
-    result.resize(static_cast<std::size_t>(len)); // shrink to actual read
+    result.resize(buffered + static_cast<std::size_t>(len)); // shrink to actual read
     return result;
 }
 
+std::string Socket::readAvailable() const
+{
+    return readAvailableAs(std::string{});
+}
+
+std::pmr::string Socket::readAvailable(std::pmr::memory_resource* resource) const
+{
+    return readAvailableAs(std::pmr::string(resourceOr(resource)));
+}
+
 std::size_t Socket::readIntoAvailable(void* buffer, const std::size_t bufferSize) const
 {
     if (getSocketFd() == INVALID_SOCKET)
@@ -755,19 +994,22 @@ std::size_t Socket::readIntoAvailable(void* buffer, const std::size_t bufferSize
     if (buffer == nullptr || bufferSize == 0)
         return 0;
 
+    if (const std::size_t buffered = consumeBuffered(buffer, bufferSize); buffered > 0)
+        return buffered;
+
 #ifdef _WIN32
     u_long bytesAvailable = 0;
     if (ioctlsocket(getSocketFd(), FIONREAD, &bytesAvailable) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #else
     int bytesAvailable = 0;
     if (ioctl(getSocketFd(), FIONREAD, &bytesAvailable) < 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #endif
 
@@ -787,7 +1029,7 @@ std::size_t Socket::readIntoAvailable(void* buffer, const std::size_t bufferSize
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (len == 0)
@@ -796,36 +1038,115 @@ std::size_t Socket::readIntoAvailable(void* buffer, const std::size_t bufferSize
     return static_cast<std::size_t>(len);
 }
 
-std::string Socket::peek(std::size_t n) const
+template <typename String> String Socket::peekAs(const std::size_t n, String result) const
 {
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("peek() called on invalid socket");
 
     if (n == 0)
-        return {};
+        return result;
 
-    std::string result;
-    result.resize(n);
-
-    const auto len = recv(getSocketFd(), result.data(),
+    // Peeked bytes are pulled into the internal buffer, so the next read returns them without a syscall.
+    // Only block when nothing is buffered; otherwise top up only if the kernel already holds more data.
+    if (bufferedBytes() == 0)
+    {
+        if (fillInternalBuffer() == 0)
+            throw SocketException("Connection closed during peek operation.");
+    }
+    else if (bufferedBytes() < n && !_internalBuffer.full())
+    {
 #ifdef _WIN32
-                          static_cast<int>(n),
+        u_long pending = 0;
+        const bool morePending = ioctlsocket(getSocketFd(), FIONREAD, &pending) == 0 && pending > 0;
 #else
-                          n,
+        int pending = 0;
+        const bool morePending = ioctl(getSocketFd(), FIONREAD, &pending) == 0 && pending > 0;
 #endif
-                          MSG_PEEK);
+        if (morePending)
+            fillInternalBuffer();
+    }
 
-    if (len == SOCKET_ERROR)
+    result.assign(_internalBuffer.data(), (std::min) (n, bufferedBytes()));
+    return result;
+}
+
+std::string Socket::peek(const std::size_t n) const
+{
+    return peekAs(n, std::string{});
+}
+
+std::pmr::string Socket::peek(const std::size_t n, std::pmr::memory_resource* resource) const
+{
+    return peekAs(n, std::pmr::string(resourceOr(resource)));
+}
+
+std::string_view Socket::viewExact(const std::size_t n) const
+{
+    if (n == 0)
+        return {};
+
+    // A frame larger than the buffer grows it, as readUntil() does for long lines
+    if (n > _internalBuffer.capacity())
+        _internalBuffer.setCapacity(n);
+
+    while (bufferedBytes() < n)
     {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        if (fillInternalBuffer() == 0)
+            throw SocketException("viewExact: connection closed before all bytes were received.");
     }
+    return {_internalBuffer.data(), n};
+}
 
-    if (len == 0)
-        throw SocketException("Connection closed during peek operation.");
+std::string_view Socket::viewAtMost(const std::size_t n) const
+{
+    if (n == 0)
+        return {};
 
-    result.resize(static_cast<std::size_t>(len)); // trim to actual
-    return result;
+    if (bufferedBytes() == 0 && fillInternalBuffer() == 0)
+        throw SocketException("viewAtMost: connection closed by remote host.");
+
+    return {_internalBuffer.data(), (std::min) (n, bufferedBytes())};
+}
+
+std::string_view Socket::viewUntil(const std::string_view delimiter, const std::size_t maxLen) const
+{
+    const std::size_t lineLen = bufferUntil(delimiter, maxLen, "viewUntil"); // may move the buffered bytes
+    return {_internalBuffer.data(), lineLen};
+}
+
+std::string_view Socket::viewAvailable() const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("viewAvailable() called on invalid socket");
+
+    if (!_internalBuffer.full())
+    {
+#ifdef _WIN32
+        u_long pending = 0;
+        if (ioctlsocket(getSocketFd(), FIONREAD, &pending) != 0)
+#else
+        int pending = 0;
+        if (ioctl(getSocketFd(), FIONREAD, &pending) < 0)
+#endif
+        {
+            const int error = GetSocketError();
+            throw SocketException(error);
+        }
+        if (pending > 0)
+            fillInternalBuffer();
+    }
+
+    if (bufferedBytes() == 0)
+        return {};
+    return {_internalBuffer.data(), bufferedBytes()};
+}
+
+void Socket::consume(const std::size_t n) const
+{
+    if (n > bufferedBytes())
+        throw SocketException("consume: more bytes than are buffered.");
+
+    _internalBuffer.consume(n);
 }
 
 void Socket::discard(const std::size_t n, const std::size_t chunkSize /* = 1024 */) const
@@ -839,8 +1160,14 @@ void Socket::discard(const std::size_t n, const std::size_t chunkSize /* = 1024
     if (chunkSize == 0)
         throw SocketException("discard(): chunkSize must be greater than zero.");
 
-    std::vector<char> tempBuffer(chunkSize); // Heap-allocated scratch buffer
-    std::size_t totalDiscarded = 0;
+    // Drop buffered bytes first; they precede anything still queued in the kernel
+    std::size_t totalDiscarded = (std::min) (n, bufferedBytes());
+    _internalBuffer.consume(totalDiscarded);
+
+    if (totalDiscarded == n)
+        return;
+
+    std::pmr::vector<char> tempBuffer(chunkSize, _memoryResource); // Scratch buffer from getMemoryResource()
 
     while (totalDiscarded < n)
     {
@@ -857,7 +1184,7 @@ void Socket::discard(const std::size_t n, const std::size_t chunkSize /* = 1024
         if (len == SOCKET_ERROR)
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
 
         if (len == 0)
@@ -874,91 +1201,24 @@ std::size_t Socket::writev(std::span<const std::string_view> buffers) const
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("writev() called on invalid socket");
 
-#ifdef _WIN32
-    // Convert to WSABUF
-    std::vector<WSABUF> wsabufs;
-    wsabufs.reserve(buffers.size());
-
-    for (const auto& buf : buffers)
-    {
-        WSABUF w;
-        w.buf = const_cast<char*>(buf.data()); // WSABUF is not const-correct
-        w.len = static_cast<ULONG>(buf.size());
-        wsabufs.push_back(w);
-    }
-
-    DWORD bytesSent = 0;
-    if (const int result =
-            WSASend(getSocketFd(), wsabufs.data(), static_cast<DWORD>(wsabufs.size()), &bytesSent, 0, nullptr, nullptr);
-        result == SOCKET_ERROR)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-
-    return static_cast<std::size_t>(bytesSent);
-
-#else
-    // POSIX: use writev
-    std::vector<iovec> iovecs;
-    iovecs.reserve(buffers.size());
-
-    for (const auto& buf : buffers)
-    {
-        iovec io{};
-        io.iov_base = const_cast<char*>(buf.data()); // iovec is not const-correct either
-        io.iov_len = buf.size();
-        iovecs.push_back(io);
-    }
-
-    ssize_t bytesSent = ::writev(getSocketFd(), iovecs.data(), static_cast<int>(iovecs.size()));
-    if (bytesSent == -1)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-
-    return static_cast<std::size_t>(bytesSent);
-#endif
+    // Lists longer than IoVecMax are sent up to that many entries at a time
+    internal::IoVecCursor cursor(buffers);
+    return internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
 }
 
 std::size_t Socket::writevAll(std::span<const std::string_view> buffers) const
 {
-    std::vector remainingBuffers(buffers.begin(), buffers.end());
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("writevAll() called on invalid socket");
+
+    internal::IoVecCursor cursor(buffers);
     std::size_t totalSent = 0;
 
-    while (!remainingBuffers.empty())
+    while (!cursor.done())
     {
-        const std::size_t bytesSent = writev(remainingBuffers);
+        const std::size_t bytesSent = internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalSent += bytesSent;
-
-        std::size_t advanced = 0;
-        std::size_t remaining = bytesSent;
-
-        // Count how many buffers were fully sent
-        for (const auto& buf : remainingBuffers)
-        {
-            if (remaining >= buf.size())
-            {
-                remaining -= buf.size();
-                ++advanced;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        // Erase fully sent buffers
-        remainingBuffers.erase(remainingBuffers.begin(),
-                               remainingBuffers.begin() +
-                                   static_cast<std::vector<std::string_view>::difference_type>(advanced));
-
-        // Adjust the partially sent first buffer
-        if (!remainingBuffers.empty() && remaining > 0)
-        {
-            remainingBuffers[0] = remainingBuffers[0].substr(remaining);
-        }
+        cursor.advance(bytesSent); // skips fully sent buffers and trims a partially sent one in place
     }
 
     return totalSent;
@@ -973,8 +1233,7 @@ std::size_t Socket::writeAtMostWithTimeout(std::string_view data, const int time
         return 0;
 
     if (!waitReady(true /* forWrite */, timeoutMillis))
-        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE,
-                                     "Write timed out after " + std::to_string(timeoutMillis) + " ms");
+        throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Write timed out");
 
     const auto len = send(getSocketFd(),
 #ifdef _WIN32
@@ -987,7 +1246,7 @@ std::size_t Socket::writeAtMostWithTimeout(std::string_view data, const int time
     if (len == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
     if (len == 0)
         throw SocketException("Connection closed while writing.");
@@ -1016,7 +1275,7 @@ std::size_t Socket::writeFrom(const void* data, std::size_t len) const
     if (sent == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (sent == 0)
@@ -1051,7 +1310,7 @@ std::size_t Socket::writeFromAll(const void* data, const std::size_t len) const
         if (sent == SOCKET_ERROR)
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
         if (sent == 0)
             throw SocketException("Connection closed during writeFromAll().");
@@ -1062,6 +1321,166 @@ std::size_t Socket::writeFromAll(const void* data, const std::size_t len) const
     return totalSent;
 }
 
+#if defined(__linux__)
+void Socket::setZeroCopy(const bool enable)
+{
+    setOption(SOL_SOCKET, SO_ZEROCOPY, enable ? 1 : 0);
+    _zeroCopy.enabled = enable;
+    _zeroCopy.active = enable;
+}
+#endif
+
+std::uint32_t Socket::writeZeroCopy(const std::string_view data) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("writeZeroCopy() called on invalid socket");
+
+#if defined(__linux__)
+    if (_zeroCopy.active)
+    {
+        std::size_t totalSent = 0;
+        while (totalSent < data.size())
+        {
+            const auto sent = ::send(getSocketFd(), data.data() + totalSent, data.size() - totalSent,
+                                     MSG_ZEROCOPY | MSG_NOSIGNAL);
+            if (sent == SOCKET_ERROR)
+            {
+                const int error = GetSocketError();
+                // ENOBUFS: too many notifications outstanding (optmem limit); collect some and retry
+                if (error == ENOBUFS && _zeroCopy.done != _zeroCopy.sent)
+                {
+                    waitZeroCopy(_zeroCopy.done + 1);
+                    continue;
+                }
+                throw SocketException(error);
+            }
+            if (sent == 0)
+                throw SocketException("Connection closed during writeZeroCopy()");
+
+            ++_zeroCopy.sent; // the kernel numbers every successful MSG_ZEROCOPY send
+            totalSent += static_cast<std::size_t>(sent);
+        }
+        (void) reapZeroCopyCompletions();
+        return _zeroCopy.sent;
+    }
+#endif
+
+    (void) writeAll(data);
+    return _zeroCopy.sent;
+}
+
+bool Socket::isZeroCopyComplete(const std::uint32_t ticket) const
+{
+    const auto reached = [&] { return static_cast<std::int32_t>(_zeroCopy.done - ticket) >= 0; };
+    if (reached())
+        return true;
+    (void) reapZeroCopyCompletions();
+    return reached();
+}
+
+void Socket::waitZeroCopy(const std::uint32_t ticket, const int timeoutMillis) const
+{
+    const auto deadline = internal::Deadline::after(timeoutMillis);
+    while (!isZeroCopyComplete(ticket))
+    {
+#if defined(__linux__)
+        // Notifications are signalled as POLLERR, which poll() reports without being asked for
+        const short revents = internal::pollUntil(getSocketFd(), 0, deadline);
+        if (revents == 0)
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Zero-copy completion timed out");
+        if ((revents & POLLNVAL) != 0)
+            throw SocketException("waitZeroCopy(): socket descriptor is no longer valid.");
+
+        // A hang-up or socket error with nothing on the error queue would make poll() return at once forever
+        if ((revents & (POLLHUP | POLLERR)) != 0 && !reapZeroCopyCompletions())
+        {
+            int error = 0;
+            socklen_t len = sizeof(error);
+            (void) ::getsockopt(getSocketFd(), SOL_SOCKET, SO_ERROR, &error, &len);
+            if (error != 0)
+                throw SocketException(error, "waitZeroCopy(): connection failed before the ticket completed");
+            throw SocketException("waitZeroCopy(): connection closed before the ticket completed.");
+        }
+#else
+        (void) deadline;
+#endif
+    }
+}
+
+bool Socket::reapZeroCopyCompletions() const
+{
+#if defined(__linux__)
+    if (_zeroCopy.sent == _zeroCopy.done)
+        return false;
+
+    // Marks [lo, hi] complete and advances `done` over every contiguous completed range.
+    const auto complete = [this](const std::uint32_t lo, const std::uint32_t hi)
+    {
+        auto& zc = _zeroCopy;
+        if (static_cast<std::int32_t>(lo - zc.done) > 0)
+        {
+            zc.early.emplace_back(lo, hi);
+            return;
+        }
+        if (static_cast<std::int32_t>(hi + 1 - zc.done) > 0)
+            zc.done = hi + 1;
+
+        for (auto it = zc.early.begin(); it != zc.early.end();)
+        {
+            if (static_cast<std::int32_t>(it->first - zc.done) <= 0)
+            {
+                if (static_cast<std::int32_t>(it->second + 1 - zc.done) > 0)
+                    zc.done = it->second + 1;
+                zc.early.erase(it);
+                it = zc.early.begin(); // `done` moved; rescan
+            }
+            else
+                ++it;
+        }
+    };
+
+    bool any = false;
+    for (;;)
+    {
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+        msghdr msg{};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        if (::recvmsg(getSocketFd(), &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            const int error = GetSocketError();
+            if (error == EINTR)
+                continue;
+            if (error == EAGAIN || error == EWOULDBLOCK)
+                break;
+            throw SocketException(error);
+        }
+        any = true;
+
+        for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm))
+        {
+            if (!(cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) &&
+                !(cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR))
+                continue;
+
+            sock_extended_err err{};
+            std::memcpy(&err, CMSG_DATA(cm), sizeof(err));
+            if (err.ee_errno != 0 || err.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                continue;
+
+            // The kernel had to copy after all: pinning pages only costs from here on
+            if ((err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0)
+                _zeroCopy.active = false;
+            complete(err.ee_info, err.ee_data);
+        }
+    }
+    return any;
+#else
+    return false;
+#endif
+}
+
 std::size_t Socket::writeWithTotalTimeout(const std::string_view data, const int timeoutMillis) const
 {
     if (getSocketFd() == INVALID_SOCKET)
@@ -1074,19 +1493,16 @@ std::size_t Socket::writeWithTotalTimeout(const std::string_view data, const int
     std::size_t totalSent = 0;
     std::size_t remaining = data.size();
 
-    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMillis);
+    // A negative total timeout leaves no time at all, as before
+    const auto deadline = internal::Deadline::after((std::max) (timeoutMillis, 0));
 
     while (remaining > 0)
     {
-        auto now = std::chrono::steady_clock::now();
-        if (now >= deadline)
+        if (deadline.expired())
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Write operation timed out before completing");
 
-        if (const auto remainingTime = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
-            !waitReady(true /* forWrite */, static_cast<int>(remainingTime)))
-        {
+        if (!waitReady(true /* forWrite */, deadline))
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Socket not writable within remaining timeout window");
-        }
 
         const auto sent = send(getSocketFd(),
 #ifdef _WIN32
@@ -1099,7 +1515,7 @@ std::size_t Socket::writeWithTotalTimeout(const std::string_view data, const int
         if (sent == SOCKET_ERROR)
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
         if (sent == 0)
             throw SocketException("Connection closed during timed write.");
@@ -1119,52 +1535,213 @@ std::size_t Socket::writevWithTotalTimeout(std::span<const std::string_view> buf
     if (buffers.empty())
         return 0;
 
-    std::vector pending(buffers.begin(), buffers.end());
+    internal::IoVecCursor cursor(buffers);
     std::size_t totalSent = 0;
 
-    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMillis);
+    // A negative total timeout leaves no time at all, as before
+    const auto deadline = internal::Deadline::after((std::max) (timeoutMillis, 0));
 
-    while (!pending.empty())
+    while (!cursor.done())
     {
-        auto now = std::chrono::steady_clock::now();
-        if (now >= deadline)
+        if (deadline.expired())
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Timeout while writing vectorized buffers");
 
-        if (const auto remainingTime = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
-            !waitReady(true /* forWrite */, static_cast<int>(remainingTime)))
+        if (!waitReady(true /* forWrite */, deadline))
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Socket not writable within remaining timeout");
 
-        const std::size_t bytesSent = writev(pending);
+        const std::size_t bytesSent = internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalSent += bytesSent;
+        cursor.advance(bytesSent);
+    }
+
+    return totalSent;
+}
+
+std::uint64_t Socket::sendFile(const int fileDescriptor, const std::uint64_t offset,
+                               const std::optional<std::uint64_t> length, const SendFileProgress& progress) const
+{
+    return sendFileImpl(fileDescriptor, offset, length, -1, progress);
+}
+
+std::uint64_t Socket::sendFile(const std::string& path, const std::uint64_t offset,
+                               const std::optional<std::uint64_t> length, const SendFileProgress& progress) const
+{
+    const ScopedFile file(path);
+    return sendFileImpl(file.get(), offset, length, -1, progress);
+}
+
+std::uint64_t Socket::sendFileWithTotalTimeout(const int fileDescriptor, const std::uint64_t offset,
+                                               const std::optional<std::uint64_t> length, const int timeoutMillis,
+                                               const SendFileProgress& progress) const
+{
+    return sendFileImpl(fileDescriptor, offset, length, (std::max) (timeoutMillis, 0), progress);
+}
+
+std::uint64_t Socket::sendFileWithTotalTimeout(const std::string& path, const std::uint64_t offset,
+                                               const std::optional<std::uint64_t> length, const int timeoutMillis,
+                                               const SendFileProgress& progress) const
+{
+    const ScopedFile file(path);
+    return sendFileImpl(file.get(), offset, length, (std::max) (timeoutMillis, 0), progress);
+}
+
+std::uint64_t Socket::sendFileImpl(const int fileDescriptor, const std::uint64_t offset,
+                                   const std::optional<std::uint64_t> length, const int timeoutMillis,
+                                   const SendFileProgress& progress) const
+{
+    if (getSocketFd() == INVALID_SOCKET)
+        throw SocketException("sendFile() called on invalid socket");
+    if (fileDescriptor < 0)
+        throw SocketException("sendFile(): invalid file descriptor.");
+
+    std::uint64_t total = 0;
+    if (length)
+    {
+        total = *length;
+    }
+    else
+    {
+#ifdef _WIN32
+        struct _stat64 st{};
+        if (::_fstat64(fileDescriptor, &st) != 0)
+#else
+        struct stat st{};
+        if (::fstat(fileDescriptor, &st) != 0)
+#endif
+            throw fileError("sendFile(): cannot determine file size");
+        const auto size = static_cast<std::uint64_t>(st.st_size);
+        total = size > offset ? size - offset : 0;
+    }
+    if (total == 0)
+        return 0;
+
+    const bool timed = timeoutMillis >= 0;
+    const auto deadline = internal::Deadline::after(timeoutMillis);
+
+    // Blocks until writable: bounded by the deadline when timed, indefinitely otherwise.
+    const auto awaitWritable = [&]
+    {
+        if (deadline.expired())
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "sendFile() timed out before completing");
+        if (!waitReady(true /* forWrite */, deadline))
+            throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Socket not writable within remaining timeout window");
+    };
+
+    const auto isWouldBlock = [](const int error)
+    {
+#ifdef _WIN32
+        return error == WSAEWOULDBLOCK;
+#else
+        return error == EAGAIN || error == EWOULDBLOCK;
+#endif
+    };
 
-        // Determine how many buffers were fully sent
-        std::size_t advanced = 0;
-        std::size_t left = bytesSent;
+    std::uint64_t sent = 0;
 
-        for (const auto& buf : pending)
+#if defined(__linux__)
+    {
+        const internal::SigpipeGuard noSigpipe;
+        bool useSendfile = true;
+        while (useSendfile && sent < total)
         {
-            if (left >= buf.size())
-            {
-                left -= buf.size();
-                ++advanced;
-            }
-            else
+            if (timed)
+                awaitWritable();
+
+            // sendfile() transfers at most 0x7ffff000 bytes per call
+            constexpr std::uint64_t maxChunk = 0x7ffff000;
+            auto fileOffset = static_cast<off_t>(offset + sent);
+            const auto n = ::sendfile(getSocketFd(), fileDescriptor, &fileOffset,
+                                      static_cast<std::size_t>((std::min) (total - sent, maxChunk)));
+            if (n < 0)
             {
-                break;
+                const int error = errno;
+                if (error == EINTR)
+                    continue;
+                if (isWouldBlock(error))
+                {
+                    if (!timed)
+                        awaitWritable();
+                    continue;
+                }
+                if (error == EINVAL || error == ENOSYS)
+                {
+                    useSendfile = false; // this file cannot be spliced; copy the rest through user space
+                    break;
+                }
+                throw SocketException(error);
             }
+            if (n == 0)
+                throw SocketException("sendFile(): file ended before the requested length was sent.");
+
+            sent += static_cast<std::uint64_t>(n);
+            if (progress)
+                progress(sent, total);
         }
+        if (sent == total)
+            return sent;
+    }
+#endif
 
-        pending.erase(pending.begin(),
-                      pending.begin() + static_cast<std::vector<std::string_view>::difference_type>(advanced));
+    // Portable path: read a chunk, send it fully, repeat.
+    std::pmr::vector<char> chunk(static_cast<std::size_t>((std::min) (total - sent, std::uint64_t{SendFileChunk})),
+                                 _memoryResource);
+    while (sent < total)
+    {
+        const auto want = static_cast<std::size_t>((std::min) (total - sent, std::uint64_t{chunk.size()}));
+#ifdef _WIN32
+        if (::_lseeki64(fileDescriptor, static_cast<__int64>(offset + sent), SEEK_SET) < 0)
+            throw fileError("sendFile(): seek failed");
+        const int got = ::_read(fileDescriptor, chunk.data(), static_cast<unsigned>(want));
+#else
+        const auto got = ::pread(fileDescriptor, chunk.data(), want, static_cast<off_t>(offset + sent));
+#endif
+        if (got < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw fileError("sendFile(): read failed");
+        }
+        if (got == 0)
+            throw SocketException("sendFile(): file ended before the requested length was sent.");
 
-        // Adjust the partially sent buffer
-        if (!pending.empty() && left > 0)
+        std::size_t chunkSent = 0;
+        while (chunkSent < static_cast<std::size_t>(got))
         {
-            pending[0] = pending[0].substr(left);
+            if (timed)
+                awaitWritable();
+
+            int flags = 0;
+#ifndef _WIN32
+            flags = MSG_NOSIGNAL;
+#endif
+            const auto n = ::send(getSocketFd(), chunk.data() + chunkSent,
+#ifdef _WIN32
+                                  static_cast<int>(static_cast<std::size_t>(got) - chunkSent),
+#else
+                                  static_cast<std::size_t>(got) - chunkSent,
+#endif
+                                  flags);
+            if (n == SOCKET_ERROR)
+            {
+                const int error = GetSocketError();
+                if (isWouldBlock(error))
+                {
+                    if (!timed)
+                        awaitWritable();
+                    continue;
+                }
+                throw SocketException(error);
+            }
+            if (n == 0)
+                throw SocketException("Connection closed during sendFile().");
+            chunkSent += static_cast<std::size_t>(n);
         }
-    }
 
-    return totalSent;
+        sent += static_cast<std::uint64_t>(got);
+        if (progress)
+            progress(sent, total);
+    }
+    return sent;
 }
 
 std::size_t Socket::readv(std::span<BufferView> buffers) const
@@ -1175,37 +1752,22 @@ std::size_t Socket::readv(std::span<BufferView> buffers) const
     if (buffers.empty())
         return 0;
 
-#ifdef _WIN32
-    auto wsaBufs = internal::toWSABUF(buffers);
-
-    DWORD bytesReceived = 0;
-    DWORD flags = 0;
-    const int result = WSARecv(getSocketFd(), wsaBufs.data(), static_cast<DWORD>(wsaBufs.size()), &bytesReceived,
-                               &flags, nullptr, nullptr);
-    if (result == SOCKET_ERROR)
+    // Scatter already-buffered bytes first; like readInto(), this satisfies the call without a syscall
+    if (bufferedBytes() > 0)
     {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-    if (bytesReceived == 0)
-        throw SocketException("Connection closed during readv().");
-
-    return static_cast<std::size_t>(bytesReceived);
-
-#else
-    const auto ioVecs = internal::toIOVec(buffers);
-    const ssize_t bytes = ::readv(getSocketFd(), ioVecs.data(), static_cast<int>(ioVecs.size()));
-    if (bytes < 0)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        std::size_t copied = 0;
+        for (const auto& [data, size] : buffers)
+        {
+            const std::size_t got = consumeBuffered(data, size);
+            copied += got;
+            if (got < size)
+                break;
+        }
+        return copied;
     }
 
-    if (bytes == 0)
-        throw SocketException("Connection closed during readv().");
-
-    return static_cast<std::size_t>(bytes);
-#endif
+    internal::IoVecCursor cursor(buffers);
+    return recvIoVecs(getSocketFd(), cursor.data(), cursor.size());
 }
 
 std::size_t Socket::readvAll(std::span<BufferView> buffers) const
@@ -1213,41 +1775,16 @@ std::size_t Socket::readvAll(std::span<BufferView> buffers) const
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("readvAll() called on invalid socket");
 
-    std::vector pending(buffers.begin(), buffers.end());
-    std::size_t totalRead = 0;
+    // Already-buffered bytes go first, exactly as readv() places them
+    std::size_t totalRead = bufferedBytes() > 0 ? readv(buffers) : 0;
+    internal::IoVecCursor cursor(buffers);
+    cursor.advance(totalRead);
 
-    while (!pending.empty())
+    while (!cursor.done())
     {
-        const std::size_t bytesRead = readv(pending);
+        const std::size_t bytesRead = recvIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalRead += bytesRead;
-
-        // Advance through fully read buffers
-        std::size_t advanced = 0;
-        std::size_t left = bytesRead;
-
-        for (const auto& [data, size] : pending)
-        {
-            if (left >= size)
-            {
-                left -= size;
-                ++advanced;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        pending.erase(pending.begin(),
-                      pending.begin() + static_cast<std::vector<BufferView>::difference_type>(advanced));
-
-        // Adjust partially read buffer
-        if (!pending.empty() && left > 0)
-        {
-            auto& [data, size] = pending[0];
-            data = static_cast<std::byte*>(data) + left;
-            size -= left;
-        }
+        cursor.advance(bytesRead);
     }
 
     return totalRead;
@@ -1261,50 +1798,25 @@ std::size_t Socket::readvAllWithTotalTimeout(std::span<BufferView> buffers, cons
     if (buffers.empty())
         return 0;
 
-    std::vector pending(buffers.begin(), buffers.end());
-    std::size_t totalRead = 0;
+    // Already-buffered bytes go first, exactly as readv() places them
+    std::size_t totalRead = bufferedBytes() > 0 ? readv(buffers) : 0;
+    internal::IoVecCursor cursor(buffers);
+    cursor.advance(totalRead);
 
-    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMillis);
+    // A negative total timeout leaves no time at all, as before
+    const auto deadline = internal::Deadline::after((std::max) (timeoutMillis, 0));
 
-    while (!pending.empty())
+    while (!cursor.done())
     {
-        auto now = std::chrono::steady_clock::now();
-        if (now >= deadline)
+        if (deadline.expired())
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Timeout while reading into vector buffers");
 
-        if (const auto timeLeft = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
-            !waitReady(false /* forRead */, static_cast<int>(timeLeft)))
+        if (!waitReady(false /* forRead */, deadline))
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Socket not readable within timeout");
 
-        const std::size_t bytesRead = readv(pending);
+        const std::size_t bytesRead = recvIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalRead += bytesRead;
-
-        // Advance through fully read buffers
-        std::size_t advanced = 0;
-        std::size_t left = bytesRead;
-
-        for (const auto& [data, size] : pending)
-        {
-            if (left >= size)
-            {
-                left -= size;
-                ++advanced;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        pending.erase(pending.begin(),
-                      pending.begin() + static_cast<std::vector<BufferView>::difference_type>(advanced));
-
-        // Adjust the partially filled buffer
-        if (!pending.empty() && left > 0)
-        {
-            pending[0].data = static_cast<std::byte*>(pending[0].data) + left;
-            pending[0].size -= left;
-        }
+        cursor.advance(bytesRead);
     }
 
     return totalRead;
@@ -1332,32 +1844,8 @@ std::size_t Socket::writevFrom(std::span<const BufferView> buffers) const
     if (buffers.empty())
         return 0;
 
-#ifdef _WIN32
-    auto wsaBufs = internal::toWSABUF(buffers);
-
-    DWORD bytesSent = 0;
-    if (const int result =
-            WSASend(getSocketFd(), wsaBufs.data(), static_cast<DWORD>(wsaBufs.size()), &bytesSent, 0, nullptr, nullptr);
-        result == SOCKET_ERROR)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-
-    return static_cast<std::size_t>(bytesSent);
-
-#else
-    const auto ioVecs = internal::toIOVec(buffers);
-
-    const ssize_t written = ::writev(getSocketFd(), ioVecs.data(), static_cast<int>(ioVecs.size()));
-    if (written < 0)
-    {
-        const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
-    }
-
-    return static_cast<std::size_t>(written);
-#endif
+    internal::IoVecCursor cursor(buffers);
+    return internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
 }
 
 std::size_t Socket::writevFromAll(std::span<BufferView> buffers) const
@@ -1365,39 +1853,14 @@ std::size_t Socket::writevFromAll(std::span<BufferView> buffers) const
     if (getSocketFd() == INVALID_SOCKET)
         throw SocketException("writevFromAll() called on invalid socket");
 
-    std::vector pending(buffers.begin(), buffers.end());
+    internal::IoVecCursor cursor(buffers);
     std::size_t totalSent = 0;
 
-    while (!pending.empty())
+    while (!cursor.done())
     {
-        const std::size_t bytesSent = writevFrom(pending);
+        const std::size_t bytesSent = internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalSent += bytesSent;
-
-        std::size_t advanced = 0;
-        std::size_t remaining = bytesSent;
-
-        for (const auto& [data, size] : pending)
-        {
-            if (remaining >= size)
-            {
-                remaining -= size;
-                ++advanced;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        pending.erase(pending.begin(),
-                      pending.begin() + static_cast<std::vector<BufferView>::difference_type>(advanced));
-
-        // Adjust first partially sent buffer
-        if (!pending.empty() && remaining > 0)
-        {
-            pending[0].data = static_cast<std::byte*>(pending[0].data) + remaining;
-            pending[0].size -= remaining;
-        }
+        cursor.advance(bytesSent);
     }
 
     return totalSent;
@@ -1411,48 +1874,23 @@ std::size_t Socket::writevFromWithTotalTimeout(std::span<BufferView> buffers, co
     if (buffers.empty())
         return 0;
 
-    std::vector pending(buffers.begin(), buffers.end());
+    internal::IoVecCursor cursor(buffers);
     std::size_t totalSent = 0;
 
-    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMillis);
+    // A negative total timeout leaves no time at all, as before
+    const auto deadline = internal::Deadline::after((std::max) (timeoutMillis, 0));
 
-    while (!pending.empty())
+    while (!cursor.done())
     {
-        auto now = std::chrono::steady_clock::now();
-        if (now >= deadline)
+        if (deadline.expired())
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Timeout while writing binary buffers");
 
-        if (const auto remainingTime = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
-            !waitReady(true /* forWrite */, static_cast<int>(remainingTime)))
+        if (!waitReady(true /* forWrite */, deadline))
             throw SocketTimeoutException(JSOCKETPP_TIMEOUT_CODE, "Socket not writable within remaining timeout");
 
-        const std::size_t bytesSent = writevFrom(pending);
+        const std::size_t bytesSent = internal::sendIoVecs(getSocketFd(), cursor.data(), cursor.size());
         totalSent += bytesSent;
-
-        std::size_t advanced = 0;
-        std::size_t left = bytesSent;
-
-        for (const auto& [data, size] : pending)
-        {
-            if (left >= size)
-            {
-                left -= size;
-                ++advanced;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        pending.erase(pending.begin(),
-                      pending.begin() + static_cast<std::vector<BufferView>::difference_type>(advanced));
-
-        if (!pending.empty() && left > 0)
-        {
-            pending[0].data = static_cast<std::byte*>(pending[0].data) + left;
-            pending[0].size -= left;
-        }
+        cursor.advance(bytesSent);
     }
 
     return totalSent;
@@ -36,7 +36,7 @@ void SocketOptions::setOption(const int level, const int optName, const void* va
                      len) < 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
@@ -66,7 +66,7 @@ void SocketOptions::getOption(const int level, const int optName, void* result,
                      len) < 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
@@ -230,7 +230,7 @@ void SocketOptions::setNonBlocking(bool nonBlocking)
     if (::ioctlsocket(_sockFd, FIONBIO, &mode) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #else
     int flags = ::fcntl(_sockFd, F_GETFL, 0);
@@ -293,7 +293,7 @@ void SocketOptions::setIPv6Only(const bool enable)
     if (::getsockname(_sockFd, reinterpret_cast<sockaddr*>(&ss), &len) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (ss.ss_family != AF_INET6)
@@ -312,7 +312,7 @@ bool SocketOptions::getIPv6Only() const
     if (::getsockname(_sockFd, reinterpret_cast<sockaddr*>(&ss), &len) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (ss.ss_family != AF_INET6)
@@ -337,12 +337,26 @@ bool SocketOptions::getReusePort() const
 
 #endif
 
+#if defined(SO_INCOMING_CPU)
+
+void SocketOptions::setIncomingCpu(const int cpu)
+{
+    setOption(SOL_SOCKET, SO_INCOMING_CPU, cpu);
+}
+
+int SocketOptions::getIncomingCpu() const
+{
+    return getOption(SOL_SOCKET, SO_INCOMING_CPU);
+}
+
+#endif
+
 [[nodiscard]] int SocketOptions::detectFamily(const SOCKET fd)
 {
 #if defined(_WIN32)
     if (fd == INVALID_SOCKET)
     {
-        throw SocketException(WSAENOTSOCK, SocketErrorMessage(WSAENOTSOCK));
+        throw SocketException(WSAENOTSOCK);
     }
 #else
     if (fd < 0)
@@ -379,7 +393,7 @@ bool SocketOptions::getReusePort() const
     if (::getsockname(fd, reinterpret_cast<sockaddr*>(&ss), &len) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     family = ss.ss_family;
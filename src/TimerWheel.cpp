@@ -0,0 +1,259 @@
+#include "jsocketpp/TimerWheel.hpp"
+#include "jsocketpp/SocketException.hpp"
+
+#include <algorithm>
+#include <bit>
+
+using namespace jsocketpp;
+
+namespace
+{
+
+constexpr std::uint64_t SlotMask = TimerWheel::Slots - 1;
+
+// Ticks covered by levels [0, level]; a timer this far ahead or more belongs to a higher level
+constexpr std::uint64_t span(const std::size_t level) noexcept
+{
+    return std::uint64_t{1} << (TimerWheel::SlotBits * (level + 1));
+}
+
+// Slot of a timer expiring at `expires` within `level`
+constexpr std::size_t slotIndex(const std::uint64_t expires, const std::size_t level) noexcept
+{
+    return static_cast<std::size_t>((expires >> (TimerWheel::SlotBits * level)) & SlotMask);
+}
+
+} // namespace
+
+void TimerWheel::Timer::cancel() noexcept
+{
+    if (_wheel != nullptr)
+        _wheel->unlink(*this);
+}
+
+TimerWheel::TimerWheel(const Clock::duration tick, const Clock::time_point origin) : _tick(tick), _origin(origin)
+{
+    if (tick <= Clock::duration::zero())
+        throw SocketException("TimerWheel: tick must be positive.");
+}
+
+TimerWheel::~TimerWheel() noexcept
+{
+    for (auto& level : _slots)
+    {
+        for (Node& head : level)
+        {
+            while (head.next != &head)
+                unlink(static_cast<Timer&>(*head.next));
+        }
+    }
+}
+
+void TimerWheel::schedule(Timer& timer, const Clock::time_point deadline)
+{
+    if (timer._wheel != nullptr && timer._wheel != this)
+        throw SocketException("TimerWheel::schedule(): timer is armed on another wheel.");
+
+    if (timer._wheel != nullptr)
+        unlink(timer);
+    timer._wheel = this;
+    timer._expires = ticksAt(deadline, true);
+    ++_count;
+    file(timer);
+}
+
+std::size_t TimerWheel::advance(const Clock::time_point now)
+{
+    const std::uint64_t target = ticksAt(now, false);
+    std::size_t fired = 0;
+
+    while (_next <= target)
+    {
+        if (_count == 0)
+        {
+            _next = target + 1;
+            break;
+        }
+
+        const std::size_t index = slotIndex(_next, 0);
+        if (index == 0)
+        {
+            // The innermost level wrapped around: bring down the next slot of each level that wrapped with it
+            for (std::size_t level = 1; level < Levels; ++level)
+            {
+                cascade(level);
+                if (slotIndex(_next, level) != 0)
+                    break;
+            }
+        }
+
+        // Skip straight to the next non-empty slot (or the next wrap-around) instead of visiting every tick
+        const Occupancy& occupied = _occupied[0];
+        std::size_t due = Slots;
+        for (std::size_t word = index / 64; word < occupied.size() && due == Slots; ++word)
+        {
+            std::uint64_t bits = occupied[word];
+            if (word == index / 64)
+                bits &= ~std::uint64_t{0} << (index % 64);
+            if (bits != 0)
+                due = word * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+        }
+        if (due == Slots)
+        {
+            _next = (std::min) (_next + (Slots - index), target + 1);
+            continue;
+        }
+        if (_next + (due - index) > target)
+        {
+            _next = target + 1;
+            break;
+        }
+
+        _next += due - index;
+        fireSlot(due, fired);
+    }
+    return fired;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::nextExpiry() const noexcept
+{
+    if (_count == 0)
+        return std::nullopt;
+
+    const std::size_t index = slotIndex(_next, 0);
+    if (index == 0)
+    {
+        // advance() stopped on a wrap-around without processing it; the outer slots due now are not cascaded yet
+        for (std::size_t level = 1; level < Levels; ++level)
+        {
+            const std::size_t outer = slotIndex(_next, level);
+            if ((_occupied[level][outer / 64] >> (outer % 64)) & 1u)
+                return _origin + _tick * static_cast<Clock::rep>(_next);
+            if (outer != 0)
+                break;
+        }
+    }
+
+    std::uint64_t ahead = Slots - index; // the next wrap-around, when outer timers cascade down
+    const Occupancy& occupied = _occupied[0];
+    for (std::size_t word = index / 64; word < occupied.size(); ++word)
+    {
+        std::uint64_t bits = occupied[word];
+        if (word == index / 64)
+            bits &= ~std::uint64_t{0} << (index % 64);
+        if (bits != 0)
+        {
+            ahead = word * 64 + static_cast<std::size_t>(std::countr_zero(bits)) - index;
+            break;
+        }
+    }
+    return _origin + _tick * static_cast<Clock::rep>(_next + ahead);
+}
+
+void TimerWheel::file(Timer& timer) noexcept
+{
+    // Overdue timers go to the slot processed next
+    const std::uint64_t expires = (std::max) (timer._expires, _next);
+    std::uint64_t placed = expires;
+    std::size_t level = 0;
+    while (level + 1 < Levels && placed - _next >= span(level))
+        ++level;
+    if (placed - _next >= span(Levels - 1))
+        placed = _next + span(Levels - 1) - 1; // beyond the outermost level: park it, re-filed when cascaded
+
+    const std::size_t index = slotIndex(placed, level);
+    append(_slots[level][index], timer);
+    _occupied[level][index / 64] |= std::uint64_t{1} << (index % 64);
+    timer._slot = static_cast<std::uint16_t>(level * Slots + index);
+}
+
+void TimerWheel::unlink(Timer& timer) noexcept
+{
+    timer.prev->next = timer.next;
+    timer.next->prev = timer.prev;
+    timer.prev = timer.next = &timer;
+
+    if (timer._slot != Timer::NoSlot)
+    {
+        const std::size_t level = timer._slot / Slots;
+        const std::size_t index = timer._slot % Slots;
+        if (const Node& head = _slots[level][index]; head.next == &head)
+            _occupied[level][index / 64] &= ~(std::uint64_t{1} << (index % 64));
+        timer._slot = Timer::NoSlot;
+    }
+    timer._wheel = nullptr;
+    --_count;
+}
+
+void TimerWheel::cascade(const std::size_t level) noexcept
+{
+    const std::size_t index = slotIndex(_next, level);
+    Node& head = _slots[level][index];
+    while (head.next != &head)
+    {
+        auto& timer = static_cast<Timer&>(*head.next);
+        unlink(timer);
+        timer._wheel = this;
+        ++_count;
+        file(timer);
+    }
+}
+
+void TimerWheel::fireSlot(const std::size_t index, std::size_t& fired)
+{
+    // Detach the whole slot first: callbacks may file timers into it again, which must wait for the next tick
+    Node due;
+    Node& head = _slots[0][index];
+    ++_next;
+    if (head.next == &head)
+        return;
+    due.next = head.next;
+    due.prev = head.prev;
+    due.next->prev = &due;
+    due.prev->next = &due;
+    head.prev = head.next = &head;
+    _occupied[0][index / 64] &= ~(std::uint64_t{1} << (index % 64));
+    for (Node* node = due.next; node != &due; node = node->next)
+        static_cast<Timer*>(node)->_slot = Timer::NoSlot;
+
+    while (due.next != &due)
+    {
+        auto& timer = static_cast<Timer&>(*due.next);
+        unlink(timer);
+        try
+        {
+            if (timer.callback)
+                timer.callback();
+        }
+        catch (...)
+        {
+            // Put the rest back so that they fire on the next advance()
+            while (due.next != &due)
+            {
+                auto& rest = static_cast<Timer&>(*due.next);
+                rest.prev->next = rest.next;
+                rest.next->prev = rest.prev;
+                file(rest);
+            }
+            throw;
+        }
+        ++fired;
+    }
+}
+
+std::uint64_t TimerWheel::ticksAt(const Clock::time_point time, const bool roundUp) const noexcept
+{
+    if (time <= _origin)
+        return 0;
+    const auto elapsed = time - _origin;
+    const auto ticks = static_cast<std::uint64_t>(elapsed / _tick);
+    return roundUp && elapsed % _tick != Clock::duration::zero() ? ticks + 1 : ticks;
+}
+
+void TimerWheel::append(Node& list, Node& node) noexcept
+{
+    node.prev = list.prev;
+    node.next = &list;
+    list.prev->next = &node;
+    list.prev = &node;
+}
@@ -21,7 +21,7 @@ UnixSocket::UnixSocket(const std::string_view path, const std::size_t bufferSize
     if (getSocketFd() == INVALID_SOCKET)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
@@ -91,7 +91,7 @@ void UnixSocket::bind()
     {
         CloseSocket(getSocketFd());
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
     _isListening = true;
 }
@@ -102,7 +102,7 @@ void UnixSocket::listen(int backlog) const
     {
         CloseSocket(getSocketFd());
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
@@ -112,7 +112,7 @@ void UnixSocket::connect()
     {
         CloseSocket(getSocketFd());
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 }
 
@@ -133,7 +133,7 @@ UnixSocket UnixSocket::accept() const
     if (client_fd == INVALID_SOCKET)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
     UnixSocket client;
     client.setSocketFd(client_fd);
@@ -154,7 +154,7 @@ size_t UnixSocket::write(std::string_view data) const
     if (ret < 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return static_cast<size_t>(ret);
@@ -172,7 +172,7 @@ size_t UnixSocket::read(char* buffer, std::size_t len) const
     if (ret == -1)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     return static_cast<size_t>(ret);
@@ -185,14 +185,14 @@ void UnixSocket::setNonBlocking(bool nonBlocking) const
     if (ioctlsocket(getSocketFd(), FIONBIO, &mode) != 0)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #else
     int flags = fcntl(getSocketFd(), F_GETFL, 0);
     if (flags == -1)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
     if (nonBlocking)
         flags |= O_NONBLOCK;
@@ -201,7 +201,7 @@ void UnixSocket::setNonBlocking(bool nonBlocking) const
     if (fcntl(getSocketFd(), F_SETFL, flags) == -1)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #endif
 }
@@ -216,7 +216,7 @@ void UnixSocket::setTimeout(int millis) const
             SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #else
     const timeval tv{millis / 1000, (millis % 1000) * 1000};
@@ -224,7 +224,7 @@ void UnixSocket::setTimeout(int millis) const
         setsockopt(getSocketFd(), SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 #endif
 }
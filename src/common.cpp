@@ -1,4 +1,5 @@
 #include "jsocketpp/common.hpp"
+#include "jsocketpp/internal/IoVecCursor.hpp"
 
 using namespace jsocketpp;
 
@@ -118,6 +119,17 @@ std::string jsocketpp::SocketErrorMessage(int error, [[maybe_unused]] const bool
 #endif
 }
 
+std::string SocketException::buildErrorMessage() const
+{
+    std::string msg = _context ? std::string(_context) : _message;
+    if (msg.empty())
+        msg = SocketErrorMessage(_errorCode);
+    msg += " (error code ";
+    msg += std::to_string(_errorCode);
+    msg += ')';
+    return msg;
+}
+
 #ifdef _WIN32
 /**
  * Redefine because not available on Windows XP
@@ -265,7 +277,7 @@ std::vector<std::string> jsocketpp::getHostAddr()
         {
             HeapFree(GetProcessHeap(), 0, pAddresses);
         }
-        throw SocketException(static_cast<int>(dwRetVal), SocketErrorMessage(static_cast<int>(dwRetVal)));
+        throw SocketException(static_cast<int>(dwRetVal));
     }
 
     if (pAddresses)
@@ -280,7 +292,7 @@ std::vector<std::string> jsocketpp::getHostAddr()
     if (getifaddrs(&ifAddrStruct))
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     for (ifa = ifAddrStruct; ifa != nullptr; ifa = ifa->ifa_next)
@@ -324,7 +336,7 @@ std::string jsocketpp::ipFromSockaddr(const sockaddr* addr, const bool convertIP
         if (!inet_ntop(AF_INET, &sa->sin_addr, buf, sizeof(buf)))
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
     }
     else if (addr->sa_family == AF_INET6)
@@ -341,7 +353,7 @@ std::string jsocketpp::ipFromSockaddr(const sockaddr* addr, const bool convertIP
         if (!inet_ntop(AF_INET6, &sa6->sin6_addr, buf, sizeof(buf)))
         {
             const int error = GetSocketError();
-            throw SocketException(error, SocketErrorMessage(error));
+            throw SocketException(error);
         }
     }
     else
@@ -375,7 +387,7 @@ std::string internal::getBoundLocalIp(const SOCKET sockFd)
     if (getsockname(sockFd, reinterpret_cast<sockaddr*>(&addr), &addrLen) == SOCKET_ERROR)
     {
         const int err = GetSocketError();
-        throw SocketException(err, SocketErrorMessage(err));
+        throw SocketException(err);
     }
 
     char ipStr[NI_MAXHOST] = {};
@@ -474,6 +486,49 @@ void jsocketpp::stringToAddress(const std::string& str, sockaddr_storage& addr)
     std::memcpy(&addr, res->ai_addr, res->ai_addrlen);
 }
 
+bool internal::parseNumericAddress(const std::string_view host, const Port port, sockaddr_storage& out,
+                                   socklen_t& outLen) noexcept
+{
+    // Longest literal: full IPv6 text plus a zone name
+    char text[INET6_ADDRSTRLEN + IF_NAMESIZE + 1]{};
+    if (host.empty() || host.size() >= sizeof(text))
+        return false;
+    std::memcpy(text, host.data(), host.size());
+
+    if (host.find(':') == std::string_view::npos)
+    {
+        sockaddr_in addr{};
+        if (::inet_pton(AF_INET, text, &addr.sin_addr) != 1)
+            return false;
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        out = sockaddr_storage{};
+        std::memcpy(&out, &addr, sizeof(addr));
+        outLen = sizeof(addr);
+        return true;
+    }
+
+    sockaddr_in6 addr{};
+    if (char* zone = std::strchr(text, '%'); zone != nullptr)
+    {
+        *zone++ = '\0';
+        char* end = nullptr;
+        const unsigned long numeric = std::strtoul(zone, &end, 10);
+        addr.sin6_scope_id = (*zone != '\0' && *end == '\0') ? static_cast<decltype(addr.sin6_scope_id)>(numeric)
+                                                              : ::if_nametoindex(zone);
+        if (addr.sin6_scope_id == 0)
+            return false;
+    }
+    if (::inet_pton(AF_INET6, text, &addr.sin6_addr) != 1)
+        return false;
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port = htons(port);
+    out = sockaddr_storage{};
+    std::memcpy(&out, &addr, sizeof(addr));
+    outLen = sizeof(addr);
+    return true;
+}
+
 void internal::sendExact(const SOCKET fd, const void* data, std::size_t size)
 {
     if (fd == INVALID_SOCKET)
@@ -495,7 +550,7 @@ void internal::sendExact(const SOCKET fd, const void* data, std::size_t size)
     if (sent == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (static_cast<std::size_t>(sent) != size)
@@ -524,7 +579,7 @@ void internal::sendExactTo(const SOCKET fd, const void* data, std::size_t size,
     if (sent == SOCKET_ERROR)
     {
         const int error = GetSocketError();
-        throw SocketException(error, SocketErrorMessage(error));
+        throw SocketException(error);
     }
 
     if (static_cast<std::size_t>(sent) != size)
@@ -533,3 +588,60 @@ void internal::sendExactTo(const SOCKET fd, const void* data, std::size_t size,
     if (afterSuccess)
         afterSuccess(ctx);
 }
+
+void internal::sendExactv(const SOCKET fd, const std::span<const std::string_view> buffers, const sockaddr* addr,
+                          const socklen_t addrLen)
+{
+    if (fd == INVALID_SOCKET)
+        throw SocketException("sendExactv(): invalid socket");
+
+    std::size_t total = 0;
+    for (const auto& b : buffers)
+        total += b.size();
+
+    if (buffers.size() > IoVecMax)
+    {
+        // More fragments than one call accepts: coalesce and send once.
+        std::string datagram;
+        datagram.reserve(total);
+        for (const auto& b : buffers)
+            datagram.append(b);
+
+        if (addr)
+            sendExactTo(fd, datagram.data(), datagram.size(), addr, addrLen, nullptr, nullptr);
+        else
+            sendExact(fd, datagram.data(), datagram.size());
+        return;
+    }
+
+    // All fragments fit in the cursor's first batch, which lives on this stack frame; empty ones are harmless
+    IoVecCursor<const std::string_view> cursor(buffers);
+    IoVec* vec = cursor.data();
+    const std::size_t count = cursor.size();
+
+#ifdef _WIN32
+    DWORD sent = 0;
+    if (::WSASendTo(fd, vec, static_cast<DWORD>(count), &sent, 0, addr, addr ? addrLen : 0, nullptr, nullptr) ==
+        SOCKET_ERROR)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+#else
+    msghdr msg{};
+    msg.msg_name = const_cast<sockaddr*>(addr);
+    msg.msg_namelen = addr ? addrLen : 0;
+    msg.msg_iov = vec;
+    msg.msg_iovlen = count;
+
+    const ssize_t sent = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+    if (sent < 0)
+    {
+        const int error = GetSocketError();
+        throw SocketException(error);
+    }
+#endif
+
+    if (static_cast<std::size_t>(sent) != total)
+        throw SocketException("sendExactv(): partial datagram was sent.");
+}
@@ -1,11 +1,35 @@
 // GoogleTest unit tests for jsocketpp
+#include "jsocketpp/AcceptLoop.hpp"
+#include "jsocketpp/BufferPool.hpp"
 #include "jsocketpp/DatagramSocket.hpp"
+#include "jsocketpp/Endpoint.hpp"
+#include "jsocketpp/EventLoop.hpp"
+#include "jsocketpp/IoService.hpp"
+#include "jsocketpp/Relay.hpp"
+#include "jsocketpp/Selector.hpp"
 #include "jsocketpp/ServerSocket.hpp"
+#include "jsocketpp/ShardedDatagramServer.hpp"
+#include "jsocketpp/ShardedServer.hpp"
 #include "jsocketpp/Socket.hpp"
 #include "jsocketpp/SocketInitializer.hpp"
+#include "jsocketpp/SocketTimeoutException.hpp"
+#include "jsocketpp/TimerWheel.hpp"
 #include "jsocketpp/UnixSocket.hpp"
+#include "jsocketpp/internal/IoVecCursor.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <memory_resource>
 #include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 using namespace jsocketpp;
 
@@ -64,6 +88,829 @@ TEST(SocketTest, TcpSetGetOption)
     EXPECT_NO_THROW(s.setNonBlocking(true));
 }
 
+TEST(SocketExceptionTest, FormatsWhatLazily)
+{
+    static constexpr char context[] = "accept() failed";
+    const SocketException literal(context);
+    EXPECT_EQ(literal.what(), context); // referenced, not copied
+
+    const SocketException withContext(ECONNREFUSED, context);
+    EXPECT_EQ(std::string(withContext.what()), "accept() failed (error code " + std::to_string(ECONNREFUSED) + ")");
+
+    const SocketException system(ECONNREFUSED);
+    const std::string expected =
+        SocketErrorMessage(ECONNREFUSED) + " (error code " + std::to_string(ECONNREFUSED) + ")";
+    EXPECT_EQ(std::string(system.what()), expected);
+    EXPECT_EQ(std::string(SocketException(system).what()), expected);
+
+    const SocketTimeoutException timeout;
+    EXPECT_EQ(timeout.getErrorCode(), JSOCKETPP_TIMEOUT_CODE);
+    EXPECT_NE(std::string(timeout.what()).find(SocketErrorMessage(JSOCKETPP_TIMEOUT_CODE)), std::string::npos);
+}
+
+TEST(SocketExceptionTest, CopiesNonLiteralsAndFormatsOnce)
+{
+    char buffer[32] = "bind() failed";
+    const char* pointer = buffer;
+    const SocketException copied(pointer);
+    const SocketException copiedWithCode(EADDRINUSE, std::string(buffer));
+    buffer[0] = 'X';
+    EXPECT_EQ(std::string(copied.what()), "bind() failed");
+    EXPECT_EQ(std::string(copiedWithCode.what()), "bind() failed (error code " + std::to_string(EADDRINUSE) + ")");
+
+    // Concurrent first calls to what() must agree on one formatted message
+    const SocketException shared(ECONNRESET);
+    std::vector<const char*> seen(4);
+    std::vector<std::thread> readers;
+    for (auto& result : seen)
+        readers.emplace_back([&] { result = shared.what(); });
+    for (auto& reader : readers)
+        reader.join();
+    for (const char* result : seen)
+        EXPECT_EQ(result, seen.front());
+
+    // Assigning over an already formatted exception replaces its message
+    SocketException assigned(ECONNRESET);
+    static_cast<void>(assigned.what());
+    assigned = copiedWithCode;
+    EXPECT_EQ(std::string(assigned.what()), copiedWithCode.what());
+}
+
+TEST(SocketExceptionTest, TimedWaitsThrowLiteralContext)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+
+    const std::string suffix = " (error code " + std::to_string(JSOCKETPP_TIMEOUT_CODE) + ")";
+    try
+    {
+        (void) peer.readAtMostWithTimeout(1, 10);
+        ADD_FAILURE() << "readAtMostWithTimeout() did not time out";
+    }
+    catch (const SocketTimeoutException& e)
+    {
+        EXPECT_EQ(std::string(e.what()), "Read timed out" + suffix);
+    }
+}
+
+TEST(SocketTest, TcpAcceptInheritsListenerOptions)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1", false);
+    server.setInheritedOptions({.recvBufferSize = 256 * 1024, .soRecvTimeoutMillis = 1500, .keepAlive = true});
+    server.bind();
+    server.listen();
+    ASSERT_TRUE(server.getInheritedOptions().has_value());
+    EXPECT_EQ(server.getDefaultReceiveBufferSize(), 256u * 1024);
+
+    Socket first("127.0.0.1", server.getLocalPort());
+    Socket inherited = server.accept(std::nullopt, std::nullopt, std::nullopt, -1, -1, true, true);
+    EXPECT_GE(inherited.getReceiveBufferSize(), 256 * 1024);
+    EXPECT_EQ(inherited.getSoRecvTimeout(), 1500);
+    EXPECT_TRUE(inherited.getKeepAlive());
+    EXPECT_TRUE(inherited.getTcpNoDelay());
+    EXPECT_FALSE(inherited.getNonBlocking());
+
+    // Values that differ from the inherited ones are still applied
+    Socket second("127.0.0.1", server.getLocalPort());
+    Socket overridden = server.accept(std::nullopt, std::nullopt, std::nullopt, 200, -1, false, false, true);
+    EXPECT_EQ(overridden.getSoRecvTimeout(), 200);
+    EXPECT_FALSE(overridden.getKeepAlive());
+    EXPECT_FALSE(overridden.getTcpNoDelay());
+    EXPECT_TRUE(overridden.getNonBlocking());
+}
+
+TEST(SocketTest, TryIoReportsWouldBlockAndClose)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept(std::nullopt, std::nullopt, std::nullopt, -1, -1, true, false, true);
+
+    char buf[16];
+    const IoResult empty = peer.tryReadInto(buf, sizeof(buf));
+    EXPECT_TRUE(empty.wouldBlock());
+    EXPECT_EQ(empty.bytes, 0u);
+    EXPECT_THROW((void) peer.readInto(buf, sizeof(buf)), SocketException);
+
+    ASSERT_TRUE(client.tryWrite("hello").ok());
+    ASSERT_TRUE(peer.waitReady(false, 2000));
+    const IoResult data = peer.tryReadInto(buf, sizeof(buf));
+    ASSERT_TRUE(data.ok());
+    EXPECT_EQ(std::string(buf, data.bytes), "hello");
+
+    client.close();
+    ASSERT_TRUE(peer.waitReady(false, 2000));
+    EXPECT_TRUE(peer.tryReadInto(buf, sizeof(buf)).closed());
+    EXPECT_EQ(peer.readInto(buf, sizeof(buf)), 0u);
+
+    DatagramSocket udp(0, "127.0.0.1");
+    udp.setNonBlocking(true);
+    EXPECT_TRUE(udp.tryReadInto(buf, sizeof(buf)).wouldBlock());
+
+    DatagramSocket sender(0, "127.0.0.1");
+    sender.writeTo("127.0.0.1", udp.getLocalPort(), std::string_view("0123456789abcdefXYZ")); // 3 bytes too many
+    ASSERT_TRUE(udp.hasPendingData(2000));
+    DatagramReadResult info;
+    const IoResult datagram = udp.tryReadInto(buf, sizeof(buf), info);
+    ASSERT_TRUE(datagram.ok());
+    EXPECT_EQ(datagram.bytes, sizeof(buf));
+    EXPECT_EQ(std::string(buf, datagram.bytes), "0123456789abcdef");
+    EXPECT_TRUE(info.truncated);
+    ASSERT_EQ(info.src.ss_family, AF_INET);
+    EXPECT_EQ(ntohs(reinterpret_cast<const sockaddr_in&>(info.src).sin_port), sender.getLocalPort());
+    EXPECT_TRUE(udp.tryReadInto(buf, sizeof(buf), info).wouldBlock());
+}
+
+#ifndef _WIN32
+TEST(SocketTest, TimedWaitsAboveFdSetsize)
+{
+    rlimit limit{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+    if (limit.rlim_max != RLIM_INFINITY && limit.rlim_max < FD_SETSIZE + 64)
+        GTEST_SKIP() << "RLIMIT_NOFILE too low to exceed FD_SETSIZE";
+    const rlimit saved = limit;
+    limit.rlim_cur = FD_SETSIZE + 64;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+
+    // Occupy the low descriptors so that every socket below lands above FD_SETSIZE
+    std::vector<int> fillers;
+    for (int fd = ::dup(0); fd >= 0; fd = ::dup(0))
+    {
+        fillers.push_back(fd);
+        if (fd >= FD_SETSIZE - 1)
+            break;
+    }
+    {
+        SocketInitializer init;
+        ServerSocket server(0, "127.0.0.1");
+        Socket client("127.0.0.1", server.getLocalPort(), std::nullopt, std::nullopt, std::nullopt, true, -1, -1,
+                      true, true, false, false, false);
+        EXPECT_GE(client.getSocketFd(), FD_SETSIZE);
+        EXPECT_FALSE(server.waitReady(0));
+        client.connect(2000);
+        EXPECT_TRUE(server.waitReady(2000));
+        Socket peer = server.accept();
+
+        EXPECT_FALSE(peer.waitReady(false, 20));
+        (void) client.write("x");
+        EXPECT_TRUE(peer.waitReady(false, 2000));
+
+        DatagramSocket udp(0, "127.0.0.1");
+        udp.connect("127.0.0.1", udp.getLocalPort(), 2000);
+        EXPECT_TRUE(udp.isConnected());
+        EXPECT_FALSE(udp.hasPendingData(20));
+        udp.write(std::string_view("x"));
+        EXPECT_TRUE(udp.hasPendingData(2000));
+    }
+    for (const int fd : fillers)
+        ::close(fd);
+    setrlimit(RLIMIT_NOFILE, &saved);
+}
+#endif
+
+TEST(SocketTest, TcpReadUntilKeepsPipelinedBytes)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    EXPECT_NO_THROW(peer.writeAll(std::string("one\ntwo\n") + std::string("\0\0\0\3abc", 7)));
+    EXPECT_EQ(client.readLine(), "one\n");
+    EXPECT_EQ(client.readLine(8192, false), "two");
+    EXPECT_EQ(client.readPrefixed<uint32_t>(), "abc");
+    EXPECT_EQ(client.bufferedBytes(), 0u);
+}
+
+TEST(SocketTest, TcpReceiveBufferBorrowedOnlyWhileNonEmpty)
+{
+    SocketInitializer init;
+    BufferPool pool;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    peer.setReceiveBufferPool(pool);
+    EXPECT_EQ(pool.outstandingBytes(), 0u);
+
+    (void) client.write("one\ntwo");
+    ASSERT_TRUE(peer.waitReady(false, 2000));
+    EXPECT_EQ(peer.readUntil('\n'), "one\n");
+    if (peer.bufferedBytes() == 0)
+        EXPECT_EQ(peer.readExact(3), "two"); // "two" arrived in a separate segment
+    else
+    {
+        EXPECT_EQ(pool.outstandingBytes(), BufferPool::blockSize(DefaultBufferSize));
+        EXPECT_EQ(peer.readAtMost(16), "two");
+    }
+    EXPECT_EQ(peer.bufferedBytes(), 0u);
+    EXPECT_EQ(pool.outstandingBytes(), 0u);
+    EXPECT_EQ(pool.cachedBytes(), BufferPool::blockSize(DefaultBufferSize));
+}
+
+TEST(BufferPoolTest, GlobalPoolKeepsOneBlockPerThread)
+{
+    constexpr std::size_t size = BufferPool::MaxBlockSize / 2; // a class no socket in these tests uses
+    BufferPool& pool = BufferPool::global();
+    void* kept = nullptr;
+    std::thread(
+        [&]
+        {
+            char* block = pool.acquire(size);
+            kept = block;
+            pool.release(block, size);
+
+            // The block stays with this thread, so another thread cannot get it yet
+            std::thread(
+                [&]
+                {
+                    char* other = pool.acquire(size);
+                    EXPECT_NE(other, kept);
+                    pool.release(other, size);
+                })
+                .join();
+            char* again = pool.acquire(size);
+            EXPECT_EQ(again, kept);
+            pool.release(again, size);
+        })
+        .join();
+
+    // Exiting threads return their blocks to the shared free lists; `kept` went back last
+    std::thread(
+        [&]
+        {
+            char* block = pool.acquire(size);
+            EXPECT_EQ(block, kept);
+            pool.release(block, size);
+        })
+        .join();
+}
+
+TEST(SocketTest, TcpPmrReadsAndScratchUseCallerResource)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+
+    // Anything not served from storage throws, so the heap is never touched behind our back
+    std::array<std::byte, 8192> storage{};
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(), std::pmr::null_memory_resource());
+    const auto* first = reinterpret_cast<const char*>(storage.data());
+    const auto inArena = [first](const char* p) { return p >= first && p < first + 8192; };
+
+    client.setMemoryResource(&arena);
+    EXPECT_EQ(client.getMemoryResource(), &arena);
+    const std::array<std::string_view, 3> parts{"0123456789abcdefghijklmnopqrstuvwxyz", "+", "tail"};
+    EXPECT_EQ(client.writevAll(parts), 41u);
+
+    const std::pmr::string head = peer.readExact(36, &arena);
+    EXPECT_EQ(head, "0123456789abcdefghijklmnopqrstuvwxyz");
+    EXPECT_TRUE(inArena(head.data()));
+    peer.setMemoryResource(&arena);
+    EXPECT_EQ(peer.peek(1, nullptr), "+");
+    EXPECT_EQ(peer.readAtMost(1, nullptr), "+");
+    const std::pmr::string tail = peer.readExact(4, nullptr);
+    EXPECT_EQ(tail.get_allocator().resource(), &arena);
+    EXPECT_EQ(tail, "tail");
+
+    std::pmr::vector<DatagramPacket> packets(&arena);
+    packets.emplace_back(64);
+    EXPECT_TRUE(inArena(packets.front().buffer.data()));
+}
+
+TEST(SocketTest, TcpVectoredIoBeyondIovMax)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+
+    // More fragments than one writev()/readv() accepts, with empty ones mixed in
+    const std::size_t count = 2 * internal::IoVecMax + 5;
+    std::string payload;
+    std::vector<std::string_view> fragments;
+    for (std::size_t i = 0; i < count; ++i)
+        payload += static_cast<char>('a' + i % 26);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        fragments.emplace_back(payload.data() + i, 1);
+        if (i % 100 == 0)
+            fragments.emplace_back();
+    }
+
+    std::thread writer([&] { EXPECT_EQ(client.writevAll(fragments), count); });
+    std::string received(count, '\0');
+    std::vector<BufferView> views;
+    for (std::size_t i = 0; i < count; i += 2)
+        views.push_back({received.data() + i, (std::min) (std::size_t{2}, count - i)});
+    EXPECT_EQ(peer.readvAll(views), count);
+    writer.join();
+    EXPECT_EQ(received, payload);
+}
+
+TEST(SocketTest, TcpViewReadsBorrowReceiveBuffer)
+{
+    SocketInitializer init;
+    BufferPool pool;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    peer.setReceiveBufferPool(pool);
+    peer.setInternalBufferSize(8); // the frame below does not fit
+
+    EXPECT_NO_THROW(client.writeAll("GET /\r\nHEADER:frame-longer-than-8\n"));
+    const std::string_view line = peer.viewUntil("\r\n");
+    EXPECT_EQ(line, "GET /\r\n");
+    peer.consume(line.size());
+
+    EXPECT_EQ(peer.viewExact(7), "HEADER:");
+    const std::string_view frame = peer.viewExact(26);
+    EXPECT_EQ(frame.substr(7), "frame-longer-than-8");
+    peer.consume(frame.size());
+
+    EXPECT_EQ(peer.viewAtMost(16), "\n");
+    EXPECT_THROW(peer.consume(2), SocketException);
+    peer.consume(1);
+    EXPECT_EQ(pool.outstandingBytes(), 0u); // storage returned once everything is consumed
+
+    EXPECT_NO_THROW(client.writeAll("x"));
+    ASSERT_TRUE(peer.waitReady(false, 2000));
+    EXPECT_EQ(peer.viewAvailable(), "x");
+    EXPECT_EQ(peer.readExact(1), "x");
+}
+
+#if defined(__linux__)
+TEST(SocketTest, TcpMirroredReceiveBufferWrapsAround)
+{
+    SocketInitializer init;
+    BufferPool pool;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    peer.setReceiveBufferSize(1 << 20); // the default socket buffers make bulk transfers crawl
+    peer.setReceiveBufferPool(pool);
+    peer.setInternalBufferSize(100); // rounded up to one page
+    peer.setMirroredReceiveBuffer(true);
+    EXPECT_TRUE(peer.getMirroredReceiveBuffer());
+
+    // 1004-byte frames don't divide the ring, so many of them straddle its end
+    constexpr std::size_t frames = 64;
+    std::thread writer(
+        [&client]
+        {
+            for (std::size_t i = 0; i < frames; ++i)
+            {
+                const std::uint32_t length = net::toNetwork(static_cast<std::uint32_t>(1000));
+                std::string frame(sizeof(length), '\0');
+                std::memcpy(frame.data(), &length, sizeof(length));
+                frame.append(1000, static_cast<char>('a' + i % 26));
+                EXPECT_NO_THROW(client.writeAll(frame));
+            }
+        });
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        if (i % 2 == 0)
+            EXPECT_EQ(peer.readPrefixed<std::uint32_t>(), std::string(1000, static_cast<char>('a' + i % 26)));
+        else
+        {
+            const std::string_view frame = peer.viewExact(1004);
+            EXPECT_EQ(frame.substr(4), std::string(1000, static_cast<char>('a' + i % 26)));
+            peer.consume(frame.size());
+        }
+    }
+    writer.join();
+    EXPECT_EQ(pool.outstandingBytes(), 0u); // the ring is not borrowed from the pool
+
+    EXPECT_NO_THROW(client.writeAll("tail"));
+    EXPECT_EQ(peer.viewExact(4), "tail");
+    peer.consume(2);
+    peer.setMirroredReceiveBuffer(false); // buffered bytes move into a pool block
+    EXPECT_FALSE(peer.getMirroredReceiveBuffer());
+    EXPECT_GT(pool.outstandingBytes(), 0u);
+    EXPECT_EQ(peer.readExact(2), "il");
+    EXPECT_EQ(pool.outstandingBytes(), 0u);
+}
+#endif
+
+TEST(SocketTest, TcpReadUntilMultiByteDelimiter)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    client.setInternalBufferSize(4); // force the delimiter to straddle several recv() calls
+    EXPECT_NO_THROW(peer.writeAll("HTTP/1.1 200 OK\r\nA: b\r\n\r\nbody"));
+    EXPECT_EQ(client.readUntil("\r\n", 1024, false), "HTTP/1.1 200 OK");
+    EXPECT_EQ(client.readUntil("\r\n\r\n", 1024), "A: b\r\n\r\n");
+    EXPECT_EQ(client.readExact(4), "body");
+}
+
+TEST(SocketTest, TcpZeroCopyWrite)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    // The default socket buffers are too small for bulk transfers
+    peer.setReceiveBufferSize(1 << 20);
+    client.setSendBufferSize(1 << 20);
+#if defined(__linux__)
+    client.setZeroCopy(true);
+    EXPECT_TRUE(client.getZeroCopy());
+#endif
+
+    std::string blob(1 << 20, '\0');
+    for (std::size_t i = 0; i < blob.size(); ++i)
+        blob[i] = static_cast<char>(i * 7);
+
+    std::string received;
+    std::thread reader([&] { received = peer.readExact(2 * blob.size()); });
+    const auto first = client.writeZeroCopy(blob);
+    const auto second = client.writeZeroCopy(blob);
+    EXPECT_NO_THROW(client.waitZeroCopy(second, 5000));
+    EXPECT_TRUE(client.isZeroCopyComplete(first));
+    reader.join();
+    EXPECT_EQ(received, blob + blob);
+}
+
+TEST(SocketTest, TcpSendFile)
+{
+    SocketInitializer init;
+    const auto path = (std::filesystem::temp_directory_path() / "jsocketpp_sendfile_test.bin").string();
+    std::string contents(300000, '\0');
+    for (std::size_t i = 0; i < contents.size(); ++i)
+        contents[i] = static_cast<char>(i % 251);
+    std::ofstream(path, std::ios::binary) << contents;
+
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    peer.setReceiveBufferSize(1 << 20);
+    client.setSendBufferSize(1 << 20);
+
+    std::string received;
+    std::thread reader([&] { received = peer.readExact(contents.size() + 1000); });
+    std::uint64_t lastProgress = 0;
+    EXPECT_EQ(client.sendFile(path, 0, std::nullopt,
+                              [&](const std::uint64_t sent, const std::uint64_t total)
+                              {
+                                  EXPECT_GT(sent, lastProgress);
+                                  EXPECT_EQ(total, contents.size());
+                                  lastProgress = sent;
+                              }),
+              contents.size());
+    EXPECT_EQ(lastProgress, contents.size());
+    EXPECT_EQ(client.sendFileWithTotalTimeout(path, 5000, 1000, 5000), 1000u);
+    reader.join();
+    EXPECT_EQ(received, contents + contents.substr(5000, 1000));
+
+    EXPECT_THROW(client.sendFile(path, contents.size() - 10, 20), SocketException); // past end of file
+    std::filesystem::remove(path);
+    EXPECT_THROW(client.sendFile(path), SocketException);
+}
+
+TEST(SelectorTest, ReportsAcceptReadAndWakeup)
+{
+    SocketInitializer init;
+    Selector selector;
+    ServerSocket server(0, "127.0.0.1");
+    server.setNonBlocking(true);
+    selector.registerSocket(server, Interest::Accept, &server);
+    EXPECT_EQ(selector.selectNow(), 0u);
+
+    Socket client("127.0.0.1", server.getLocalPort());
+    ASSERT_EQ(selector.select(1000), 1u);
+    EXPECT_TRUE(selector.selectedKeys().front().isAcceptable());
+    EXPECT_EQ(selector.selectedKeys().front().attachment, &server);
+
+    auto peer = server.acceptNonBlocking();
+    ASSERT_TRUE(peer.has_value());
+    selector.registerSocket(*peer, Interest::Read);
+    EXPECT_NO_THROW(client.writeAll("ping"));
+    ASSERT_EQ(selector.select(1000), 1u);
+    EXPECT_TRUE(selector.selectedKeys().front().isReadable());
+    EXPECT_EQ(selector.selectedKeys().front().fd, peer->getSocketFd());
+
+    EXPECT_TRUE(selector.unregisterSocket(*peer));
+    selector.wakeup();
+    EXPECT_EQ(selector.select(1000), 0u);
+}
+
+TEST(AcceptLoopTest, DispatchesConnectionsToWorkers)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    AcceptLoopOptions options;
+    options.workerThreads = 2;
+    AcceptLoop loop(server, [](Socket client) { client.writeAll(client.readLine()); }, options);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Socket client("127.0.0.1", server.getLocalPort());
+        EXPECT_NO_THROW(client.writeAll("echo\n"));
+        EXPECT_EQ(client.readLine(), "echo\n");
+    }
+    EXPECT_EQ(loop.acceptedCount(), 10u);
+
+    loop.stop();
+    EXPECT_FALSE(loop.isRunning());
+    EXPECT_FALSE(server.getNonBlocking()); // restored for plain accept() calls
+}
+
+TEST(SocketTest, TcpAcceptAsyncReArmsAndCancelsOnClose)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+
+    // Each callback queues the next accept from the accept thread
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::thread::id> threads;
+    std::exception_ptr lastError;
+    std::function<void(std::optional<Socket>, std::exception_ptr)> onAccept =
+        [&](const std::optional<Socket>& client, const std::exception_ptr& error)
+    {
+        const std::lock_guard lock(mutex);
+        if (error)
+            lastError = error;
+        else if (client)
+        {
+            threads.push_back(std::this_thread::get_id());
+            server.acceptAsync(onAccept);
+        }
+        changed.notify_all();
+    };
+    server.acceptAsync(onAccept);
+    for (std::size_t i = 1; i <= 3; ++i)
+    {
+        Socket client("127.0.0.1", server.getLocalPort());
+        std::unique_lock lock(mutex);
+        ASSERT_TRUE(changed.wait_for(lock, std::chrono::seconds(2), [&] { return threads.size() == i; }));
+    }
+    EXPECT_EQ(threads[0], threads[1]); // one thread for every call
+    EXPECT_EQ(threads[1], threads[2]);
+    EXPECT_NE(threads[0], std::this_thread::get_id());
+
+    // close() fails the re-armed callback and a queued future, and joins the thread
+    std::future<Socket> pending = server.acceptAsync();
+    server.close();
+    EXPECT_TRUE(lastError != nullptr);
+    EXPECT_THROW(pending.get(), SocketException);
+}
+
+TEST(SocketTest, TcpAcceptAsyncKeepsListenerNonBlockingUntilStopped)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    ASSERT_FALSE(server.getNonBlocking());
+
+    // A connection lost between readiness and accept() must send the thread back to waiting, not block it
+    std::future<Socket> pending = server.acceptAsync();
+    EXPECT_TRUE(server.getNonBlocking());
+    const Socket client("127.0.0.1", server.getLocalPort());
+    // Either side may win; if this thread takes the connection, the accept thread must keep waiting
+    const bool stolen = server.waitReady(500) && server.acceptNonBlocking().has_value();
+    if (stolen)
+        EXPECT_EQ(pending.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+
+    // Moving stops the accept thread, which restores blocking mode on the listener
+    const ServerSocket moved(std::move(server));
+    EXPECT_FALSE(moved.getNonBlocking());
+    if (stolen)
+        EXPECT_THROW(pending.get(), SocketException);
+    else
+        EXPECT_NO_THROW(pending.get());
+}
+
+TEST(IoServiceTest, EchoesOnBothBackends)
+{
+    SocketInitializer init;
+    // Reactor first so that it is still covered when the io_uring case is skipped
+    for (const bool forceReactor : {true, false})
+    {
+        IoServiceOptions options;
+        options.forceReactor = forceReactor;
+        options.queueDepth = 100; // rounded up to 128
+        IoService io(options);
+        if (!forceReactor && io.backend() != IoBackend::IoUring)
+            GTEST_SKIP() << "io_uring is not available (compiled out or rejected by the kernel)";
+        EXPECT_EQ(io.backend(), forceReactor ? IoBackend::Reactor : IoBackend::IoUring);
+
+        ServerSocket server(0, "127.0.0.1");
+        std::optional<Socket> peer;
+        std::string echoed;
+
+        // Goes through the socket-class entry points, which forward to the service
+        const auto onData = [&](std::span<const char> data, std::exception_ptr)
+        {
+            if (!data.empty())
+                peer->asyncSendChain(io, {std::string(data.begin(), data.end()), "!"});
+        };
+        const auto acceptId = server.asyncAcceptMultishot(io,
+                                                          [&](std::optional<Socket> client, std::exception_ptr)
+                                                          {
+                                                              peer = std::move(client);
+                                                              peer->asyncReceive(io, onData);
+                                                          });
+
+        Socket client("127.0.0.1", server.getLocalPort());
+        EXPECT_NO_THROW(client.writeAll("ping"));
+        while (echoed.size() < 5)
+        {
+            io.runOnce(100);
+            if (client.waitReady(false, 0))
+                echoed += client.read<std::string>();
+        }
+        EXPECT_EQ(echoed, "ping!");
+        EXPECT_TRUE(io.cancel(acceptId));
+        EXPECT_FALSE(io.cancel(acceptId));
+    }
+}
+
+TEST(EventLoopTest, CoroutineEchoAndTimeout)
+{
+    SocketInitializer init;
+    EventLoop loop;
+    ServerSocket server(0, "127.0.0.1");
+    std::string reply;
+    bool timedOut = false;
+
+    const auto serve = [](EventLoop& l, ServerSocket& srv) -> Task<void>
+    {
+        Socket peer = co_await asyncAccept(l, srv);
+        const std::string line = co_await asyncReadUntil(l, peer, "\r\n");
+        co_await asyncWriteAll(l, peer, "echo:" + line);
+        co_await l.sleepFor(std::chrono::milliseconds(200)); // Keep the connection open past the client's timeout
+    };
+    const auto talk = [](EventLoop& l, Port port, std::string& out, bool& expired) -> Task<void>
+    {
+        Socket sock("127.0.0.1", port, std::nullopt, std::nullopt, std::nullopt, true, -1, -1, true, true, false,
+                    false, false);
+        co_await asyncConnect(l, sock, 1000);
+        co_await asyncWriteAll(l, sock, "hello\r\n");
+        out = co_await asyncReadExact(l, sock, 12);
+        try
+        {
+            co_await asyncReadInto(l, sock, out.data(), 1, 50);
+        }
+        catch (const SocketTimeoutException&)
+        {
+            expired = true;
+        }
+    };
+
+    loop.spawn(serve(loop, server));
+    loop.spawn(talk(loop, server.getLocalPort(), reply, timedOut));
+    EXPECT_EQ(loop.taskCount(), 2u);
+    loop.run();
+    EXPECT_EQ(reply, "echo:hello\r\n");
+    EXPECT_TRUE(timedOut);
+    EXPECT_EQ(loop.taskCount(), 0u);
+}
+
+TEST(EventLoopTest, StopBeforeRunIsKept)
+{
+    EventLoop loop;
+    bool started = false;
+    loop.spawn([](bool& flag) -> Task<void>
+               {
+                   flag = true;
+                   co_return;
+               }(started));
+    loop.stop();
+    loop.run(); // returns at once for the earlier stop()
+    EXPECT_FALSE(started);
+    loop.run();
+    EXPECT_TRUE(started);
+    EXPECT_EQ(loop.taskCount(), 0u);
+}
+
+TEST(EventLoopTest, VectoredWriteAcrossSuspensions)
+{
+    SocketInitializer init;
+    EventLoop loop;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket peer = server.accept();
+    client.setSendBufferSize(1 << 20); // the small defaults make loopback crawl on zero-window probes
+    peer.setReceiveBufferSize(1 << 20);
+
+    // More buffers than one writev() takes, and more bytes than the socket buffers hold
+    std::vector<std::string> chunks;
+    std::vector<std::string_view> buffers;
+    std::string expected;
+    for (std::size_t i = 0; i < 3000; ++i)
+        chunks.push_back(std::string(3000, static_cast<char>('a' + i % 26)));
+    for (const auto& chunk : chunks)
+    {
+        buffers.emplace_back(chunk);
+        expected += chunk;
+    }
+
+    std::size_t written = 0;
+    std::string received;
+    loop.spawn([](EventLoop& l, Socket& s, std::span<const std::string_view> b, std::size_t& n) -> Task<void>
+               { n = co_await asyncWritevAll(l, s, b, 5000); }(loop, client, buffers, written));
+    loop.spawn([](EventLoop& l, Socket& s, std::size_t size, std::string& out) -> Task<void>
+               { out = co_await asyncReadExact(l, s, size, 5000); }(loop, peer, expected.size(), received));
+    loop.run();
+    EXPECT_EQ(written, expected.size());
+    EXPECT_EQ(received, expected);
+}
+
+TEST(TimerWheelTest, FiresOnTimeAcrossLevels)
+{
+    using namespace std::chrono;
+    const auto t0 = TimerWheel::Clock::now();
+    TimerWheel wheel(milliseconds(1), t0);
+    std::vector<int> fired;
+
+    // 5 ms stays in the first level; 300 ms and 70 s are cascaded down before they fire
+    TimerWheel::Timer near([&] { fired.push_back(5); });
+    TimerWheel::Timer mid([&] { fired.push_back(300); });
+    TimerWheel::Timer far([&] { fired.push_back(70000); });
+    TimerWheel::Timer cancelled([&] { fired.push_back(-1); });
+    wheel.schedule(near, t0 + milliseconds(5));
+    wheel.schedule(mid, t0 + milliseconds(300));
+    wheel.schedule(far, t0 + seconds(70));
+    wheel.schedule(cancelled, t0 + milliseconds(10));
+    EXPECT_EQ(wheel.size(), 4u);
+    cancelled.cancel();
+    EXPECT_FALSE(cancelled.armed());
+    ASSERT_TRUE(wheel.nextExpiry().has_value());
+    EXPECT_EQ(*wheel.nextExpiry(), t0 + milliseconds(5));
+
+    EXPECT_EQ(wheel.advance(t0 + milliseconds(4)), 0u);
+    EXPECT_EQ(wheel.advance(t0 + milliseconds(5)), 1u);
+
+    // Re-arming moves the deadline instead of adding a second one
+    wheel.schedule(mid, t0 + milliseconds(400));
+    EXPECT_EQ(wheel.advance(t0 + milliseconds(399)), 0u);
+    EXPECT_LE(*wheel.nextExpiry(), t0 + milliseconds(400));
+    EXPECT_EQ(wheel.advance(t0 + milliseconds(400)), 1u);
+
+    // A callback may re-arm its own timer
+    int repeats = 0;
+    TimerWheel::Timer periodic;
+    periodic.callback = [&]
+    {
+        if (++repeats < 3)
+            wheel.schedule(periodic, t0 + milliseconds(1000 + 100 * repeats));
+    };
+    wheel.schedule(periodic, t0 + milliseconds(1000));
+    EXPECT_EQ(wheel.advance(t0 + seconds(2)), 3u);
+
+    EXPECT_EQ(wheel.advance(t0 + milliseconds(69999)), 0u);
+    EXPECT_EQ(wheel.advance(t0 + seconds(71)), 1u);
+    EXPECT_EQ(fired, (std::vector<int>{5, 300, 70000}));
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_FALSE(wheel.nextExpiry().has_value());
+}
+
+TEST(ShardedServerTest, EchoesOnEveryShard)
+{
+    SocketInitializer init;
+    const auto echo = [](EventLoop& loop, Socket client) -> Task<void>
+    { co_await asyncWriteAll(loop, client, co_await asyncReadUntil(loop, client, "\n")); };
+    ShardedServer server(0, echo, {.shards = 2, .localAddress = "127.0.0.1"});
+    ASSERT_EQ(server.shardCount(), 2u);
+    ASSERT_NE(server.getLocalPort(), 0);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Socket client("127.0.0.1", server.getLocalPort());
+        const std::string line = "ping " + std::to_string(i) + "\n";
+        client.writeAll(line);
+        EXPECT_EQ(client.readUntil("\n"), line);
+    }
+    EXPECT_EQ(server.acceptedCount(), 8u);
+    EXPECT_EQ(server.acceptedCount(0) + server.acceptedCount(1), 8u);
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_THROW(Socket("127.0.0.1", server.getLocalPort()), SocketException);
+}
+
+TEST(ShardedServerTest, StopFromSession)
+{
+    SocketInitializer init;
+    ShardedServer* running = nullptr;
+    const auto stopper = [&running](EventLoop&, Socket) -> Task<void>
+    {
+        running->stop(); // must not join its own shard's thread
+        co_return;
+    };
+    ShardedServer server(0, stopper, {.shards = 2, .localAddress = "127.0.0.1"});
+    running = &server;
+
+    Socket client("127.0.0.1", server.getLocalPort());
+    EXPECT_THROW(client.readExact(1), SocketException); // the session ended and closed its socket
+    EXPECT_FALSE(server.isRunning());
+    // ~ShardedServer() joins the shard that called stop() and destroys its loop
+}
+
 TEST(SocketTest, UdpSendRecvLoopback)
 {
     SocketInitializer init;
@@ -81,6 +928,165 @@ TEST(SocketTest, UdpSendRecvLoopback)
     client.close();
 }
 
+TEST(SocketTest, UdpBatchReadWrite)
+{
+    SocketInitializer init;
+    DatagramSocket receiver(0, "127.0.0.1");
+    DatagramSocket sender(0, "127.0.0.1");
+    receiver.setSoRecvTimeout(1000);
+
+    std::vector<DatagramPacket> out;
+    for (int i = 0; i < 5; ++i)
+        out.emplace_back("msg-" + std::to_string(i), "127.0.0.1", receiver.getLocalPort());
+    out.emplace_back(std::string(100, 'x'), "127.0.0.1", receiver.getLocalPort());
+    EXPECT_EQ(sender.writeBatch(out), out.size());
+
+    std::vector<DatagramPacket> in(8, DatagramPacket(16));
+    std::vector<DatagramReadResult> results(in.size());
+    DatagramReadOptions opts{};
+    opts.errorOnTruncate = false;
+    std::size_t got = 0;
+    while (got < out.size())
+        got += receiver.readBatch(std::span(in).subspan(got), opts, std::span(results).subspan(got));
+
+    ASSERT_EQ(got, out.size());
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(std::string(in[i].buffer.begin(), in[i].buffer.end()), "msg-" + std::to_string(i));
+        EXPECT_EQ(in[i].port, sender.getLocalPort());
+        EXPECT_FALSE(results[i].truncated);
+    }
+    EXPECT_TRUE(results[5].truncated);
+    EXPECT_EQ(results[5].bytes, 16u);
+    EXPECT_EQ(results[5].datagramSize, 100u);
+    EXPECT_EQ(receiver.getRemotePort(), sender.getLocalPort());
+}
+
+TEST(SocketTest, UdpSegmentedSendAndSplitReceive)
+{
+    SocketInitializer init;
+    DatagramSocket receiver(0, "127.0.0.1");
+    receiver.setSoRecvTimeout(1000);
+#if defined(__linux__)
+    receiver.setUdpGro(true);
+#endif
+    DatagramSocket sender(0, "127.0.0.1");
+    sender.connect("127.0.0.1", receiver.getLocalPort(), -1);
+
+    std::string data;
+    for (int i = 0; i < 10; ++i)
+        data += std::string(1000, static_cast<char>('a' + i));
+    data += std::string(500, 'z');
+    sender.writeSegmented(data, 1000);
+
+    std::vector<char> buffer(65536);
+    std::vector<std::span<const char>> segments;
+    std::vector<std::string> datagrams;
+    while (datagrams.size() < 11)
+    {
+        const auto result = receiver.readSegments(buffer, segments);
+        EXPECT_EQ(result.srcLen > 0, true);
+        for (const auto segment : segments)
+            datagrams.emplace_back(segment.begin(), segment.end());
+    }
+
+    ASSERT_EQ(datagrams.size(), 11u);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(datagrams[i], std::string(1000, static_cast<char>('a' + i)));
+    EXPECT_EQ(datagrams[10], std::string(500, 'z'));
+}
+
+TEST(SocketTest, UdpEndpointAndDestinationCache)
+{
+    SocketInitializer init;
+    DatagramSocket receiver(0, "127.0.0.1");
+    receiver.setSoRecvTimeout(1000);
+    DatagramSocket sender(0, "127.0.0.1");
+
+    const auto endpoint = Endpoint::parse("127.0.0.1", receiver.getLocalPort());
+    ASSERT_TRUE(endpoint.has_value());
+    EXPECT_EQ(endpoint->toString(), "127.0.0.1:" + std::to_string(receiver.getLocalPort()));
+    EXPECT_EQ(Endpoint::parse("[::1]", 1), std::nullopt);
+    EXPECT_EQ(Endpoint::parse("localhost", 1), std::nullopt);
+    EXPECT_EQ(Endpoint::parse("::1", 1)->getFamily(), AF_INET6);
+
+    sender.writeTo(*endpoint, "endpoint");
+    // Resolved once, then served from the destination cache
+    sender.writeTo("localhost", receiver.getLocalPort(), std::string_view("cached-1"));
+    sender.writeTo("localhost", receiver.getLocalPort(), std::string_view("cached-2"));
+    EXPECT_EQ(sender.getRemotePort(), receiver.getLocalPort());
+
+    for (const std::string expected : {"endpoint", "cached-1", "cached-2"})
+    {
+        DatagramPacket packet(64);
+        receiver.read(packet, {});
+        EXPECT_EQ(std::string(packet.buffer.begin(), packet.buffer.end()), expected);
+        EXPECT_EQ(packet.port, sender.getLocalPort());
+    }
+}
+
+TEST(SocketTest, UdpVectoredSends)
+{
+    SocketInitializer init;
+    DatagramSocket receiver(0, "127.0.0.1");
+    receiver.setSoRecvTimeout(1000);
+    DatagramSocket sender(0, "127.0.0.1");
+
+    const std::array<std::string_view, 3> parts{"head|", "", "body"};
+    // Several dozen fragments in one iovec batch, and more than IOV_MAX
+    const std::vector<std::string_view> many(40, "ab");
+    const std::vector<std::string_view> tooMany(3000, "x");
+
+    sender.writevTo("127.0.0.1", receiver.getLocalPort(), parts);
+    sender.writevTo(*Endpoint::parse("127.0.0.1", receiver.getLocalPort()), many);
+    sender.connect("127.0.0.1", receiver.getLocalPort(), -1);
+    sender.writev(tooMany);
+    sender.writevAll(parts);
+
+    std::string abs;
+    for (int i = 0; i < 40; ++i)
+        abs += "ab";
+    const std::array<std::string, 4> expected{"head|body", abs, std::string(3000, 'x'), "head|body"};
+    for (const std::string& datagram : expected)
+    {
+        DatagramPacket packet(4096);
+        receiver.read(packet, {});
+        EXPECT_EQ(std::string(packet.buffer.begin(), packet.buffer.end()), datagram);
+    }
+}
+
+TEST(SocketTest, UdpShardedServerRepliesFromReceivingSocket)
+{
+    SocketInitializer init;
+    const auto echo = [](const DatagramBatch& batch)
+    {
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            batch.socket.writeTo(batch.packets[i].address, batch.packets[i].port, batch.payload(i));
+    };
+    ShardedDatagramServer server(0, echo, {.shards = 2, .localAddress = "127.0.0.1", .stopCheckMillis = 20});
+    ASSERT_EQ(server.shardCount(), 2u);
+
+    // Distinct source ports, so that hashing can spread the clients over both shards
+    for (int i = 0; i < 6; ++i)
+    {
+        DatagramSocket client(0, "127.0.0.1");
+        client.setSoRecvTimeout(1000);
+        const std::string message = "query " + std::to_string(i);
+        client.writeTo(std::string_view("127.0.0.1"), server.getLocalPort(), std::string_view(message));
+
+        DatagramPacket reply(256);
+        client.read(reply, {});
+        EXPECT_EQ(std::string(reply.buffer.begin(), reply.buffer.end()), message);
+        EXPECT_EQ(reply.port, server.getLocalPort());
+    }
+    EXPECT_EQ(server.receivedCount(), 6u);
+    EXPECT_EQ(server.receivedCount(0) + server.receivedCount(1), 6u);
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_EQ(server.incomingCpu(0), -1);
+}
+
 TEST(SocketTest, UdpTimeout)
 {
     SocketInitializer init;
@@ -111,6 +1117,61 @@ TEST(SocketTest, UnixSocketBindConnect)
     server.close();
     std::remove(path);
 }
+
+TEST(SocketTest, RelayTcpToUnixWithHalfClose)
+{
+    SocketInitializer init;
+    ServerSocket server(0, "127.0.0.1");
+    Socket client("127.0.0.1", server.getLocalPort());
+    Socket front = server.accept();
+
+    const char* path = "/tmp/gtest_relay.sock";
+    std::remove(path);
+    UnixSocket listener(path);
+    listener.bind();
+    listener.listen();
+    UnixSocket back(path);
+    back.connect();
+    UnixSocket upstream = listener.accept();
+
+    // "hello" arrives together with the header and sits in front's read-ahead buffer
+    client.writeAll("GET\nhello");
+    EXPECT_EQ(front.readLine(), "GET\n");
+
+    RelayStats stats;
+    std::thread relayThread([&] { stats = relay(front, back, {.idleTimeoutMillis = 5000}); });
+
+    const auto readUpstream = [&](const std::size_t n)
+    {
+        std::string out;
+        char buf[64];
+        while (out.size() < n)
+        {
+            const std::size_t got = upstream.read(buf, sizeof(buf));
+            if (got == 0)
+                break;
+            out.append(buf, got);
+        }
+        return out;
+    };
+    EXPECT_EQ(readUpstream(5), "hello");
+    (void) upstream.write("world");
+    EXPECT_EQ(client.readExact(5), "world");
+
+    client.shutdown(ShutdownMode::Write);
+    char probe;
+    EXPECT_EQ(upstream.read(&probe, 1), 0u); // EOF propagated to the Unix side
+    (void) upstream.write("bye");
+    ::shutdown(upstream.getSocketFd(), SHUT_WR);
+    EXPECT_EQ(client.readExact(3), "bye");
+
+    relayThread.join();
+    EXPECT_EQ(stats.bytesAToB, 5u);
+    EXPECT_EQ(stats.bytesBToA, 8u);
+    EXPECT_FALSE(stats.idleTimedOut);
+    std::remove(path);
+}
+
 TEST(SocketTest, UnixSocketTimeoutAndNonBlocking)
 {
     const char* path = "/tmp/gtest_unixsock2.sock";